@@ -27,7 +27,7 @@ namespace embree
   template<typename Index, typename Func>
     __forceinline void parallel_for( const Index N, const Func& func)
   {
-#if defined(TASKING_INTERNAL)
+#if defined(TASKING_INTERNAL) || defined(TASKING_OPENMP)
     if (N) {
       TaskScheduler::spawn(Index(0),N,Index(1),[&] (const range<Index>& r) {
           assert(r.size() == 1);
@@ -58,7 +58,7 @@ namespace embree
     __forceinline void parallel_for( const Index first, const Index last, const Index minStepSize, const Func& func)
   {
     assert(first <= last);
-#if defined(TASKING_INTERNAL)
+#if defined(TASKING_INTERNAL) || defined(TASKING_OPENMP)
     TaskScheduler::spawn(first,last,minStepSize,func);
     if (!TaskScheduler::wait())
       throw std::runtime_error("task cancelled");
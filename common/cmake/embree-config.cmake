@@ -56,4 +56,5 @@ SET(EMBREE_GEOMETRY_LINES @EMBREE_GEOMETRY_LINES@)
 SET(EMBREE_GEOMETRY_HAIR @EMBREE_GEOMETRY_HAIR@)
 SET(EMBREE_GEOMETRY_SUBDIV @EMBREE_GEOMETRY_SUBDIV@)
 SET(EMBREE_GEOMETRY_USER @EMBREE_GEOMETRY_USER@)
+SET(EMBREE_GEOMETRY_POINTS @EMBREE_GEOMETRY_POINTS@)
 SET(EMBREE_RAY_PACKETS @EMBREE_RAY_PACKETS@)
@@ -452,6 +452,46 @@ namespace embree
     return permute(a,vint16(reverse_step));
   }
 
+  /* compares lanes i and i^j, lanes in mask keep the larger value */
+  template<int j>
+    __forceinline vint16 usort_exchange(const vint16& a, const vboolf16& mask)
+  {
+    const vint16 b = permute(a,vint16(step) ^ j);
+    return select(mask,umax(a,b),umin(a,b));
+  }
+
+  __forceinline vint16 usort_ascending(const vint16& v)
+  {
+    vint16 a = v;
+    a = usort_exchange<1>(a,0x6666 /* 0b0110011001100110 */);
+    a = usort_exchange<2>(a,0x3c3c /* 0b0011110000111100 */);
+    a = usort_exchange<1>(a,0x5a5a /* 0b0101101001011010 */);
+    a = usort_exchange<4>(a,0x0ff0 /* 0b0000111111110000 */);
+    a = usort_exchange<2>(a,0x33cc /* 0b0011001111001100 */);
+    a = usort_exchange<1>(a,0x55aa /* 0b0101010110101010 */);
+    a = usort_exchange<8>(a,0xff00 /* 0b1111111100000000 */);
+    a = usort_exchange<4>(a,0xf0f0 /* 0b1111000011110000 */);
+    a = usort_exchange<2>(a,0xcccc /* 0b1100110011001100 */);
+    a = usort_exchange<1>(a,0xaaaa /* 0b1010101010101010 */);
+    return a;
+  }
+
+  __forceinline vint16 usort_descending(const vint16& v)
+  {
+    vint16 a = v;
+    a = usort_exchange<1>(a,0x9999 /* 0b1001100110011001 */);
+    a = usort_exchange<2>(a,0xc3c3 /* 0b1100001111000011 */);
+    a = usort_exchange<1>(a,0xa5a5 /* 0b1010010110100101 */);
+    a = usort_exchange<4>(a,0xf00f /* 0b1111000000001111 */);
+    a = usort_exchange<2>(a,0xcc33 /* 0b1100110000110011 */);
+    a = usort_exchange<1>(a,0xaa55 /* 0b1010101001010101 */);
+    a = usort_exchange<8>(a,0x00ff /* 0b0000000011111111 */);
+    a = usort_exchange<4>(a,0x0f0f /* 0b0000111100001111 */);
+    a = usort_exchange<2>(a,0x3333 /* 0b0011001100110011 */);
+    a = usort_exchange<1>(a,0x5555 /* 0b0101010101010101 */);
+    return a;
+  }
+
   __forceinline vint16 prefix_sum(const vint16& a) 
   {
     const vint16 z(zero);
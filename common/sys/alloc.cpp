@@ -176,6 +176,46 @@ namespace embree
   void os_advise(void *ptr, size_t bytes)
   {
   }
+
+  bool os_bind_numa(void* ptr, size_t bytes, unsigned int node) {
+    return false; // memory can only get placed at allocation time under Windows
+  }
+
+  void* os_map_file(const char* fileName, size_t& bytes)
+  {
+    HANDLE file = CreateFileA(fileName,GENERIC_READ,FILE_SHARE_READ,nullptr,OPEN_EXISTING,FILE_ATTRIBUTE_NORMAL,nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+      return nullptr;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file,&size) || size.QuadPart == 0) {
+      CloseHandle(file);
+      return nullptr;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file,nullptr,PAGE_WRITECOPY,0,0,nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr)
+      return nullptr;
+
+    /* the view keeps the mapping alive */
+    void* ptr = MapViewOfFile(mapping,FILE_MAP_COPY,0,0,0);
+    CloseHandle(mapping);
+    if (ptr == nullptr)
+      return nullptr;
+
+    bytes = (size_t) size.QuadPart;
+    return ptr;
+  }
+
+  void os_unmap_file(void* ptr, size_t bytes)
+  {
+    if (ptr == nullptr)
+      return;
+
+    if (!UnmapViewOfFile(ptr))
+      throw std::bad_alloc();
+  }
 }
 
 #endif
@@ -187,11 +227,18 @@ namespace embree
 #if defined(__UNIX__)
 
 #include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
 #include <errno.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sstream>
 
+#if defined(__LINUX__)
+#include <sys/syscall.h>
+#endif
+
 #if defined(__MACOSX__)
 #include <mach/vm_statistics.h>
 #endif
@@ -315,6 +362,55 @@ namespace embree
     madvise(pptr,bytes,MADV_HUGEPAGE); 
 #endif
   }
+
+  bool os_bind_numa(void* ptr, size_t bytes, unsigned int node)
+  {
+#if defined(__LINUX__) && defined(SYS_mbind)
+    /* only bind full pages inside the range */
+    const size_t begin = ((size_t)ptr+PAGE_SIZE_4K-1) & ~size_t(PAGE_SIZE_4K-1);
+    const size_t end   = ((size_t)ptr+bytes) & ~size_t(PAGE_SIZE_4K-1);
+    if (begin >= end) return true;
+    if (node >= 8*sizeof(unsigned long)) return false;
+
+    /* values of MPOL_BIND and MPOL_MF_MOVE from numaif.h, already touched pages get moved */
+    const int mpol_bind = 2, mpol_mf_move = 1 << 1;
+    const unsigned long nodemask = 1ul << node;
+    return syscall(SYS_mbind,(void*)begin,end-begin,mpol_bind,&nodemask,8*sizeof(nodemask)+1,mpol_mf_move) == 0; // the kernel expects the number of mask bits plus one
+#else
+    return false;
+#endif
+  }
+
+  void* os_map_file(const char* fileName, size_t& bytes)
+  {
+    int fd = open(fileName,O_RDONLY);
+    if (fd == -1)
+      return nullptr;
+
+    struct stat st;
+    if (fstat(fd,&st) == -1 || st.st_size == 0) {
+      close(fd);
+      return nullptr;
+    }
+
+    /* private mapping, pages only get copied when written to */
+    void* ptr = mmap(0, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (ptr == MAP_FAILED)
+      return nullptr;
+
+    bytes = (size_t) st.st_size;
+    return ptr;
+  }
+
+  void os_unmap_file(void* ptr, size_t bytes)
+  {
+    if (ptr == nullptr)
+      return;
+
+    if (munmap(ptr,bytes) == -1)
+      throw std::bad_alloc();
+  }
 }
 
 #endif
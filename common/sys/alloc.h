@@ -85,6 +85,13 @@ namespace embree
   void  os_free   (void* ptr, size_t bytes, bool hugepages);
   void  os_advise (void* ptr, size_t bytes);
 
+  /*! binds the pages of some memory range to a NUMA node, returns false on failure */
+  bool os_bind_numa (void* ptr, size_t bytes, unsigned int node);
+
+  /*! maps a file copy-on-write into memory, returns nullptr on failure */
+  void* os_map_file (const char* fileName, size_t& bytes);
+  void  os_unmap_file (void* ptr, size_t bytes);
+
   /*! allocator that performs OS allocations */
   template<typename T>
     struct os_allocator
@@ -188,6 +188,10 @@ namespace embree
     return _InterlockedCompareExchange((volatile long*)p,v,c);
   }
 
+  __forceinline size_t atomic_add(volatile size_t* p, const size_t v) {
+    return _InterlockedExchangeAdd64((volatile __int64*)p,v);
+  }
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Unix Platform
 ////////////////////////////////////////////////////////////////////////////////
@@ -369,6 +373,10 @@ namespace embree
   __forceinline int32_t atomic_cmpxchg(int32_t volatile* value, int32_t comparand, const int32_t input) {
     return __sync_val_compare_and_swap(value, comparand, input);
   }
+
+  __forceinline size_t atomic_add(size_t volatile* value, const size_t input) {
+    return __sync_fetch_and_add(value, input);
+  }
   
 #endif
   
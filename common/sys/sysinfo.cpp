@@ -375,6 +375,20 @@ namespace embree
     return nThreads;
   }
 
+  unsigned int getNumberOfNumaNodes()
+  {
+    ULONG highestNode = 0;
+    if (!GetNumaHighestNodeNumber(&highestNode)) return 1;
+    return highestNode+1;
+  }
+
+  unsigned int getNumaNode(size_t cpuID)
+  {
+    UCHAR node = 0;
+    if (cpuID > 255 || !GetNumaProcessorNode((UCHAR)cpuID,&node) || node == 0xFF) return 0;
+    return node;
+  }
+
   int getTerminalWidth() 
   {
     HANDLE handle = GetStdHandle(STD_OUTPUT_HANDLE);
@@ -407,6 +421,7 @@ namespace embree
 
 #include <stdio.h>
 #include <unistd.h>
+#include <fstream>
 
 namespace embree
 {
@@ -419,6 +434,54 @@ namespace embree
       return std::string();
     return std::string(buf);
   }
+
+  /* parses the NUMA node of each logical thread from the CPU lists of the nodes */
+  static std::vector<unsigned int> parseNumaTopology()
+  {
+    std::vector<unsigned int> cpuToNode;
+    for (unsigned int node=0;;node++)
+    {
+      std::fstream fs;
+      std::string cpulist = "/sys/devices/system/node/node" + toString(node) + "/cpulist";
+      fs.open (cpulist.c_str(), std::fstream::in);
+      if (fs.fail()) break;
+
+      /* the CPU list has the format 0-3,8,10-11 */
+      size_t first, last;
+      while (fs >> first)
+      {
+        last = first;
+        if (fs.peek() == '-') { fs.ignore(); fs >> last; }
+        if (cpuToNode.size() <= last) cpuToNode.resize(last+1,0);
+        for (size_t cpuID=first; cpuID<=last; cpuID++) cpuToNode[cpuID] = node;
+        if (fs.peek() == ',') fs.ignore();
+      }
+      fs.close();
+    }
+    return cpuToNode;
+  }
+
+  static const std::vector<unsigned int>& getNumaTopology()
+  {
+    static const std::vector<unsigned int> cpuToNode = parseNumaTopology();
+    return cpuToNode;
+  }
+
+  unsigned int getNumberOfNumaNodes()
+  {
+    const std::vector<unsigned int>& cpuToNode = getNumaTopology();
+    unsigned int numNodes = 1;
+    for (size_t i=0; i<cpuToNode.size(); i++)
+      numNodes = max(numNodes,cpuToNode[i]+1);
+    return numNodes;
+  }
+
+  unsigned int getNumaNode(size_t cpuID)
+  {
+    const std::vector<unsigned int>& cpuToNode = getNumaTopology();
+    if (cpuID >= cpuToNode.size()) return 0;
+    return cpuToNode[cpuID];
+  }
 }
 
 #endif
@@ -489,6 +552,16 @@ namespace embree
     return nThreads;
   }
 
+#if !defined(__LINUX__)
+  unsigned int getNumberOfNumaNodes() {
+    return 1;
+  }
+
+  unsigned int getNumaNode(size_t cpuID) {
+    return 0;
+  }
+#endif
+
   int getTerminalWidth() 
   {
     struct winsize info;
@@ -160,6 +160,12 @@ namespace embree
 
   /*! return the number of logical threads of the system */
   unsigned int getNumberOfLogicalThreads();
+
+  /*! returns the number of NUMA nodes of the system */
+  unsigned int getNumberOfNumaNodes();
+
+  /*! returns the NUMA node of some logical thread */
+  unsigned int getNumaNode(size_t cpuID);
   
   /*! returns the size of the terminal window in characters */
   int getTerminalWidth();
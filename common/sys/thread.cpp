@@ -92,6 +92,11 @@ namespace embree
     setAffinity(GetCurrentThread(), affinity);
   }
 
+  /*! returns the NUMA node the calling thread currently runs on */
+  unsigned int getThreadNumaNode() {
+    return getNumaNode(GetCurrentProcessorNumber());
+  }
+
   struct ThreadStartupData 
   {
   public:
@@ -172,10 +177,11 @@ namespace embree
 #include <fstream>
 #include <sstream>
 #include <algorithm>
+#include <sched.h>
 
 namespace embree
 {
-  /* changes thread ID mapping such that we first fill up all thread on one core */
+  /* changes thread ID mapping such that we first fill up all thread on one core and all cores of one NUMA node */
   size_t mapThreadID(size_t threadID)
   {
     static MutexSys mutex;
@@ -203,6 +209,10 @@ namespace embree
         fs.close();
       }
 
+      /* keep threads of the same NUMA node together */
+      if (getNumberOfNumaNodes() > 1)
+        std::stable_sort(threadIDs.begin(),threadIDs.end(),[] (size_t a, size_t b) { return getNumaNode(a) < getNumaNode(b); });
+
 #if 0
       for (size_t i=0;i<threadIDs.size();i++)
         std::cout << i << " -> " << threadIDs[i] << std::endl;
@@ -236,6 +246,14 @@ namespace embree
     if (pthread_setaffinity_np(pthread_self(), sizeof(cset), &cset) != 0)
       WARNING("pthread_setaffinity_np failed"); // on purpose only a warning
   }
+
+  /*! returns the NUMA node the calling thread currently runs on */
+  unsigned int getThreadNumaNode()
+  {
+    const int cpuID = sched_getcpu();
+    if (cpuID < 0) return 0;
+    return getNumaNode(cpuID);
+  }
 }
 #endif
 
@@ -259,6 +277,11 @@ namespace embree
     if (pthread_setaffinity_np(pthread_self(), sizeof(cset), &cset) != 0)
       WARNING("pthread_setaffinity_np failed"); // on purpose only a warning
   }
+
+  /*! NUMA topology is not queried on FreeBSD */
+  unsigned int getThreadNumaNode() {
+    return 0;
+  }
 }
 #endif
 
@@ -282,6 +305,11 @@ namespace embree
     if (thread_policy_set(mach_thread_self(),THREAD_AFFINITY_POLICY,(thread_policy_t)&ap,THREAD_AFFINITY_POLICY_COUNT) != KERN_SUCCESS)
       WARNING("setting thread affinity failed"); // on purpose only a warning
   }
+
+  /*! Mac OS X systems have a single NUMA node */
+  unsigned int getThreadNumaNode() {
+    return 0;
+  }
 }
 #endif
 
@@ -36,6 +36,9 @@ namespace embree
   /*! set affinity of the calling thread */
   void setAffinity(ssize_t affinity);
 
+  /*! returns the NUMA node the calling thread currently runs on */
+  unsigned int getThreadNumaNode();
+
   /*! the thread calling this function gets yielded */
   void yield();
 
@@ -22,6 +22,8 @@
 #  include "taskschedulertbb.h"
 #elif defined(TASKING_PPL)
 #  include "taskschedulerppl.h"
+#elif defined(TASKING_OPENMP)
+#  include "taskscheduleropenmp.h"
 #else
 #  error "no tasking system enabled"
 #endif
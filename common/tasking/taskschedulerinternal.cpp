@@ -22,6 +22,7 @@
 namespace embree
 {
   size_t TaskScheduler::g_numThreads = 0;
+  size_t TaskScheduler::g_spinCount = 32;
   __thread TaskScheduler* TaskScheduler::g_instance = nullptr;
   __thread TaskScheduler::Thread* TaskScheduler::thread_local_thread = nullptr;
   TaskScheduler::ThreadPool* TaskScheduler::threadPool = nullptr;
@@ -32,7 +33,7 @@ namespace embree
     while (true)
     {
       /*! some rounds that yield */
-      for (size_t i=0; i<32; i++)
+      for (size_t i=0; i<g_spinCount; i++)
       {
         /*! some spinning rounds */
         const size_t threadCount = thread.threadCount();
@@ -46,6 +47,27 @@ namespace embree
         }
         yield();
       }
+
+      /*! block until some thread spawns a task or changes the predicate,
+       *  the generation is read after announcing this thread as idle
+       *  such that no wakeup between the last check and the wait is lost */
+      TaskScheduler* scheduler = thread.scheduler.ptr;
+      scheduler->numIdleThreads++;
+      const size_t generation = scheduler->idleGeneration;
+      if (!pred()) {
+        scheduler->numIdleThreads--;
+        return;
+      }
+      if (scheduler->steal_from_other_threads(thread)) {
+        scheduler->numIdleThreads--;
+        body();
+        continue;
+      }
+      {
+        Lock<MutexSys> lock(scheduler->idleMutex);
+        scheduler->idleCondition.wait(scheduler->idleMutex, [&] () { return scheduler->idleGeneration != generation; });
+      }
+      scheduler->numIdleThreads--;
     }
   }
 
@@ -65,7 +87,7 @@ namespace embree
           thread.scheduler->cancellingException = std::current_exception();
       }
       thread.task = prevTask;
-      add_dependencies(-1);
+      finish_dependency(thread.scheduler.ptr);
     }
 
     /* steal until all dependencies have completed */
@@ -75,7 +97,7 @@ namespace embree
 
     /* now signal our parent task that we are finished */
     if (parent)
-      parent->add_dependencies(-1);
+      parent->finish_dependency(thread.scheduler.ptr);
   }
 
     /*! run this task */
@@ -223,18 +245,25 @@ namespace embree
       Ref<TaskScheduler> scheduler = NULL;
       ssize_t threadIndex = -1;
       {
+        /* join the first scheduler that did not reach its thread limit yet */
         Lock<MutexSys> lock(mutex);
-        condition.wait(mutex, [&] () { return globalThreadIndex >= numThreadsRunning || !schedulers.empty(); });
+        condition.wait(mutex, [&] () 
+        {
+          if (globalThreadIndex >= numThreadsRunning) return true;
+          for (auto& s : schedulers) {
+            threadIndex = s->tryAllocThreadIndex();
+            if (threadIndex >= 0) { scheduler = s; return true; }
+          }
+          return false;
+        });
         if (globalThreadIndex >= numThreadsRunning) break;
-        scheduler = schedulers.front();
-        threadIndex = scheduler->allocThreadIndex();
       }
       scheduler->thread_loop(threadIndex);
     }
   }
 
   TaskScheduler::TaskScheduler()
-    : threadCounter(0), anyTasksRunning(0), hasRootTask(false)
+    : threadCounter(0), maxThreads(0), anyTasksRunning(0), hasRootTask(false), numIdleThreads(0), idleGeneration(0)
   {
     threadLocal.resize(2*getNumberOfLogicalThreads()); // FIXME: this has to be 2x as in the compatibility join mode with rtcCommit the worker threads also join. When disallowing rtcCommit to join a build we can remove the 2x.
     for (size_t i=0; i<threadLocal.size(); i++)
@@ -273,8 +302,9 @@ namespace embree
     return g_instance;
   }
 
-  void TaskScheduler::create(size_t numThreads, bool set_affinity, bool start_threads)
+  void TaskScheduler::create(size_t numThreads, bool set_affinity, bool start_threads, size_t spin_count)
   {
+    g_spinCount = spin_count;
     if (!threadPool) threadPool = new TaskScheduler::ThreadPool(set_affinity);
     threadPool->setNumThreads(numThreads,start_threads);
   }
@@ -290,6 +320,16 @@ namespace embree
     return threadIndex;
   }
 
+  ssize_t TaskScheduler::tryAllocThreadIndex()
+  {
+    size_t threadIndex = threadCounter;
+    do {
+      if (maxThreads && threadIndex >= maxThreads) return -1;
+    } while (!threadCounter.compare_exchange_weak(threadIndex,threadIndex+1));
+    assert(threadIndex < threadLocal.size());
+    return threadIndex;
+  }
+
   void TaskScheduler::join()
   {
     mutex.lock();
@@ -345,7 +385,7 @@ namespace embree
                  [&] () {
                    anyTasksRunning++;
                    while (thread.tasks.execute_local_internal(thread,nullptr));
-                   anyTasksRunning--;
+                   if (--anyTasksRunning == 0) wakeIdleThreads();
                  });
     }
     threadLocal[threadIndex].store(nullptr);
@@ -78,6 +78,11 @@ namespace embree
 	dependencies+=n;
       }
 
+      /*! decrement dependency counter and wake up idle threads that may wait for this task */
+      void finish_dependency(TaskScheduler* scheduler) {
+	if (--dependencies == 0) scheduler->wakeIdleThreads();
+      }
+
       /*! initialize all tasks to DONE state by default */
       __forceinline Task()
 	: state(DONE) {}
@@ -148,6 +153,9 @@ namespace embree
 
 	/* also move left pointer */
 	if (left >= right-1) left = right-1;
+
+        /* idle threads may steal the new task */
+        thread.scheduler->wakeIdleThreads();
       }
 
       __dllexport bool execute_local(Thread& thread, Task* parent);
@@ -228,7 +236,7 @@ namespace embree
     ~TaskScheduler ();
 
     /*! initializes the task scheduler */
-    static void create(size_t numThreads, bool set_affinity, bool start_threads);
+    static void create(size_t numThreads, bool set_affinity, bool start_threads, size_t spin_count = 32);
 
     /*! destroys the task scheduler again */
     static void destroy();
@@ -240,6 +248,12 @@ namespace embree
     /*! let a worker thread allocate a thread index */
     __dllexport ssize_t allocThreadIndex();
 
+    /*! let a pool thread allocate a thread index, returns -1 if the thread limit is reached */
+    ssize_t tryAllocThreadIndex();
+
+    /*! limits the number of threads working on this scheduler including the root thread, 0 means unlimited */
+    void setMaxThreads(size_t N) { maxThreads = N; }
+
     /*! wait for some number of threads available (threadCount includes main thread) */
     void wait_for_threads(size_t threadCount);
 
@@ -252,6 +266,15 @@ namespace embree
     template<typename Predicate, typename Body>
       static void steal_loop(Thread& thread, const Predicate& pred, const Body& body);
 
+    /*! wakes up threads that blocked in the steal loop */
+    __forceinline void wakeIdleThreads()
+    {
+      if (likely(numIdleThreads == 0)) return;
+      Lock<MutexSys> lock(idleMutex);
+      idleGeneration++;
+      idleCondition.notify_all();
+    }
+
     /* spawn a new task at the top of the threads task stack */
     template<typename Closure>
       void spawn_root(const Closure& closure, size_t size = 1, bool useThreadPool = true)
@@ -275,7 +298,7 @@ namespace embree
       if (useThreadPool) addScheduler(this);
 
       while (thread.tasks.execute_local(thread,nullptr));
-      anyTasksRunning--;
+      if (--anyTasksRunning == 0) wakeIdleThreads();
       if (useThreadPool) removeScheduler(this);
 
       threadLocal[threadIndex] = nullptr;
@@ -361,14 +384,22 @@ namespace embree
   private:
     std::vector<atomic<Thread*>> threadLocal;
     std::atomic<size_t> threadCounter;
+    size_t maxThreads;
     std::atomic<size_t> anyTasksRunning;
     std::atomic<bool> hasRootTask;
     std::exception_ptr cancellingException;
     MutexSys mutex;
     ConditionSys condition;
 
+    /* idle threads block here after spinning for g_spinCount rounds */
+    std::atomic<size_t> numIdleThreads;
+    std::atomic<size_t> idleGeneration;
+    MutexSys idleMutex;
+    ConditionSys idleCondition;
+
   private:
     static size_t g_numThreads;
+    static size_t g_spinCount;
     static __thread TaskScheduler* g_instance;
     static __thread Thread* thread_local_thread;
     static ThreadPool* threadPool;
@@ -0,0 +1,53 @@
+// ======================================================================== //
+// Copyright 2009-2017 Intel Corporation                                    //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ======================================================================== //
+
+#include "taskscheduleropenmp.h"
+
+namespace embree
+{
+  __thread TaskScheduler::Context* TaskScheduler::g_context = nullptr;
+  size_t TaskScheduler::g_numThreads = 1;
+
+  void TaskScheduler::Context::cancel(const std::exception_ptr& except)
+  {
+    Lock<MutexSys> lock(mutex);
+    if (exception == nullptr) exception = except;
+    cancelled = true;
+  }
+
+  void TaskScheduler::create(size_t numThreads, bool set_affinity, bool start_threads, size_t spin_count)
+  {
+    assert(numThreads);
+
+    /* we do not touch the global OpenMP settings of the application, but only size our own parallel regions */
+    if (numThreads == std::numeric_limits<size_t>::max())
+      numThreads = omp_get_max_threads();
+    g_numThreads = max(numThreads,size_t(1));
+
+    /* set affinity and start worker threads */
+    if (set_affinity || start_threads)
+    {
+#pragma omp parallel num_threads((int)g_numThreads)
+      {
+        if (set_affinity)
+          setAffinity(omp_get_thread_num());
+      }
+    }
+  }
+
+  void TaskScheduler::destroy() {
+  }
+}
@@ -0,0 +1,178 @@
+// ======================================================================== //
+// Copyright 2009-2017 Intel Corporation                                    //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ======================================================================== //
+
+#pragma once
+
+#include "../sys/platform.h"
+#include "../sys/alloc.h"
+#include "../sys/barrier.h"
+#include "../sys/thread.h"
+#include "../sys/mutex.h"
+#include "../sys/condition.h"
+#include "../sys/ref.h"
+#include "../math/range.h"
+
+#if !defined(_OPENMP)
+#error OpenMP tasking system requires compiling with OpenMP enabled
+#endif
+
+#include <omp.h>
+#include <exception>
+
+namespace embree
+{
+  struct TaskScheduler
+  {
+    /*! state shared by all tasks spawned below one spawn_root call */
+    struct Context
+    {
+      __forceinline Context ()
+        : cancelled(false), exception(nullptr) {}
+
+      /*! records the first exception thrown by some task and cancels all remaining tasks */
+      void cancel(const std::exception_ptr& except);
+
+    public:
+      volatile bool cancelled;    //!< set when some task threw an exception
+      MutexSys mutex;             //!< protects the exception
+      std::exception_ptr exception; //!< first exception thrown by some task
+    };
+
+    /*! initializes the task scheduler */
+    static void create(size_t numThreads, bool set_affinity, bool start_threads, size_t spin_count = 32);
+
+    /*! destroys the task scheduler again */
+    static void destroy();
+
+    /* returns the ID of the current thread */
+    static __forceinline size_t threadID() {
+      return threadIndex();
+    }
+
+    /* returns the index (0..threadCount-1) of the current thread */
+    static __forceinline size_t threadIndex() {
+      return omp_get_thread_num();
+    }
+
+    /* returns the total number of threads */
+    static __forceinline size_t threadCount() {
+      return g_numThreads;
+    }
+
+    /* executes the closure inside an OpenMP parallel region of at most maxThreads threads (0 = all) and waits for all spawned tasks */
+    template<typename Closure>
+    static void spawn_root(const Closure& closure, size_t maxThreads = 0)
+    {
+      Context* prev = g_context;
+
+      /* we are already inside some parallel region, e.g. of the
+       * application, thus the tasks get spawned into its team instead of
+       * opening a nested region, idle threads of the team pick them up */
+      if (omp_in_parallel())
+      {
+        Context context;
+        g_context = &context;
+        run(&context,closure);
+#pragma omp taskwait
+        g_context = prev;
+        if (context.exception != nullptr)
+          std::rethrow_exception(context.exception);
+        return;
+      }
+
+      Context context;
+      const size_t numThreads = maxThreads ? min(maxThreads,g_numThreads) : g_numThreads;
+#pragma omp parallel num_threads((int)numThreads)
+      {
+#pragma omp single
+        {
+          g_context = &context;
+          run(&context,closure);
+          g_context = prev;
+        }
+      }
+      if (context.exception != nullptr)
+        std::rethrow_exception(context.exception);
+    }
+
+    /* spawn a new task, a root task is created when called outside of any task */
+    template<typename Closure>
+    static __forceinline void spawn(const Closure& closure)
+    {
+      Context* context = g_context;
+      if (context == nullptr) {
+        spawn_root(closure);
+        return;
+      }
+      if (context->cancelled) {
+        run(context,closure);
+        return;
+      }
+
+      Closure task = closure;
+#pragma omp task firstprivate(task,context)
+      {
+        Context* prev = g_context;
+        g_context = context;
+        run(context,task);
+        g_context = prev;
+      }
+    }
+
+    /* spawn a new task set  */
+    template<typename Index, typename Closure>
+    static void spawn(const Index begin, const Index end, const Index blockSize, const Closure& closure)
+    {
+      spawn([=,&closure]()
+        {
+	  if (end-begin <= blockSize) {
+	    return closure(range<Index>(begin,end));
+	  }
+	  const Index center = (begin+end)/2;
+	  spawn(begin,center,blockSize,closure);
+	  spawn(center,end  ,blockSize,closure);
+	  wait();
+	});
+    }
+
+    /* work on spawned subtasks and wait until all have finished */
+    static __forceinline bool wait()
+    {
+      Context* context = g_context;
+      if (context == nullptr) return true;
+#pragma omp taskwait
+      return !context->cancelled;
+    }
+
+  private:
+
+    /* executes a closure unless the context got cancelled, exceptions cancel the context */
+    template<typename Closure>
+    static __forceinline void run(Context* context, const Closure& closure)
+    {
+      if (context->cancelled) return;
+      try {
+        closure();
+      } catch (...) {
+        context->cancel(std::current_exception());
+      }
+    }
+
+  private:
+    static __thread Context* g_context; //!< context of the task the current thread executes
+    static size_t g_numThreads;         //!< number of threads of each parallel region
+  };
+};
@@ -35,7 +35,7 @@ namespace embree
   struct TaskScheduler
   {
     /*! initializes the task scheduler */
-    static void create(size_t numThreads, bool set_affinity, bool start_threads);
+    static void create(size_t numThreads, bool set_affinity, bool start_threads, size_t spin_count = 32);
 
     /*! destroys the task scheduler again */
     static void destroy();
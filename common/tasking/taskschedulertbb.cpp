@@ -31,7 +31,7 @@ namespace embree
     
   } tbb_affinity;
   
-  void TaskScheduler::create(size_t numThreads, bool set_affinity, bool start_threads)
+  void TaskScheduler::create(size_t numThreads, bool set_affinity, bool start_threads, size_t spin_count)
   {
     assert(numThreads);
 
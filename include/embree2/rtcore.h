@@ -139,7 +139,8 @@ enum RTCParameter {
                                                 instance). The size is specified as an
                                                 integer number of bytes. The software
                                                 cache cannot be configured during
-                                                rendering. (write only) */
+                                                rendering. Reading returns the current
+                                                size of the cache. (read/write) */
 
   RTC_CONFIG_INTERSECT1 = 1,                  //!< checks if rtcIntersect1 is supported (read only)
   RTC_CONFIG_INTERSECT4 = 2,                  //!< checks if rtcIntersect4 is supported (read only)
@@ -152,7 +153,7 @@ enum RTCParameter {
   RTC_CONFIG_INTERSECTION_FILTER = 8,         //!< checks if intersection filters are enabled (read only)
   RTC_CONFIG_INTERSECTION_FILTER_RESTORE = 9, //!< checks if intersection filters restores previous hit (read only)
   RTC_CONFIG_IGNORE_INVALID_RAYS = 11,        //!< checks if invalid rays are ignored (read only)
-  RTC_CONFIG_TASKING_SYSTEM = 12,             //!< return used tasking system (0 = INTERNAL, 1 = TBB, 2 = PPL) (read only)
+  RTC_CONFIG_TASKING_SYSTEM = 12,             //!< return used tasking system (0 = INTERNAL, 1 = TBB, 2 = PPL, 3 = OPENMP) (read only)
 
   RTC_CONFIG_VERSION_MAJOR = 13,             //!< returns Embree major version (read only)
   RTC_CONFIG_VERSION_MINOR = 14,             //!< returns Embree minor version (read only)
@@ -168,6 +169,24 @@ enum RTCParameter {
 
   RTC_CONFIG_COMMIT_JOIN = 23,               //!< checks if rtcCommitJoin can be used to join build operation (not supported when compiled with some older TBB versions)
   RTC_CONFIG_COMMIT_THREAD = 24,             //!< checks if rtcCommitThread is available (not supported when compiled with some older TBB versions)
+
+  RTC_CONFIG_POINT_GEOMETRY = 25,            //!< checks if point geometries are supported
+
+  RTC_SOFTWARE_CACHE_MAX_SIZE = 26,          /*! Maximal size in bytes the software cache
+                                               may grow to. A non-zero value enables
+                                               adaptive sizing of the cache between
+                                               RTC_SOFTWARE_CACHE_SIZE and this size
+                                               when scenes with subdivision geometry
+                                               get committed. (read/write) */
+  RTC_SOFTWARE_CACHE_HITS = 27,              //!< number of software cache lookups that found a valid entry (read, write 0 to reset)
+  RTC_SOFTWARE_CACHE_MISSES = 28,            //!< number of software cache lookups that had to build the entry (read, write 0 to reset)
+  RTC_SOFTWARE_CACHE_FLUSHES = 29,           //!< number of software cache segments recycled to make space for new entries (read, write 0 to reset)
+
+  /* The software cache is shared by all devices, thus the
+     RTC_SOFTWARE_CACHE_HITS, RTC_SOFTWARE_CACHE_MISSES, and
+     RTC_SOFTWARE_CACHE_FLUSHES counters of a device include the lookups
+     and flushes caused by ray queries of all other devices since the
+     counter got reset through this device. */
 };
 
 /*! \brief Configures some parameters. 
@@ -31,6 +31,7 @@ enum RTCBuildQuality
   RTC_BUILD_QUALITY_LOW = 0,     //!< build low quality BVH (good for dynamic scenes)
   RTC_BUILD_QUALITY_NORMAL = 1,  //!< build standard quality BVH
   RTC_BUILD_QUALITY_HIGH = 2,    //!< build high quality BVH
+  RTC_BUILD_QUALITY_MEDIUM = 3,  //!< build medium quality BVH (between low and normal quality)
 };
 
 /*! Settings for builders */
@@ -95,6 +96,9 @@ typedef void  (*RTCSplitPrimitiveFunc) (const RTCBuildPrimitive& prim, unsigned
 /*! Callback to provide build progress. */
 typedef void (*RTCBuildProgressFunc) (size_t dn, void* userPtr);
 
+/*! Callback to calculate the bounds of a leaf when refitting. */
+typedef void  (*RTCLeafBoundsFunc) (void* leafPtr, RTCBounds& bounds, void* userPtr);
+
 /*! builds the BVH */
 RTCORE_API void* rtcBuildBVH(RTCBVH bvh,                                     //!< BVH to build
                              const RTCBuildSettings& settings,               //!< settings for BVH builder
@@ -109,6 +113,16 @@ RTCORE_API void* rtcBuildBVH(RTCBVH bvh,                                     //!
                              void* userPtr                                   //!< user pointer passed to callback functions
   ); 
 
+/*! Refits the BVH last built with rtcBuildBVH. The topology of the
+ *  BVH is kept and the bounds of all nodes get updated bottom up from
+ *  the leaf bounds. Returns the root of the BVH. */
+RTCORE_API void* rtcRefitBVH(RTCBVH bvh,                                     //!< BVH to refit
+                             RTCLeafBoundsFunc leafBounds,                   //!< calculates the bounds of a leaf
+                             RTCSetNodeBoundsFunc setNodeBounds,             //!< sets bounds of all children
+                             RTCBounds* bounds,                              //!< optionally returns the bounds of the root
+                             void* userPtr                                   //!< user pointer passed to callback functions
+  );
+
 /*! Allocates memory using the thread local allocator. Use this function to allocate nodes in the callback functions. */
 RTCORE_API void* rtcThreadLocalAlloc(RTCThreadLocalAllocator allocator, size_t bytes, size_t align);
 
@@ -57,6 +57,22 @@ enum RTCBufferType
   RTC_VERTEX_CREASE_WEIGHT_BUFFER = 0x08000000,
 
   RTC_HOLE_BUFFER          = 0x09000001,
+
+  RTC_NORMAL_BUFFER        = 0x0A000000,
+  RTC_NORMAL_BUFFER0       = 0x0A000000,
+  RTC_NORMAL_BUFFER1       = 0x0A000001,
+};
+
+/*! \brief Supported data formats of vertex and index buffers of
+ *  triangle and quad meshes. */
+enum RTCFormat
+{
+  RTC_FORMAT_FLOAT3        = 0,     //!< 3 floats per vertex (default for vertex buffers)
+  RTC_FORMAT_HALF3         = 1,     //!< 3 half precision floats per vertex
+  RTC_FORMAT_QUANTIZED16x3 = 2,     //!< 3 16 bit unsigned integers per vertex, quantized relative to the quantization bounds of the geometry
+
+  RTC_FORMAT_UINT          = 0x100, //!< 32 bit unsigned integer indices (default for index buffers)
+  RTC_FORMAT_USHORT        = 0x101, //!< 16 bit unsigned integer indices
 };
 
 /*! \brief Supported types of matrix layout for functions involving matrices */
@@ -66,6 +82,21 @@ enum RTCMatrixType {
   RTC_MATRIX_COLUMN_MAJOR_ALIGNED16 = 2,
 };
 
+/*! \brief Decomposition of an instance transformation into a
+  scale/skew/shift transformation S, a rotation R given as a
+  quaternion, and a translation T. A point p gets transformed to
+  T + R*(S*p), with S*p = (scale_x*p.x + skew_xy*p.y + skew_xz*p.z +
+  shift_x, scale_y*p.y + skew_yz*p.z + shift_y, scale_z*p.z +
+  shift_z). The shift can be used to move the rotation center. */
+struct RTCQuaternionDecomposition
+{
+  float scale_x, scale_y, scale_z;   //!< scaling along the axes
+  float skew_xy, skew_xz, skew_yz;   //!< skew of the axes
+  float shift_x, shift_y, shift_z;   //!< shift before the rotation
+  float quaternion_r, quaternion_i, quaternion_j, quaternion_k; //!< rotation quaternion, gets normalized
+  float translation_x, translation_y, translation_z; //!< translation after the rotation
+};
+
 /*! \brief Supported geometry flags to specify handling in dynamic scenes. */
 enum RTCGeometryFlags 
 {
@@ -222,6 +253,19 @@ RTCORE_API void rtcSetTransform2 (RTCScene scene,                         //!< s
                                   size_t timeStep = 0                     //!< timestep to set the matrix for 
   );
 
+/*! \brief Sets the transformation of the instance for the specified
+  timestep as scale/skew/shift, rotation, and translation. If all
+  timesteps of a motion blurred instance are specified this way, the
+  components are interpolated separately between the timesteps, with
+  spherical linear interpolation of the rotation, which correctly
+  handles rotating objects. Otherwise the transformation matrices are
+  linearly interpolated. */
+RTCORE_API void rtcSetTransformQuaternion (RTCScene scene,                   //!< scene handle
+                                           unsigned int geomID,              //!< ID of geometry 
+                                           const RTCQuaternionDecomposition* qd, //!< decomposed transformation
+                                           size_t timeStep = 0               //!< timestep to set the transformation for 
+  );
+
 /*! \brief Creates a new triangle mesh. The number of triangles
   (numTriangles), number of vertices (numVertices), and number of time
   steps (1 for normal meshes, and up to RTC_MAX_TIME_STEPS for multi
@@ -579,6 +623,33 @@ RTCORE_API unsigned rtcNewLineSegments2(RTCScene scene,                    //!<
                                         unsigned int geomID = -1           //!< optional geometry ID to assign
   );
 
+/*! \brief Creates a new point geometry, consisting of multiple points
+  with varying radii. The number of points (numPoints) and number of
+  time steps have to get specified at construction time (1 for normal
+  meshes, and up to RTC_MAX_TIME_STEPS for multi-segment motion
+  blur). Further, the vertex buffer (RTC_VERTEX_BUFFER) has to get set
+  by mapping and writing to the appropiate buffers. In case of
+  multi-segment motion blur, multiple vertex buffers have to get
+  filled (RTC_VERTEX_BUFFER0, RTC_VERTEX_BUFFER1, etc.), one for each
+  time step. Each point consists of a single precision (x,y,z)
+  position and radius, stored in that order in memory. Points are
+  rendered as spheres, unless a normal buffer (RTC_NORMAL_BUFFER) is
+  set, which turns them into discs oriented along the normal. The
+  normal buffer stores a single precision (x,y,z) normal per point
+  and time step. Point geometries cannot get instanced. */
+RTCORE_API unsigned rtcNewPoints (RTCScene scene,                    //!< the scene the points belong to
+                                  RTCGeometryFlags flags,            //!< geometry flags
+                                  size_t numPoints,                  //!< number of points
+                                  size_t numTimeSteps = 1            //!< number of motion blur time steps
+  );
+
+RTCORE_API unsigned rtcNewPoints2(RTCScene scene,                    //!< the scene the points belong to
+                                  RTCGeometryFlags flags,            //!< geometry flags
+                                  size_t numPoints,                  //!< number of points
+                                  size_t numTimeSteps = 1,           //!< number of motion blur time steps
+                                  unsigned int geomID = -1           //!< optional geometry ID to assign
+  );
+
 /*! Sets a uniform tessellation rate for subdiv meshes and hair
  *  geometry. For subdivision meshes the RTC_LEVEL_BUFFER can also be used
  *  optionally to set a different tessellation rate per edge.*/
@@ -642,6 +713,20 @@ RTCORE_API void rtcSetBuffer(RTCScene scene, unsigned geomID, RTCBufferType type
 RTCORE_API void rtcSetBuffer2(RTCScene scene, unsigned geomID, RTCBufferType type, 
                               const void* ptr, size_t byteOffset, size_t byteStride, size_t size = -1);
 
+/*! \brief Sets the data format of the vertex or index buffers of a
+ *  triangle or quad mesh. The vertex format applies to the vertex
+ *  buffers of all time steps. Compressed formats have to be set
+ *  before the buffer gets shared using rtcSetBuffer2, and require
+ *  the addresses ptr+offset+i*stride to be aligned to 2 bytes only
+ *  and no padding. Interpolating compressed vertex buffers using
+ *  rtcInterpolate returns at most 3 floats. */
+RTCORE_API void rtcSetBufferFormat(RTCScene scene, unsigned geomID, RTCBufferType type, RTCFormat format);
+
+/*! \brief Sets the bounds relative to which the vertices of the
+ *  RTC_FORMAT_QUANTIZED16x3 format are quantized. A quantized
+ *  coordinate q decodes to lower+q/65535*(upper-lower). */
+RTCORE_API void rtcSetQuantizationBounds(RTCScene scene, unsigned geomID, const RTCBounds& bounds);
+
 /*! \brief Enable geometry. Enabled geometry can be hit by a ray. */
 RTCORE_API void rtcEnable (RTCScene scene, unsigned geomID);
 
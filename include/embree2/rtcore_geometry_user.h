@@ -114,6 +114,12 @@ typedef void (*RTCOccludedFuncN) (const int* valid,                      /*! poi
                                   size_t N,                              /*!< number of rays in packet */
                                   size_t item                            /*!< item to test for occlusion */);
 
+/*! Type of closest point function pointer. */
+typedef void (*RTCPointQueryFunc) (void* ptr,                    /*!< pointer to geometry user data */
+                                   const RTCPointQuery& query,   /*!< point query to calculate the closest point for */
+                                   size_t item,                  /*!< item to calculate the closest point for */
+                                   float closest_o[3]            /*!< returns closest point of the item to the query position */);
+
 /*! Creates a new user geometry object. This feature makes it possible
  *  to add arbitrary types of geometry to the scene by providing
  *  appropiate bounding, intersect and occluded functions. A user
@@ -225,6 +231,11 @@ RTCORE_API void rtcSetOccludedFunction1Mp (RTCScene scene, unsigned geomID, RTCO
  *  geometry. */
 RTCORE_API void rtcSetOccludedFunctionN (RTCScene scene, unsigned geomID, RTCOccludedFuncN occluded);
 
+/*! Set closest point function. The rtcPointQuery function will call
+ *  the passed function for items of the user geometry that overlap
+ *  the current query sphere. */
+RTCORE_API void rtcSetPointQueryFunction (RTCScene scene, unsigned geomID, RTCPointQueryFunc pointQuery);
+
 
 /*! @} */
 
@@ -27,6 +27,9 @@ struct RTCRay8;
 struct RTCRay16;
 struct RTCRayNp;
 
+/*! maximal number of nested instancing levels */
+#define RTC_MAX_INSTANCE_LEVEL_COUNT 8
+
 /*! scene flags */
 enum RTCSceneFlags 
 {
@@ -59,7 +62,11 @@ enum RTCAlgorithmFlags
 enum RTCIntersectFlags
 {
   RTC_INTERSECT_COHERENT                 = 0,  //!< optimize for coherent rays
-  RTC_INTERSECT_INCOHERENT               = 1   //!< optimize for incoherent rays
+  RTC_INTERSECT_INCOHERENT               = 1,  //!< optimize for incoherent rays
+  RTC_INTERSECT_MULTI_HIT                = 2,  //!< collect the closest hits of each ray into the buffers of an RTCMultiHitContext
+  RTC_INTERSECT_SORT_RAYS                = 4,  //!< reorder large incoherent ray streams into coherent packets before traversal
+  RTC_INTERSECT_TRAVERSAL_STATS          = 8,  //!< accumulate traversal statistics into the buffer of an RTCTraversalStatsContext
+  RTC_INTERSECT_INSTANCE_STACK           = 16  //!< store the instance IDs of all instancing levels into the buffer of an RTCInstanceStackContext
 };
 
 /*! intersection context passed to intersect/occluded calls */
@@ -69,6 +76,94 @@ struct RTCIntersectContext
   void* userRayExt;          //!< can be used to pass extended ray data to callbacks
 };
 
+/*! hit record stored in multi-hit buffers */
+struct RTCHitRecord
+{
+  float tfar;        //!< distance of the hit
+  float u;           //!< barycentric u coordinate of hit
+  float v;           //!< barycentric v coordinate of hit
+  float Ng[3];       //!< unnormalized geometry normal
+  unsigned geomID;   //!< geometry ID
+  unsigned primID;   //!< primitive ID
+  unsigned instID;   //!< instance ID
+};
+
+/*! Intersection context for multi-hit queries. If the
+ *  RTC_INTERSECT_MULTI_HIT flag is set, the intersect functions store
+ *  the up to maxHits closest hits of ray i sorted by distance into
+ *  hits[i*maxHits], ..., hits[i*maxHits+maxHits-1] and count them in
+ *  numHits[i], which has to be initialized to 0 by the application. The
+ *  ray index i is the packet lane for packet queries, and the index
+ *  into the stream for rtcIntersect1M and rtcIntersect1Mp. Once the
+ *  buffer of a ray is full, the ray's tfar is shrunk to the distance of
+ *  the last hit, the remaining hit fields of the ray are not modified. */
+struct RTCMultiHitContext
+{
+  RTCIntersectContext context; //!< base context, flags have to contain RTC_INTERSECT_MULTI_HIT
+  unsigned maxHits;            //!< capacity of the hit buffer of each ray
+  unsigned* numHits;           //!< number of hits found for each ray
+  RTCHitRecord* hits;          //!< hit buffers of all rays
+};
+
+/*! Traversal statistics of a scene or of ray queries. Packet
+ *  traversal counts each node and leaf once per packet. */
+struct RTCTraversalStats
+{
+  size_t rays;        //!< number of traced rays
+  size_t nodes;       //!< number of traversed inner nodes
+  size_t leaves;      //!< number of traversed leaves
+  size_t primitives;  //!< number of primitive intersection tests, each testing a block of primitives
+  size_t filterCalls; //!< number of invoked intersection and occlusion filter functions
+  size_t earlyExits;  //!< number of occlusion tests terminated by a hit
+};
+
+/*! Intersection context for ray queries with traversal statistics. If
+ *  the RTC_INTERSECT_TRAVERSAL_STATS flag is set, the intersect and
+ *  occluded functions add the statistics of their traversal to the
+ *  stats structure. The statistics get added atomically, thus a
+ *  context can get shared by multiple threads. The flag cannot get
+ *  combined with RTC_INTERSECT_MULTI_HIT. To gather statistics of
+ *  nested instancing queries, set the flag in the context of an
+ *  RTCInstanceStackContext and pass the statistics in its stats
+ *  member. */
+struct RTCTraversalStatsContext
+{
+  RTCIntersectContext context; //!< base context, flags have to contain RTC_INTERSECT_TRAVERSAL_STATS
+  RTCTraversalStats* stats;    //!< statistics of all ray queries using this context
+};
+
+/*! Intersection context for ray queries of scenes with nested
+ *  instances. If the RTC_INTERSECT_INSTANCE_STACK flag is set, the
+ *  intersect functions store the IDs of all instances on the path
+ *  from the top level scene to the hit geometry into the instIDs
+ *  buffer, which holds RTC_MAX_INSTANCE_LEVEL_COUNT IDs for each ray
+ *  of the query (indexed by the packet lane or stream index). The
+ *  path is terminated by RTC_INVALID_GEOMETRY_ID if shorter than
+ *  RTC_MAX_INSTANCE_LEVEL_COUNT. Like the instID member of the ray,
+ *  the first ID of each ray has to get initialized to
+ *  RTC_INVALID_GEOMETRY_ID, and the buffer stays unmodified if no
+ *  instanced geometry got hit. The instID member of the ray contains
+ *  the ID of the innermost instance. The flag cannot get combined
+ *  with RTC_INTERSECT_MULTI_HIT. If RTC_INTERSECT_TRAVERSAL_STATS is
+ *  set too, the traversal statistics get added to stats. */
+struct RTCInstanceStackContext
+{
+  RTCIntersectContext context; //!< base context, flags have to contain RTC_INTERSECT_INSTANCE_STACK
+  unsigned* instIDs;           //!< RTC_MAX_INSTANCE_LEVEL_COUNT instance IDs for each ray
+  unsigned instLevel;          //!< instancing level of the traversal, has to get initialized to 0
+  RTCTraversalStats* stats;    //!< statistics of all ray queries using this context, only used with RTC_INTERSECT_TRAVERSAL_STATS
+};
+
+/*! closest point query structure passed to rtcPointQuery */
+struct RTCORE_ALIGN(16) RTCPointQuery
+{
+  float p[3];        //!< query position
+  float radius;      //!< search radius (set to distance of closest point found)
+  float closest[3];  //!< closest point found on the surface
+  unsigned geomID;   //!< geometry ID of closest primitive
+  unsigned primID;   //!< primitive ID of closest primitive
+};
+
 /*! \brief Defines an opaque scene type */
 typedef struct __RTCScene {}* RTCScene;
 
@@ -92,6 +187,36 @@ RTCORE_API void rtcSetProgressMonitorFunction(RTCScene scene, RTCProgressMonitor
  *  rays. */
 RTCORE_API void rtcCommit (RTCScene scene);
 
+/*! Starts committing the geometry of the scene in a separate thread
+ *  and returns immediately. The hierarchy build runs on the tasking
+ *  system of the device like for rtcCommit. The build goes into a
+ *  second set of acceleration structures, thus ray queries can
+ *  continue on the previously committed scene until the new
+ *  acceleration structures get published atomically at the end of the
+ *  build. The scene must not be modified until rtcCommitWait returned
+ *  or rtcCommitPoll returned true, and this function must not get
+ *  called concurrently with ray queries of the scene. Errors of the
+ *  build get reported by rtcCommitWait or rtcCommitPoll. */
+RTCORE_API void rtcCommitAsync (RTCScene scene);
+
+/*! Returns true if no asynchronous commit of the scene is in progress
+ *  anymore, i.e. if the scene can be used again. */
+RTCORE_API bool rtcCommitPoll (RTCScene scene);
+
+/*! Waits until the asynchronous commit of the scene finished. */
+RTCORE_API void rtcCommitWait (RTCScene scene);
+
+/*! Limits the number of threads that build the scene, including the
+ *  thread that commits the scene. A background rebuild can thus use
+ *  some cores only, with predictable impact on concurrent ray queries
+ *  of other threads. The internal tasking system lets at most
+ *  numThreads-1 worker threads join the build, TBB builds the scene
+ *  inside an isolated task arena of that concurrency. Passing 0 lifts
+ *  the limit again, which is the default. Tasking systems that cannot
+ *  limit the number of threads (TBB without task arenas, PPL) report
+ *  RTC_INVALID_OPERATION for a non-zero limit. */
+RTCORE_API void rtcSetBuildThreadCount (RTCScene scene, unsigned int numThreads);
+
 /*! Commits the geometry of the scene in join mode. When Embree is
  *  using TBB (default), threads that call `rtcCommitJoin` will
  *  participate in the hierarchy build procedure. When Embree is using
@@ -112,6 +237,18 @@ RTCORE_API void rtcCommitJoin (RTCScene scene);
  *  coprocessor. */
 RTCORE_API void rtcCommitThread(RTCScene scene, unsigned int threadID, unsigned int numThreads);
 
+/*! Stores the acceleration structures of the scene into a file. The
+ *  scene has to get committed previously to this function. Scenes
+ *  containing subdivision meshes cannot get stored. */
+RTCORE_API void rtcSaveScene(RTCScene scene, const char* fileName);
+
+/*! Commits the scene using the acceleration structures stored in a
+ *  file by rtcSaveScene. The scene has to be created with the same
+ *  flags and has to contain the same geometries and buffer contents
+ *  as the scene that got stored. The file is mapped into memory, thus
+ *  primitive data is not read from disk before it is traversed. */
+RTCORE_API void rtcLoadScene(RTCScene scene, const char* fileName);
+
 /*! Returns AABB of the scene. rtcCommit has to get called
  *  previously to this function. */
 RTCORE_API void rtcGetBounds(RTCScene scene, RTCBounds& bounds_o);
@@ -268,6 +405,30 @@ RTCORE_API void rtcOccludedNM (RTCScene scene, const RTCIntersectContext* contex
  *  of the ray packet. */
 RTCORE_API void rtcOccludedNp (RTCScene scene, const RTCIntersectContext* context, const RTCRayNp& rays, const size_t N);
 
+/*! Finds the closest point on the surface of the scene to the query
+ *  position that lies within the query radius. If such a point is
+ *  found, the closest point, its distance (stored as new radius), and
+ *  the geometry and primitive ID of the closest primitive are written
+ *  to the query structure, otherwise the query stays unmodified. The
+ *  geomID member should get initialized to RTC_INVALID_GEOMETRY_ID to
+ *  detect failed queries. Motion blurred geometries are not
+ *  supported, user geometries participate through the function set
+ *  by rtcSetPointQueryFunction. rtcCommit has to get called
+ *  previously to this function. */
+RTCORE_API void rtcPointQuery (RTCScene scene, RTCPointQuery& query);
+
+/*! Enables or disables gathering of traversal statistics for all ray
+ *  queries of the scene. Statistics are disabled by default, and
+ *  traversal of instanced scenes is attributed to the instanced
+ *  scene. */
+RTCORE_API void rtcEnableTraversalStats (RTCScene scene, bool enable);
+
+/*! Returns the traversal statistics gathered for the scene. */
+RTCORE_API void rtcGetTraversalStats (RTCScene scene, RTCTraversalStats* stats);
+
+/*! Resets the traversal statistics of the scene to zero. */
+RTCORE_API void rtcResetTraversalStats (RTCScene scene);
+
 /*! Deletes the scene. All contained geometry get also destroyed. */
 RTCORE_API void rtcDeleteScene (RTCScene scene);
 
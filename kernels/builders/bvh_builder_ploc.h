@@ -0,0 +1,491 @@
+// ======================================================================== //
+// Copyright 2009-2017 Intel Corporation                                    //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ======================================================================== //
+
+#pragma once
+
+#include "bvh_builder_morton.h"
+
+namespace embree
+{
+  namespace isa
+  {
+    /*! Parallel locally-ordered clustering (PLOC) builder. The
+     *  primitives are sorted by morton code, then each cluster is
+     *  merged with its nearest neighbor within a small window of the
+     *  sorted cluster array whenever both agree on each other. This
+     *  agglomerative clustering produces a binary tree of near SAH
+     *  quality, which is finally collapsed into a tree of the
+     *  requested branching factor. */
+    struct BVHBuilderPLOC
+    {
+      static const size_t MAX_BRANCHING_FACTOR = 8;          //!< maximal supported BVH branching factor
+      static const size_t MIN_LARGE_LEAF_LEVELS = 8;         //!< create balanced tree of we are that many levels before the maximal tree depth
+      static const size_t BLOCK_SIZE = 1024;                 //!< number of clusters processed per task
+
+      typedef BVHBuilderMorton::BuildPrim BuildPrim;
+
+      /*! settings for PLOC builder */
+      struct Settings
+      {
+        /*! default settings */
+        Settings ()
+        : branchingFactor(2), maxDepth(32), logBlockSize(0), minLeafSize(1), maxLeafSize(8),
+          travCost(1.0f), intCost(1.0f), searchRadius(16), singleThreadThreshold(1024) {}
+
+        /*! initialize settings from API settings */
+        Settings (const RTCBuildSettings& settings)
+        : branchingFactor(2), maxDepth(32), logBlockSize(0), minLeafSize(1), maxLeafSize(8),
+          travCost(1.0f), intCost(1.0f), searchRadius(16), singleThreadThreshold(1024)
+        {
+          if (RTC_BUILD_SETTINGS_HAS(settings,maxBranchingFactor)) branchingFactor = settings.maxBranchingFactor;
+          if (RTC_BUILD_SETTINGS_HAS(settings,maxDepth          )) maxDepth        = settings.maxDepth;
+          if (RTC_BUILD_SETTINGS_HAS(settings,sahBlockSize      )) logBlockSize    = __bsr(settings.sahBlockSize);
+          if (RTC_BUILD_SETTINGS_HAS(settings,minLeafSize       )) minLeafSize     = settings.minLeafSize;
+          if (RTC_BUILD_SETTINGS_HAS(settings,maxLeafSize       )) maxLeafSize     = settings.maxLeafSize;
+          if (RTC_BUILD_SETTINGS_HAS(settings,travCost          )) travCost        = settings.travCost;
+          if (RTC_BUILD_SETTINGS_HAS(settings,intCost           )) intCost         = settings.intCost;
+        }
+
+        Settings (size_t branchingFactor, size_t maxDepth, size_t sahBlockSize, size_t minLeafSize, size_t maxLeafSize, float travCost, float intCost, size_t singleThreadThreshold)
+        : branchingFactor(branchingFactor), maxDepth(maxDepth), logBlockSize(__bsr(sahBlockSize)), minLeafSize(minLeafSize), maxLeafSize(maxLeafSize),
+          travCost(travCost), intCost(intCost), searchRadius(16), singleThreadThreshold(singleThreadThreshold) {}
+
+      public:
+        size_t branchingFactor;  //!< branching factor of BVH to build
+        size_t maxDepth;         //!< maximal depth of BVH to build
+        size_t logBlockSize;     //!< log2 of blocksize for SAH heuristic
+        size_t minLeafSize;      //!< minimal size of a leaf
+        size_t maxLeafSize;      //!< maximal size of a leaf
+        float travCost;          //!< estimated cost of one traversal step
+        float intCost;           //!< estimated cost of one primitive intersection
+        size_t searchRadius;     //!< number of neighboring clusters searched in each direction
+        size_t singleThreadThreshold; //!< threshold when we switch to single threaded build
+      };
+
+      /*! Node of the binary cluster tree. The first clusters are the
+       *  primitives in morton order, the remaining ones are created by
+       *  merging two clusters. */
+      struct Cluster
+      {
+        BBox3fa bounds;          //!< bounds of the cluster
+        unsigned left, right;    //!< merged clusters, unused for primitives
+        unsigned begin, size;    //!< range of the primitives of the cluster after reordering
+        float cost;              //!< SAH cost of the cluster
+        bool leaf;               //!< true if the cluster becomes a leaf
+      };
+
+      template<
+        typename ReductionTy,
+        typename Allocator,
+        typename CreateAllocator,
+        typename CreateNodeFunc,
+        typename SetNodeBoundsFunc,
+        typename CreateLeafFunc,
+        typename CalculateBounds,
+        typename ProgressMonitor>
+
+        class BuilderT : private Settings
+      {
+        ALIGNED_CLASS;
+
+      public:
+
+        BuilderT (CreateAllocator& createAllocator,
+                  CreateNodeFunc& createNode,
+                  SetNodeBoundsFunc& setBounds,
+                  CreateLeafFunc& createLeaf,
+                  CalculateBounds& calculateBounds,
+                  ProgressMonitor& progressMonitor,
+                  const Settings& settings)
+
+          : Settings(settings),
+          createAllocator(createAllocator),
+          createNode(createNode),
+          setBounds(setBounds),
+          createLeaf(createLeaf),
+          calculateBounds(calculateBounds),
+          progressMonitor(progressMonitor),
+          morton(nullptr) {}
+
+        /*! SAH cost of intersecting the primitives of a leaf */
+        __forceinline float leafCost(size_t size, float area) const {
+          return intCost*area*float((size+(size_t(1)<<logBlockSize)-1) >> logBlockSize);
+        }
+
+        /*! creates a new cluster by merging two clusters */
+        __forceinline void merge(unsigned id, unsigned a, unsigned b)
+        {
+          const Cluster& l = clusters[a];
+          const Cluster& r = clusters[b];
+          Cluster& c = clusters[id];
+          c.bounds = embree::merge(l.bounds,r.bounds);
+          c.left = a;
+          c.right = b;
+          c.size = l.size+r.size;
+
+          /* we create a leaf if this is cheaper than splitting the cluster */
+          const float area = halfArea(c.bounds);
+          const float splitCost = travCost*area + l.cost + r.cost;
+          if (c.size <= minLeafSize || (c.size <= maxLeafSize && leafCost(c.size,area) <= splitCost)) {
+            c.leaf = true;
+            c.cost = leafCost(c.size,area);
+          } else {
+            c.leaf = false;
+            c.cost = splitCost;
+          }
+        }
+
+        /*! agglomerative clustering of the sorted primitives, returns the root cluster */
+        unsigned cluster(size_t numPrimitives)
+        {
+          clusters.resize(2*numPrimitives-1);
+          avector<BBox3fa> bounds(numPrimitives);
+          std::vector<unsigned> current(numPrimitives), next(numPrimitives), neighbor(numPrimitives);
+          std::vector<unsigned> blockOffsets((numPrimitives+BLOCK_SIZE-1)/BLOCK_SIZE);
+
+          /* create one cluster per primitive */
+          parallel_for(size_t(0), numPrimitives, BLOCK_SIZE, [&] (const range<size_t>& r) {
+              for (size_t i=r.begin(); i<r.end(); i++)
+              {
+                Cluster& c = clusters[i];
+                c.bounds = calculateBounds(morton[i]);
+                c.left = c.right = unsigned(-1);
+                c.size = 1;
+                c.leaf = true;
+                c.cost = leafCost(1,halfArea(c.bounds));
+                current[i] = unsigned(i);
+              }
+            });
+
+          std::atomic<unsigned> numClustersCreated((unsigned)numPrimitives);
+          size_t numClusters = numPrimitives;
+          while (numClusters > 1)
+          {
+            /* gather bounds of active clusters for a compact neighbor search */
+            parallel_for(size_t(0), numClusters, BLOCK_SIZE, [&] (const range<size_t>& r) {
+                for (size_t i=r.begin(); i<r.end(); i++)
+                  bounds[i] = clusters[current[i]].bounds;
+              });
+
+            /* find nearest neighbor of each cluster inside the search window */
+            parallel_for(size_t(0), numClusters, BLOCK_SIZE, [&] (const range<size_t>& r) {
+                for (size_t i=r.begin(); i<r.end(); i++)
+                {
+                  const BBox3fa b = bounds[i];
+                  const size_t begin = i > searchRadius ? i-searchRadius : 0;
+                  const size_t end = min(i+searchRadius+1,numClusters);
+                  float bestArea = pos_inf;
+                  size_t bestNeighbor = i == 0 ? 1 : 0;
+                  for (size_t j=begin; j<end; j++)
+                  {
+                    if (j == i) continue;
+                    const float area = halfArea(embree::merge(b,bounds[j]));
+                    if (area < bestArea) { bestArea = area; bestNeighbor = j; }
+                  }
+                  neighbor[i] = unsigned(bestNeighbor);
+                }
+              });
+
+            /* merge clusters that are nearest neighbors of each other */
+            parallel_for(size_t(0), numClusters, BLOCK_SIZE, [&] (const range<size_t>& r) {
+                for (size_t i=r.begin(); i<r.end(); i++)
+                {
+                  const unsigned j = neighbor[i];
+                  if (neighbor[j] != i) next[i] = current[i];
+                  else if (i > j) next[i] = unsigned(-1);
+                  else {
+                    const unsigned id = numClustersCreated++;
+                    merge(id,current[i],current[j]);
+                    next[i] = id;
+                  }
+                }
+              });
+
+            /* compact the remaining clusters, keeping them in morton order */
+            const size_t numBlocks = (numClusters+BLOCK_SIZE-1)/BLOCK_SIZE;
+            parallel_for(size_t(0), numBlocks, [&] (const range<size_t>& r) {
+                for (size_t k=r.begin(); k<r.end(); k++)
+                {
+                  unsigned n = 0;
+                  for (size_t i=k*BLOCK_SIZE; i<min((k+1)*BLOCK_SIZE,numClusters); i++)
+                    n += next[i] != unsigned(-1);
+                  blockOffsets[k] = n;
+                }
+              });
+            size_t numClustersNext = 0;
+            for (size_t k=0; k<numBlocks; k++) {
+              const unsigned n = blockOffsets[k];
+              blockOffsets[k] = unsigned(numClustersNext);
+              numClustersNext += n;
+            }
+            parallel_for(size_t(0), numBlocks, [&] (const range<size_t>& r) {
+                for (size_t k=r.begin(); k<r.end(); k++)
+                {
+                  unsigned dst = blockOffsets[k];
+                  for (size_t i=k*BLOCK_SIZE; i<min((k+1)*BLOCK_SIZE,numClusters); i++)
+                    if (next[i] != unsigned(-1)) current[dst++] = next[i];
+                }
+              });
+
+            /* merge the first two clusters if no mutual neighbors got found, e.g. due to NaN bounds */
+            if (numClustersNext == numClusters)
+            {
+              const unsigned id = numClustersCreated++;
+              merge(id,current[0],current[1]);
+              current[0] = id;
+              for (size_t i=1; i<numClusters-1; i++)
+                current[i] = current[i+1];
+              numClustersNext--;
+            }
+
+            progressMonitor(numClusters-numClustersNext);
+            numClusters = numClustersNext;
+          }
+          return current[0];
+        }
+
+        /*! assigns each cluster a range of primitives and reorders the primitives accordingly */
+        void reorder(unsigned root, BuildPrim* tmp, size_t numPrimitives)
+        {
+          /* merged clusters are always created after their children */
+          clusters[root].begin = 0;
+          for (size_t i=root; i>=numPrimitives; i--)
+          {
+            const Cluster& c = clusters[i];
+            clusters[c.left ].begin = c.begin;
+            clusters[c.right].begin = c.begin + clusters[c.left].size;
+          }
+
+          parallel_for(size_t(0), numPrimitives, BLOCK_SIZE, [&] (const range<size_t>& r) {
+              for (size_t i=r.begin(); i<r.end(); i++)
+                tmp[clusters[i].begin] = morton[i];
+            });
+          parallel_for(size_t(0), numPrimitives, BLOCK_SIZE, [&] (const range<size_t>& r) {
+              for (size_t i=r.begin(); i<r.end(); i++)
+                morton[i] = tmp[i];
+            });
+        }
+
+        ReductionTy createLargeLeaf(size_t depth, const range<unsigned>& current, Allocator alloc)
+        {
+          /* this should never occur but is a fatal error */
+          if (depth > maxDepth)
+            throw_RTCError(RTC_UNKNOWN_ERROR,"depth limit reached");
+
+          /* create leaf for few primitives */
+          if (current.size() <= maxLeafSize)
+            return createLeaf(current,alloc);
+
+          /* fill all children by always splitting the largest one */
+          range<unsigned> children[MAX_BRANCHING_FACTOR];
+          size_t numChildren = 1;
+          children[0] = current;
+
+          do {
+
+            /* find best child with largest number of primitives */
+            size_t bestChild = -1;
+            size_t bestSize = 0;
+            for (size_t i=0; i<numChildren; i++)
+            {
+              /* ignore leaves as they cannot get split */
+              if (children[i].size() <= maxLeafSize)
+                continue;
+
+              /* remember child with largest size */
+              if (children[i].size() > bestSize) {
+                bestSize = children[i].size();
+                bestChild = i;
+              }
+            }
+            if (bestChild == size_t(-1)) break;
+
+            /*! split best child into left and right child */
+            auto split = children[bestChild].split();
+
+            /* add new children left and right */
+            children[bestChild] = children[numChildren-1];
+            children[numChildren-1] = split.first;
+            children[numChildren+0] = split.second;
+            numChildren++;
+
+          } while (numChildren < branchingFactor);
+
+          /* create node */
+          auto node = createNode(alloc,numChildren);
+
+          /* recurse into each child */
+          ReductionTy bounds[MAX_BRANCHING_FACTOR];
+          for (size_t i=0; i<numChildren; i++)
+            bounds[i] = createLargeLeaf(depth+1,children[i],alloc);
+
+          return setBounds(node,bounds,numChildren);
+        }
+
+        /*! collapses the binary cluster tree into a tree of the requested branching factor */
+        ReductionTy recurse(size_t depth, unsigned id, Allocator alloc)
+        {
+          /* get thread local allocator */
+          if (!alloc)
+            alloc = createAllocator();
+
+          const Cluster& cluster = clusters[id];
+          const range<unsigned> current(cluster.begin,cluster.begin+cluster.size);
+
+          /* create leaf node */
+          if (cluster.leaf)
+            return createLeaf(current,alloc);
+
+          /* create balanced tree when we get too close to the maximal depth */
+          if (unlikely(depth+MIN_LARGE_LEAF_LEVELS >= maxDepth))
+            return createLargeLeaf(depth,current,alloc);
+
+          /* fill all children by always opening the one with the largest surface area */
+          unsigned children[MAX_BRANCHING_FACTOR];
+          children[0] = cluster.left;
+          children[1] = cluster.right;
+          size_t numChildren = 2;
+
+          while (numChildren < branchingFactor)
+          {
+            /* find best child with largest surface area */
+            int bestChild = -1;
+            float bestArea = neg_inf;
+            for (unsigned int i=0; i<numChildren; i++)
+            {
+              /* ignore leaves as they cannot get opened */
+              if (clusters[children[i]].leaf)
+                continue;
+
+              /* remember child with largest area */
+              const float area = halfArea(clusters[children[i]].bounds);
+              if (area > bestArea) {
+                bestArea = area;
+                bestChild = i;
+              }
+            }
+            if (bestChild == -1) break;
+
+            /*! replace best child by its left and right child */
+            const Cluster& c = clusters[children[bestChild]];
+            children[bestChild] = c.left;
+            children[numChildren++] = c.right;
+          }
+
+          /* allocate node */
+          auto node = createNode(alloc,numChildren);
+
+          /* process top parts of tree parallel */
+          ReductionTy bounds[MAX_BRANCHING_FACTOR];
+          if (current.size() > singleThreadThreshold)
+          {
+            /*! parallel_for is faster than spawing sub-tasks */
+            parallel_for(size_t(0), numChildren, [&] (const range<size_t>& r) {
+                for (size_t i=r.begin(); i<r.end(); i++) {
+                  bounds[i] = recurse(depth+1,children[i],nullptr);
+                  _mm_mfence(); // to allow non-temporal stores during build
+                }
+              });
+          }
+
+          /* finish tree sequentially */
+          else
+          {
+            for (size_t i=0; i<numChildren; i++)
+              bounds[i] = recurse(depth+1,children[i],alloc);
+          }
+
+          return setBounds(node,bounds,numChildren);
+        }
+
+        /* build function */
+        ReductionTy build(BuildPrim* src, BuildPrim* tmp, size_t numPrimitives)
+        {
+          /* sort morton codes */
+          morton = src;
+          radix_sort_u32(src,tmp,numPrimitives,singleThreadThreshold);
+
+          /* nothing to cluster for empty primitive set */
+          if (numPrimitives == 0)
+            return createLeaf(range<unsigned>(0,0),createAllocator());
+
+          /* build binary tree through clustering */
+          const unsigned root = cluster(numPrimitives);
+          reorder(root,tmp,numPrimitives);
+
+          /* build BVH */
+          const ReductionTy res = recurse(1,root,nullptr);
+          _mm_mfence(); // to allow non-temporal stores during build
+          return res;
+        }
+
+      public:
+        CreateAllocator& createAllocator;
+        CreateNodeFunc& createNode;
+        SetNodeBoundsFunc& setBounds;
+        CreateLeafFunc& createLeaf;
+        CalculateBounds& calculateBounds;
+        ProgressMonitor& progressMonitor;
+
+      public:
+        BuildPrim* morton;
+        avector<Cluster> clusters;
+      };
+
+
+      template<
+      typename ReductionTy,
+        typename CreateAllocFunc,
+        typename CreateNodeFunc,
+        typename SetBoundsFunc,
+        typename CreateLeafFunc,
+        typename CalculateBoundsFunc,
+        typename ProgressMonitor>
+
+        static ReductionTy build(CreateAllocFunc createAllocator,
+                                 CreateNodeFunc createNode,
+                                 SetBoundsFunc setBounds,
+                                 CreateLeafFunc createLeaf,
+                                 CalculateBoundsFunc calculateBounds,
+                                 ProgressMonitor progressMonitor,
+                                 BuildPrim* src,
+                                 BuildPrim* tmp,
+                                 size_t numPrimitives,
+                                 const Settings& settings)
+        {
+          typedef BuilderT<
+            ReductionTy,
+            decltype(createAllocator()),
+            CreateAllocFunc,
+            CreateNodeFunc,
+            SetBoundsFunc,
+            CreateLeafFunc,
+            CalculateBoundsFunc,
+            ProgressMonitor> Builder;
+
+          Builder builder(createAllocator,
+                          createNode,
+                          setBounds,
+                          createLeaf,
+                          calculateBounds,
+                          progressMonitor,
+                          settings);
+
+          return builder.build(src,tmp,numPrimitives);
+        }
+    };
+  }
+}
@@ -34,7 +34,7 @@ namespace embree
   {
     struct GeneralBVHBuilder
     {
-      static const size_t MAX_BRANCHING_FACTOR = 8;        //!< maximal supported BVH branching factor
+      static const size_t MAX_BRANCHING_FACTOR = 8;        //!< default maximal supported BVH branching factor
       static const size_t MIN_LARGE_LEAF_LEVELS = 8;        //!< create balanced tree of we are that many levels before the maximal tree depth
 
       /*! settings for SAH builder */
@@ -111,7 +111,8 @@ namespace embree
         typename CreateNodeFunc,
         typename UpdateNodeFunc,
         typename CreateLeafFunc,
-        typename ProgressMonitor>
+        typename ProgressMonitor,
+        size_t MAX_BRANCHING_FACTOR>
 
         class BuilderT
         {
@@ -314,6 +315,7 @@ namespace embree
         typename Heuristic,
         typename Set,
         typename PrimRef,
+        size_t MAX_BRANCHING_FACTOR = GeneralBVHBuilder::MAX_BRANCHING_FACTOR,
         typename CreateAllocFunc,
         typename CreateNodeFunc,
         typename UpdateNodeFunc,
@@ -342,7 +344,8 @@ namespace embree
           CreateNodeFunc,
           UpdateNodeFunc,
           CreateLeafFunc,
-          ProgressMonitor> Builder;
+          ProgressMonitor,
+          MAX_BRANCHING_FACTOR> Builder;
 
         /* instantiate builder */
         Builder builder(prims,
@@ -373,6 +376,7 @@ namespace embree
       /*! special builder that propagates reduction over the tree */
       template<
       typename ReductionTy,
+        size_t MAX_BRANCHING_FACTOR = GeneralBVHBuilder::MAX_BRANCHING_FACTOR,
         typename CreateAllocFunc,
         typename CreateNodeFunc,
         typename UpdateNodeFunc,
@@ -387,7 +391,7 @@ namespace embree
                                  const Settings& settings)
       {
         Heuristic heuristic(prims);
-        return GeneralBVHBuilder::build<ReductionTy,Heuristic,Set,PrimRef>(
+        return GeneralBVHBuilder::build<ReductionTy,Heuristic,Set,PrimRef,MAX_BRANCHING_FACTOR>(
           heuristic,
           prims,
           PrimInfoRange(0,pinfo.size(),pinfo),
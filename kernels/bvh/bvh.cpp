@@ -16,12 +16,13 @@
 
 #include "bvh.h"
 #include "bvh_statistics.h"
+#include "../../common/algorithms/parallel_for.h"
 
 namespace embree
 {
   template<int N>
   BVHN<N>::BVHN (const PrimitiveType& primTy, Scene* scene)
-    : AccelData((N==4) ? AccelData::TY_BVH4 : (N==8) ? AccelData::TY_BVH8 : AccelData::TY_UNKNOWN),
+    : AccelData((N==4) ? AccelData::TY_BVH4 : (N==8) ? AccelData::TY_BVH8 : (N==16) ? AccelData::TY_BVH16 : AccelData::TY_UNKNOWN),
       primTy(&primTy), device(scene->device), scene(scene),
       root(emptyNode), alloc(scene->device,scene->isStatic()), numPrimitives(0), numVertices(0)
   {
@@ -49,6 +50,162 @@ namespace embree
     this->numPrimitives = numPrimitives;
   }	
 
+  /*! header of a BVH stored with BVHN::save */
+  struct BVHNFileHeader
+  {
+    char magic[8];            //!< identifies the data as BVH
+    uint64_t N;               //!< branching factor of the BVH
+    char primTy[32];          //!< name of the primitive type stored in the leaves
+    uint64_t numPrimitives;   //!< number of primitives the BVH was build over
+    uint64_t root;            //!< offset of the root node
+    uint64_t bytes;           //!< total number of bytes of the stored BVH
+    LBBox3fa bounds;          //!< linear bounds of the BVH
+  };
+
+  static const char bvhFileMagic[8] = { 'E','M','B','R','E','E','B','V' };
+
+  template<int N>
+  size_t BVHN<N>::nodeBytes(NodeRef node)
+  {
+    switch (node.type()) {
+    case tyAlignedNode      : return sizeof(AlignedNode);
+    case tyAlignedNodeMB    : return sizeof(AlignedNodeMB);
+    case tyAlignedNodeMB4D  : return sizeof(AlignedNodeMB4D);
+    case tyUnalignedNode    : return sizeof(UnalignedNode);
+    case tyUnalignedNodeMB  : return sizeof(UnalignedNodeMB);
+    case tyQuantizedNode    : return sizeof(QuantizedNode);
+    default                 : return 0; // transformation nodes cannot get relocated
+    }
+  }
+
+  template<int N>
+  bool BVHN<N>::save(std::ostream& out)
+  {
+    /* subdivision patches are stored outside the BVH */
+    if (root != emptyNode && primTy->name.find("subdivpatch") == 0)
+      return false;
+
+    /* sizes of nodes and leaves as stored */
+    auto storedNodeBytes = [&] (NodeRef node) { return (nodeBytes(node)+63) & ~size_t(63); };
+    auto storedLeafBytes = [&] (NodeRef node) { size_t num; node.leaf(num); return (num*primTy->bytes+align_mask) & ~align_mask; };
+
+    /* first pass calculates the size of the node section */
+    size_t numNodeBytes = 0;
+    std::vector<NodeRef> stack;
+    if (!root.isLeaf()) stack.push_back(root);
+    while (!stack.empty())
+    {
+      NodeRef node = stack.back(); stack.pop_back();
+      if (nodeBytes(node) == 0) return false;
+      numNodeBytes += storedNodeBytes(node);
+
+      BaseNode* n = node.baseNode(BVH_FLAG_ALIGNED_NODE_MB);
+      for (size_t i=0; i<N; i++) 
+        if (!n->child(i).isLeaf()) stack.push_back(n->child(i));
+    }
+
+    /* second pass writes all nodes in breadth first order followed by all leaves, references are stored as offsets */
+    const size_t headerBytes = (sizeof(BVHNFileHeader)+63) & ~size_t(63);
+    size_t nodeOffset = headerBytes;
+    size_t leafOffset = headerBytes+numNodeBytes;
+    std::vector<NodeRef> nodes, leaves;
+    
+    auto encode = [&] (NodeRef node) -> NodeRef
+    {
+      if (node == emptyNode) return node;
+      size_t offset = 0;
+      if (node.isLeaf()) {
+        offset = leafOffset; leafOffset += storedLeafBytes(node);
+        leaves.push_back(node);
+      } else {
+        offset = nodeOffset; nodeOffset += storedNodeBytes(node);
+        nodes.push_back(node);
+      }
+      return NodeRef(offset | (node & align_mask));
+    };
+
+    BVHNFileHeader header{};
+    memcpy(header.magic,bvhFileMagic,sizeof(bvhFileMagic));
+    header.N = N;
+    strncpy(header.primTy,primTy->name.c_str(),sizeof(header.primTy)-1);
+    header.numPrimitives = numPrimitives;
+    header.root = encode(root);
+    header.bounds = bounds;
+    
+    const size_t begin = (size_t) out.tellp();
+    out.write((char*)&header,sizeof(header));
+    alignStream(out,64);
+
+    std::vector<char> buffer;
+    for (size_t i=0; i<nodes.size(); i++)
+    {
+      NodeRef node = nodes[i];
+      buffer.resize(storedNodeBytes(node));
+      std::fill(buffer.begin(),buffer.end(),0);
+      memcpy(buffer.data(),node.baseNode(BVH_FLAG_ALIGNED_NODE_MB),nodeBytes(node));
+      BaseNode* n = (BaseNode*) buffer.data();
+      for (size_t c=0; c<N; c++)
+        n->child(c) = encode(n->child(c));
+      out.write(buffer.data(),buffer.size());
+    }
+
+    for (size_t i=0; i<leaves.size(); i++)
+    {
+      size_t num; char* prims = leaves[i].leaf(num);
+      out.write(prims,num*primTy->bytes);
+      alignStream(out,byteAlignment);
+    }
+
+    /* patch the total size of the BVH into the header */
+    const size_t end = (size_t) out.tellp();
+    header.bytes = end-begin;
+    out.seekp(begin);
+    out.write((char*)&header,sizeof(header));
+    out.seekp(end);
+    return out.good();
+  }
+
+  template<int N>
+  bool BVHN<N>::load(char* ptr, size_t bytes)
+  {
+    /* check that the stored BVH matches this BVH */
+    if (bytes < sizeof(BVHNFileHeader)) return false;
+    const BVHNFileHeader* header = (const BVHNFileHeader*) ptr;
+    if (memcmp(header->magic,bvhFileMagic,sizeof(bvhFileMagic)) != 0) return false;
+    if (header->N != N || header->bytes != bytes) return false;
+    if (strncmp(header->primTy,primTy->name.c_str(),sizeof(header->primTy)) != 0) return false;
+
+    /* only the node references get relocated, leaf memory is never touched */
+    auto relocate = [&] (NodeRef& node) -> bool
+    {
+      if (node == emptyNode) return true;
+      const size_t offset = node & ~align_mask;
+      if (offset < sizeof(BVHNFileHeader) || offset >= bytes) return false;
+      if (!node.isLeaf() && (nodeBytes(node) == 0 || offset+nodeBytes(node) > bytes)) return false;
+      node = NodeRef((size_t)ptr + node);
+      return true;
+    };
+
+    NodeRef root = header->root;
+    if (!relocate(root)) return false;
+
+    std::vector<NodeRef> stack;
+    if (!root.isLeaf()) stack.push_back(root);
+    while (!stack.empty())
+    {
+      NodeRef node = stack.back(); stack.pop_back();
+      BaseNode* n = node.baseNode(BVH_FLAG_ALIGNED_NODE_MB);
+      for (size_t i=0; i<N; i++) {
+        if (!relocate(n->child(i))) return false;
+        if (!n->child(i).isLeaf()) stack.push_back(n->child(i));
+      }
+    }
+
+    clear();
+    set(root,header->bounds,header->numPrimitives);
+    return true;
+  }
+
   template<int N>
   void BVHN<N>::clearBarrier(NodeRef& node)
   {
@@ -120,6 +277,162 @@ namespace embree
     else return node;
   }
 
+  template<int N>
+  bool BVHN<N>::relayout(size_t treeletBytes)
+  {
+    /* subdivision patches are stored outside the BVH */
+    if (root == emptyNode || root.isLeaf() || primTy->name.find("subdivpatch") == 0)
+      return false;
+
+    /* a node or leaf to get relocated, slot points to its reference inside the already relocated parent */
+    struct Item
+    {
+      __forceinline Item() {}
+
+      __forceinline Item(NodeRef ref, NodeRef* slot, float A)
+        : ref(ref), slot(slot), A(A) {}
+
+      __forceinline bool operator< (const Item& other) const {
+        return this->A < other.A;
+      }
+
+      NodeRef ref;
+      NodeRef* slot;
+      float A;
+    };
+
+    auto itemBytes = [&] (NodeRef node) -> size_t
+    {
+      if (!node.isLeaf()) return nodeBytes(node);
+      size_t num; node.leaf(num); return num*primTy->bytes;
+    };
+
+    /* surface area of the ith child as stored in its parent, used to predict which children get traversed most often */
+    auto childArea = [&] (NodeRef node, size_t i) -> float
+    {
+      switch (node.type()) {
+      case tyAlignedNode     : return area(node.alignedNode()->bounds(i));
+      case tyAlignedNodeMB   :
+      case tyAlignedNodeMB4D : return area(node.alignedNodeMB()->bounds(i));
+      case tyUnalignedNode   : return area(node.unalignedNode()->extent(i));
+      case tyUnalignedNodeMB : return area(node.unalignedNodeMB()->extent0(i));
+      case tyQuantizedNode   : return area(node.quantizedNode()->bounds(i));
+      default                : return 0.0f;
+      }
+    };
+
+    /* nodes start at cache lines, leaves keep the alignment required by the largest primitive */
+    size_t leafAlignment = byteAlignment;
+    while (leafAlignment < 64 && primTy->bytes % (2*leafAlignment) == 0)
+      leafAlignment *= 2;
+
+    /* lays out treelets until no roots are left or maxRoots roots are pending, the roots of the largest children are processed first */
+    std::atomic<size_t> numTreelets(0);
+    auto layoutTreelets = [&] (std::vector<Item>& roots, size_t maxRoots, const FastAllocator::CachedAllocator& allocator) -> bool
+    {
+      std::vector<Item> heap, stack, overflow;
+      std::vector<NodeRef> members;
+      while (!roots.empty() && roots.size() < maxRoots)
+      {
+        const Item treelet = roots.back(); roots.pop_back();
+        numTreelets++;
+
+        /* grow the treelet best first by surface area until it fills treeletBytes */
+        size_t bytes = 0;
+        members.clear();
+        heap.clear();
+        heap.push_back(treelet);
+        while (!heap.empty())
+        {
+          std::pop_heap(heap.begin(),heap.end());
+          const Item item = heap.back(); heap.pop_back();
+          if (!item.ref.isLeaf() && nodeBytes(item.ref) == 0) return false;
+          const size_t b = itemBytes(item.ref);
+          if (!members.empty() && bytes+b > treeletBytes) continue;
+          bytes += b;
+          members.push_back(item.ref);
+          if (item.ref.isLeaf()) continue;
+          const BaseNode* n = item.ref.baseNode(BVH_FLAG_ALIGNED_NODE_MB);
+          for (size_t i=0; i<N; i++) {
+            if (n->child(i) == emptyNode) continue;
+            heap.push_back(Item(n->child(i),nullptr,childArea(item.ref,i)));
+            std::push_heap(heap.begin(),heap.end());
+          }
+        }
+
+        /* copy the treelet depth first with the largest child first, children outside the treelet become new treelet roots */
+        overflow.clear();
+        stack.clear();
+        stack.push_back(treelet);
+        while (!stack.empty())
+        {
+          const Item item = stack.back(); stack.pop_back();
+          const size_t b = itemBytes(item.ref);
+          size_t num; const char* src = item.ref.isLeaf() ? item.ref.leaf(num) : (const char*) item.ref.baseNode(BVH_FLAG_ALIGNED_NODE_MB);
+          char* dst = (char*) allocator.malloc1(b,item.ref.isLeaf() ? leafAlignment : 64);
+          memcpy(dst,src,b);
+          NodeRef ref((size_t)dst | (item.ref & align_mask));
+          *item.slot = ref;
+          if (ref.isLeaf()) continue;
+
+          /* the copied node still references the old children, their references get updated when they are copied */
+          const size_t begin = stack.size();
+          BaseNode* n = ref.baseNode(BVH_FLAG_ALIGNED_NODE_MB);
+          for (size_t i=0; i<N; i++)
+          {
+            if (n->child(i) == emptyNode) continue;
+            const Item child(n->child(i),&n->child(i),childArea(item.ref,i));
+            if (std::find(members.begin(),members.end(),child.ref) != members.end()) stack.push_back(child);
+            else overflow.push_back(child);
+          }
+          std::sort(stack.begin()+begin,stack.end());
+        }
+
+        /* the treelet of the largest child gets laid out next */
+        std::sort(overflow.begin(),overflow.end());
+        roots.insert(roots.end(),overflow.begin(),overflow.end());
+      }
+      return true;
+    };
+
+    /* the old BVH stays valid while it gets copied into fresh blocks, its blocks are freed once the copy succeeded */
+    NodeRef newRoot = emptyNode;
+    const bool relocated = alloc.reallocate([&] () -> bool
+    {
+      std::vector<Item> roots;
+      roots.push_back(Item(root,&newRoot,float(inf)));
+
+      /* the top treelets are laid out sequentially until there are enough subtrees to process them in parallel */
+      if (!layoutTreelets(roots,4*TaskScheduler::threadCount(),alloc.getCachedAllocator()))
+        return false;
+
+      std::atomic<bool> success(true);
+      parallel_for(size_t(0), roots.size(), [&] (const range<size_t>& r)
+      {
+        const FastAllocator::CachedAllocator allocator = alloc.getCachedAllocator();
+        std::vector<Item> subroots;
+        for (size_t i=r.begin(); i<r.end(); i++)
+        {
+          subroots.clear();
+          subroots.push_back(roots[i]);
+          if (!layoutTreelets(subroots,size_t(-1),allocator))
+            success = false;
+        }
+      });
+      return success;
+    });
+    if (!relocated) return false;
+
+    root = newRoot;
+
+    if (device->verbosity(2))
+    {
+      Lock<MutexSys> lock(g_printMutex);
+      std::cout << "relayout of BVH" << N << "<" << primTy->name << "> : " << numTreelets << " treelets" << std::endl << std::flush;
+    }
+    return true;
+  }
+
   template<int N>
   double BVHN<N>::preBuild(const std::string& builderName)
   {
@@ -190,11 +503,15 @@ namespace embree
     }
   }
 
-#if defined(__AVX__)
+#if defined(__AVX512VL__)
+  template class BVHN<16>;
+#endif
+
+#if defined(__AVX__) && !defined(EMBREE_BVH16_ONLY)
   template class BVHN<8>;
 #endif
 
-#if !defined(__AVX__) || !defined(EMBREE_TARGET_SSE2) && !defined(EMBREE_TARGET_SSE42)
+#if (!defined(__AVX__) || !defined(EMBREE_TARGET_SSE2) && !defined(EMBREE_TARGET_SSE42)) && !defined(EMBREE_BVH16_ONLY)
   template class BVHN<4>;
 #endif
 }
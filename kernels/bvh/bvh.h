@@ -191,7 +191,14 @@ namespace embree
               prefetchL1(((char*)ptr)+2*64);
               prefetchL1(((char*)ptr)+3*64);
             }
-            if ((N >= 8) && (types > BVH_FLAG_ALIGNED_NODE)) {
+            if (N >= 16) {
+              /* 16-wide aligned nodes span 8 cache lines */
+              prefetchL1(((char*)ptr)+4*64);
+              prefetchL1(((char*)ptr)+5*64);
+              prefetchL1(((char*)ptr)+6*64);
+              prefetchL1(((char*)ptr)+7*64);
+            }
+            else if ((N >= 8) && (types > BVH_FLAG_ALIGNED_NODE)) {
               /* deactivate for large nodes on Xeon, as it introduces regressions */
               //prefetchL1(((char*)ptr)+4*64);
               //prefetchL1(((char*)ptr)+5*64);
@@ -217,7 +224,7 @@ namespace embree
             embree::prefetchL2(((char*)ptr)+2*64);
             embree::prefetchL2(((char*)ptr)+3*64);
           }
-          if ((N >= 8) && (types > BVH_FLAG_ALIGNED_NODE)) {
+          if ((N >= 16) || ((N >= 8) && (types > BVH_FLAG_ALIGNED_NODE))) {
             embree::prefetchL2(((char*)ptr)+4*64);
             embree::prefetchL2(((char*)ptr)+5*64);
             embree::prefetchL2(((char*)ptr)+6*64);
@@ -234,7 +241,7 @@ namespace embree
             embree::prefetchL1(((char*)ptr)+2*64);
             embree::prefetchL1(((char*)ptr)+3*64);
           }
-          if ((N >= 8) && (types > BVH_FLAG_ALIGNED_NODE)) {
+          if ((N >= 16) || ((N >= 8) && (types > BVH_FLAG_ALIGNED_NODE))) {
             embree::prefetchL1(((char*)ptr)+4*64);
             embree::prefetchL1(((char*)ptr)+5*64);
             embree::prefetchL1(((char*)ptr)+6*64);
@@ -251,7 +258,7 @@ namespace embree
             embree::prefetchL2(((char*)ptr)+2*64);
             embree::prefetchL2(((char*)ptr)+3*64);
           }
-          if ((N >= 8) && (types > BVH_FLAG_ALIGNED_NODE)) {
+          if ((N >= 16) || ((N >= 8) && (types > BVH_FLAG_ALIGNED_NODE))) {
             embree::prefetchL2(((char*)ptr)+4*64);
             embree::prefetchL2(((char*)ptr)+5*64);
             embree::prefetchL2(((char*)ptr)+6*64);
@@ -1377,6 +1384,18 @@ namespace embree
     /*! sets BVH members after build */
     void set (NodeRef root, const LBBox3fa& bounds, size_t numPrimitives);
 
+    /*! stores the BVH into a stream, fails for BVHs that reference memory outside of the BVH */
+    bool save(std::ostream& out);
+
+    /*! restores the BVH from memory written by save */
+    bool load(char* ptr, size_t bytes);
+
+    /*! finds the closest point to the query position within the query radius */
+    void pointQuery(RTCPointQuery& query);
+
+    /*! returns the size of a node that can get stored, or zero for node types that cannot get stored */
+    static size_t nodeBytes(NodeRef node);
+
     /*! Clears the barrier bits of a subtree. */
     void clearBarrier(NodeRef& node);
 
@@ -1384,6 +1403,9 @@ namespace embree
     void layoutLargeNodes(size_t num);
     NodeRef layoutLargeNodesRecursion(NodeRef& node, const FastAllocator::CachedAllocator& allocator);
 
+    /*! stores nodes and leaves in page sized treelets in depth first order, fails if the BVH contains nodes that cannot get relocated */
+    bool relayout(size_t treeletBytes = PAGE_SIZE);
+
     /*! called by all builders before build starts */
     double preBuild(const std::string& builderName);
 
@@ -1496,6 +1518,13 @@ namespace embree
     transpose(upper_x,upper_y,upper_z,vfloat4(zero),bounds0.upper,bounds1.upper,bounds2.upper,bounds3.upper);
   }
 
+  /* the BVH sources are compiled again for AVX-512 (Skylake) to
+   * instantiate BVH16, all other widths come from the lower ISAs */
+#if defined(__AVX512VL__) && (defined(EMBREE_TARGET_SSE2) || defined(EMBREE_TARGET_SSE42) || defined(EMBREE_TARGET_AVX) || defined(EMBREE_TARGET_AVX2) || defined(EMBREE_TARGET_AVX512KNL))
+#  define EMBREE_BVH16_ONLY
+#endif
+
   typedef BVHN<4> BVH4;
   typedef BVHN<8> BVH8;
+  typedef BVHN<16> BVH16;
 }
@@ -0,0 +1,255 @@
+// ======================================================================== //
+// Copyright 2009-2017 Intel Corporation                                    //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ======================================================================== //
+
+#include "../common/isa.h" // to define EMBREE_TARGET_AVX512SKX
+
+#if defined (EMBREE_TARGET_AVX512SKX)
+
+#include "bvh16_factory.h"
+#include "../bvh/bvh.h"
+
+#include "../geometry/triangle.h"
+#include "../geometry/trianglev.h"
+#include "../geometry/quadv.h"
+#include "../common/accelinstance.h"
+
+namespace embree
+{
+  DECLARE_SYMBOL2(Accel::Intersector1,BVH16Triangle4Intersector1Moeller);
+  DECLARE_SYMBOL2(Accel::Intersector1,BVH16Triangle16Intersector1Moeller);
+  DECLARE_SYMBOL2(Accel::Intersector1,BVH16Triangle4vIntersector1Pluecker);
+  DECLARE_SYMBOL2(Accel::Intersector1,BVH16Quad4vIntersector1Moeller);
+  DECLARE_SYMBOL2(Accel::Intersector1,BVH16Quad4vIntersector1Pluecker);
+
+  DECLARE_SYMBOL2(Accel::Intersector16,BVH16Triangle4Intersector16HybridMoeller);
+  DECLARE_SYMBOL2(Accel::Intersector16,BVH16Triangle4Intersector16HybridMoellerNoFilter);
+  DECLARE_SYMBOL2(Accel::Intersector16,BVH16Triangle16Intersector16HybridMoeller);
+  DECLARE_SYMBOL2(Accel::Intersector16,BVH16Triangle16Intersector16HybridMoellerNoFilter);
+  DECLARE_SYMBOL2(Accel::Intersector16,BVH16Triangle4vIntersector16HybridPluecker);
+  DECLARE_SYMBOL2(Accel::Intersector16,BVH16Quad4vIntersector16HybridMoeller);
+  DECLARE_SYMBOL2(Accel::Intersector16,BVH16Quad4vIntersector16HybridMoellerNoFilter);
+  DECLARE_SYMBOL2(Accel::Intersector16,BVH16Quad4vIntersector16HybridPluecker);
+
+  DECLARE_SYMBOL2(Accel::IntersectorN,BVH16Triangle4IntersectorStreamMoeller);
+  DECLARE_SYMBOL2(Accel::IntersectorN,BVH16Triangle4IntersectorStreamMoellerNoFilter);
+  DECLARE_SYMBOL2(Accel::IntersectorN,BVH16Triangle16IntersectorStreamMoeller);
+  DECLARE_SYMBOL2(Accel::IntersectorN,BVH16Triangle16IntersectorStreamMoellerNoFilter);
+  DECLARE_SYMBOL2(Accel::IntersectorN,BVH16Triangle4vIntersectorStreamPluecker);
+  DECLARE_SYMBOL2(Accel::IntersectorN,BVH16Quad4vIntersectorStreamMoeller);
+  DECLARE_SYMBOL2(Accel::IntersectorN,BVH16Quad4vIntersectorStreamMoellerNoFilter);
+  DECLARE_SYMBOL2(Accel::IntersectorN,BVH16Quad4vIntersectorStreamPluecker);
+
+  DECLARE_ISA_FUNCTION(Builder*,BVH16Triangle4SceneBuilderSAH,void* COMMA Scene* COMMA size_t);
+  DECLARE_ISA_FUNCTION(Builder*,BVH16Triangle16SceneBuilderSAH,void* COMMA Scene* COMMA size_t);
+  DECLARE_ISA_FUNCTION(Builder*,BVH16Triangle4vSceneBuilderSAH,void* COMMA Scene* COMMA size_t);
+  DECLARE_ISA_FUNCTION(Builder*,BVH16Quad4vSceneBuilderSAH,void* COMMA Scene* COMMA size_t);
+
+  BVH16Factory::BVH16Factory(int bfeatures, int ifeatures)
+  {
+    selectBuilders(bfeatures);
+    selectIntersectors(ifeatures);
+  }
+
+  void BVH16Factory::selectBuilders(int features)
+  {
+    IF_ENABLED_TRIS(SELECT_SYMBOL_INIT_AVX512SKX(features,BVH16Triangle4SceneBuilderSAH));
+    IF_ENABLED_TRIS(SELECT_SYMBOL_INIT_AVX512SKX(features,BVH16Triangle16SceneBuilderSAH));
+    IF_ENABLED_TRIS(SELECT_SYMBOL_INIT_AVX512SKX(features,BVH16Triangle4vSceneBuilderSAH));
+    IF_ENABLED_QUADS(SELECT_SYMBOL_INIT_AVX512SKX(features,BVH16Quad4vSceneBuilderSAH));
+  }
+
+  void BVH16Factory::selectIntersectors(int features)
+  {
+    /* select intersectors1 */
+    IF_ENABLED_TRIS(SELECT_SYMBOL_INIT_AVX512SKX(features,BVH16Triangle4Intersector1Moeller));
+    IF_ENABLED_TRIS(SELECT_SYMBOL_INIT_AVX512SKX(features,BVH16Triangle16Intersector1Moeller));
+    IF_ENABLED_TRIS(SELECT_SYMBOL_INIT_AVX512SKX(features,BVH16Triangle4vIntersector1Pluecker));
+    IF_ENABLED_QUADS(SELECT_SYMBOL_INIT_AVX512SKX(features,BVH16Quad4vIntersector1Moeller));
+    IF_ENABLED_QUADS(SELECT_SYMBOL_INIT_AVX512SKX(features,BVH16Quad4vIntersector1Pluecker));
+
+#if defined (EMBREE_RAY_PACKETS)
+
+    /* select intersectors16 */
+    IF_ENABLED_TRIS(SELECT_SYMBOL_INIT_AVX512SKX(features,BVH16Triangle4Intersector16HybridMoeller));
+    IF_ENABLED_TRIS(SELECT_SYMBOL_INIT_AVX512SKX(features,BVH16Triangle4Intersector16HybridMoellerNoFilter));
+    IF_ENABLED_TRIS(SELECT_SYMBOL_INIT_AVX512SKX(features,BVH16Triangle16Intersector16HybridMoeller));
+    IF_ENABLED_TRIS(SELECT_SYMBOL_INIT_AVX512SKX(features,BVH16Triangle16Intersector16HybridMoellerNoFilter));
+    IF_ENABLED_TRIS(SELECT_SYMBOL_INIT_AVX512SKX(features,BVH16Triangle4vIntersector16HybridPluecker));
+    IF_ENABLED_QUADS(SELECT_SYMBOL_INIT_AVX512SKX(features,BVH16Quad4vIntersector16HybridMoeller));
+    IF_ENABLED_QUADS(SELECT_SYMBOL_INIT_AVX512SKX(features,BVH16Quad4vIntersector16HybridMoellerNoFilter));
+    IF_ENABLED_QUADS(SELECT_SYMBOL_INIT_AVX512SKX(features,BVH16Quad4vIntersector16HybridPluecker));
+
+    /* select stream intersectors */
+    IF_ENABLED_TRIS(SELECT_SYMBOL_INIT_AVX512SKX(features,BVH16Triangle4IntersectorStreamMoeller));
+    IF_ENABLED_TRIS(SELECT_SYMBOL_INIT_AVX512SKX(features,BVH16Triangle4IntersectorStreamMoellerNoFilter));
+    IF_ENABLED_TRIS(SELECT_SYMBOL_INIT_AVX512SKX(features,BVH16Triangle16IntersectorStreamMoeller));
+    IF_ENABLED_TRIS(SELECT_SYMBOL_INIT_AVX512SKX(features,BVH16Triangle16IntersectorStreamMoellerNoFilter));
+    IF_ENABLED_TRIS(SELECT_SYMBOL_INIT_AVX512SKX(features,BVH16Triangle4vIntersectorStreamPluecker));
+    IF_ENABLED_QUADS(SELECT_SYMBOL_INIT_AVX512SKX(features,BVH16Quad4vIntersectorStreamMoeller));
+    IF_ENABLED_QUADS(SELECT_SYMBOL_INIT_AVX512SKX(features,BVH16Quad4vIntersectorStreamMoellerNoFilter));
+    IF_ENABLED_QUADS(SELECT_SYMBOL_INIT_AVX512SKX(features,BVH16Quad4vIntersectorStreamPluecker));
+
+#endif
+  }
+
+  /*! the 16-wide BVH is traversed by single rays, packets of 16 rays, and streams only */
+  static void invalid_rtcIntersect4_8() { 
+    throw_RTCError(RTC_INVALID_OPERATION,"rtcIntersect4, rtcIntersect8, rtcOccluded4, and rtcOccluded8 not supported by 16-wide BVH"); 
+  }
+
+  Accel::Intersectors BVH16Factory::BVH16Triangle4Intersectors(BVH16* bvh, IntersectVariant ivariant)
+  {
+    assert(ivariant == IntersectVariant::FAST);
+    Accel::Intersectors intersectors(invalid_rtcIntersect4_8);
+    intersectors.ptr = bvh;
+    intersectors.intersector1           = BVH16Triangle4Intersector1Moeller();
+#if defined (EMBREE_RAY_PACKETS)
+    intersectors.intersector16_filter   = BVH16Triangle4Intersector16HybridMoeller();
+    intersectors.intersector16_nofilter = BVH16Triangle4Intersector16HybridMoellerNoFilter();
+    intersectors.intersectorN_filter    = BVH16Triangle4IntersectorStreamMoeller();
+    intersectors.intersectorN_nofilter  = BVH16Triangle4IntersectorStreamMoellerNoFilter();
+#endif
+    return intersectors;
+  }
+
+  Accel::Intersectors BVH16Factory::BVH16Triangle16Intersectors(BVH16* bvh, IntersectVariant ivariant)
+  {
+    assert(ivariant == IntersectVariant::FAST);
+    Accel::Intersectors intersectors(invalid_rtcIntersect4_8);
+    intersectors.ptr = bvh;
+    intersectors.intersector1           = BVH16Triangle16Intersector1Moeller();
+#if defined (EMBREE_RAY_PACKETS)
+    intersectors.intersector16_filter   = BVH16Triangle16Intersector16HybridMoeller();
+    intersectors.intersector16_nofilter = BVH16Triangle16Intersector16HybridMoellerNoFilter();
+    intersectors.intersectorN_filter    = BVH16Triangle16IntersectorStreamMoeller();
+    intersectors.intersectorN_nofilter  = BVH16Triangle16IntersectorStreamMoellerNoFilter();
+#endif
+    return intersectors;
+  }
+
+  Accel::Intersectors BVH16Factory::BVH16Triangle4vIntersectors(BVH16* bvh, IntersectVariant ivariant)
+  {
+    assert(ivariant == IntersectVariant::ROBUST);
+    Accel::Intersectors intersectors(invalid_rtcIntersect4_8);
+    intersectors.ptr = bvh;
+    intersectors.intersector1    = BVH16Triangle4vIntersector1Pluecker();
+#if defined (EMBREE_RAY_PACKETS)
+    intersectors.intersector16   = BVH16Triangle4vIntersector16HybridPluecker();
+    intersectors.intersectorN    = BVH16Triangle4vIntersectorStreamPluecker();
+#endif
+    return intersectors;
+  }
+
+  Accel::Intersectors BVH16Factory::BVH16Quad4vIntersectors(BVH16* bvh, IntersectVariant ivariant)
+  {
+    switch (ivariant) {
+    case IntersectVariant::FAST:
+    {
+      Accel::Intersectors intersectors(invalid_rtcIntersect4_8);
+      intersectors.ptr = bvh;
+      intersectors.intersector1           = BVH16Quad4vIntersector1Moeller();
+#if defined (EMBREE_RAY_PACKETS)
+      intersectors.intersector16_filter   = BVH16Quad4vIntersector16HybridMoeller();
+      intersectors.intersector16_nofilter = BVH16Quad4vIntersector16HybridMoellerNoFilter();
+      intersectors.intersectorN_filter    = BVH16Quad4vIntersectorStreamMoeller();
+      intersectors.intersectorN_nofilter  = BVH16Quad4vIntersectorStreamMoellerNoFilter();
+#endif
+      return intersectors;
+    }
+    case IntersectVariant::ROBUST:
+    {
+      Accel::Intersectors intersectors(invalid_rtcIntersect4_8);
+      intersectors.ptr = bvh;
+      intersectors.intersector1  = BVH16Quad4vIntersector1Pluecker();
+#if defined (EMBREE_RAY_PACKETS)
+      intersectors.intersector16 = BVH16Quad4vIntersector16HybridPluecker();
+      intersectors.intersectorN  = BVH16Quad4vIntersectorStreamPluecker();
+#endif
+      return intersectors;
+    }
+    default: assert(false);
+    }
+    return Accel::Intersectors();
+  }
+
+  Accel* BVH16Factory::BVH16Triangle4(Scene* scene, BuildVariant bvariant, IntersectVariant ivariant)
+  {
+    BVH16* accel = new BVH16(Triangle4::type,scene);
+    Accel::Intersectors intersectors= BVH16Triangle4Intersectors(accel,ivariant);
+    Builder* builder = nullptr;
+    if (scene->device->tri_builder == "default")  {
+      switch (bvariant) {
+      case BuildVariant::STATIC      : builder = BVH16Triangle4SceneBuilderSAH(accel,scene,0); break;
+      default: throw_RTCError(RTC_INVALID_ARGUMENT,"only static build mode supported for BVH16<Triangle4>");
+      }
+    }
+    else if (scene->device->tri_builder == "sah"         )  builder = BVH16Triangle4SceneBuilderSAH(accel,scene,0);
+    else if (scene->device->tri_builder == "sah_presplit")  builder = BVH16Triangle4SceneBuilderSAH(accel,scene,MODE_HIGH_QUALITY);
+    else throw_RTCError(RTC_INVALID_ARGUMENT,"unknown builder "+scene->device->tri_builder+" for BVH16<Triangle4>");
+
+    return new AccelInstance(accel,builder,intersectors);
+  }
+
+  Accel* BVH16Factory::BVH16Triangle16(Scene* scene, BuildVariant bvariant, IntersectVariant ivariant)
+  {
+    BVH16* accel = new BVH16(Triangle16::type,scene);
+    Accel::Intersectors intersectors= BVH16Triangle16Intersectors(accel,ivariant);
+    Builder* builder = nullptr;
+    if (scene->device->tri_builder == "default")  {
+      switch (bvariant) {
+      case BuildVariant::STATIC      : builder = BVH16Triangle16SceneBuilderSAH(accel,scene,0); break;
+      default: throw_RTCError(RTC_INVALID_ARGUMENT,"only static build mode supported for BVH16<Triangle16>");
+      }
+    }
+    else if (scene->device->tri_builder == "sah")  builder = BVH16Triangle16SceneBuilderSAH(accel,scene,0);
+    else throw_RTCError(RTC_INVALID_ARGUMENT,"unknown builder "+scene->device->tri_builder+" for BVH16<Triangle16>");
+    return new AccelInstance(accel,builder,intersectors);
+  }
+
+  Accel* BVH16Factory::BVH16Triangle4v(Scene* scene, BuildVariant bvariant, IntersectVariant ivariant)
+  {
+    BVH16* accel = new BVH16(Triangle4v::type,scene);
+    Accel::Intersectors intersectors= BVH16Triangle4vIntersectors(accel,ivariant);
+    Builder* builder = nullptr;
+    if (scene->device->tri_builder == "default")  {
+      switch (bvariant) {
+      case BuildVariant::STATIC      : builder = BVH16Triangle4vSceneBuilderSAH(accel,scene,0); break;
+      default: throw_RTCError(RTC_INVALID_ARGUMENT,"only static build mode supported for BVH16<Triangle4v>");
+      }
+    }
+    else if (scene->device->tri_builder == "sah"         )  builder = BVH16Triangle4vSceneBuilderSAH(accel,scene,0);
+    else throw_RTCError(RTC_INVALID_ARGUMENT,"unknown builder "+scene->device->tri_builder+" for BVH16<Triangle4v>");
+    return new AccelInstance(accel,builder,intersectors);
+  }
+
+  Accel* BVH16Factory::BVH16Quad4v(Scene* scene, BuildVariant bvariant, IntersectVariant ivariant)
+  {
+    BVH16* accel = new BVH16(Quad4v::type,scene);
+    Accel::Intersectors intersectors = BVH16Quad4vIntersectors(accel,ivariant);
+    Builder* builder = nullptr;
+    if (scene->device->quad_builder == "default")  {
+      switch (bvariant) {
+      case BuildVariant::STATIC      : builder = BVH16Quad4vSceneBuilderSAH(accel,scene,0); break;
+      default: throw_RTCError(RTC_INVALID_ARGUMENT,"only static build mode supported for BVH16<Quad4v>");
+      }
+    }
+    else if (scene->device->quad_builder == "sah")  builder = BVH16Quad4vSceneBuilderSAH(accel,scene,0);
+    else throw_RTCError(RTC_INVALID_ARGUMENT,"unknown builder "+scene->device->quad_builder+" for BVH16<Quad4v>");
+    return new AccelInstance(accel,builder,intersectors);
+  }
+}
+
+#endif
@@ -29,7 +29,7 @@ namespace embree
       
       settings.branchingFactor = N;
       settings.maxDepth = BVH::maxBuildDepthLeaf;
-      return BVHBuilderBinnedSAH::build<NodeRef>
+      return BVHBuilderBinnedSAH::build<NodeRef,N>
         (FastAllocator::Create(allocator),typename BVH::AlignedNode::Create2(),typename BVH::AlignedNode::Set3(allocator,prims),createLeafFunc,progressFunc,prims,pinfo,settings);
     }
 
@@ -69,5 +69,9 @@ namespace embree
     template struct BVHNBuilderQuantizedVirtual<8>;
     template struct BVHNBuilderMblurVirtual<8>;
 #endif
+
+#if defined(__AVX512VL__)
+    template struct BVHNBuilderVirtual<16>;
+#endif
   }
 }
@@ -93,6 +93,7 @@ namespace embree
            createLeaf,scene->progressInterface,scene,prims.data(),pinfo,settings);
         
         bvh->set(root,LBBox3fa(pinfo.geomBounds),pinfo.size());
+        if (bvh->device->relayout) bvh->relayout();
         
         //});
         
@@ -184,6 +185,7 @@ namespace embree
            settings);
         
         bvh->set(root.ref,root.lbounds,pinfo.num_time_segments);
+        if (bvh->device->relayout) bvh->relayout();
         
         //});
         
@@ -22,6 +22,7 @@
 
 #include "../builders/primrefgen.h"
 #include "../builders/bvh_builder_morton.h"
+#include "../builders/bvh_builder_ploc.h"
 
 #include "../geometry/triangle.h"
 #include "../geometry/trianglev.h"
@@ -234,7 +235,7 @@ namespace embree
           upper = max(upper,(vfloat4)p0,(vfloat4)p1,(vfloat4)p2);
           vgeomID[i] = geomID;
           vprimID[i] = primID;
-          unsigned int_stride = mesh->vertices0.getStride()/4;
+          const unsigned int_stride = mesh->leafVertexScale();
 	  v0[i] = tri.v[0] * int_stride; 
 	  v1[i] = tri.v[1] * int_stride;
 	  v2[i] = tri.v[2] * int_stride;
@@ -377,7 +378,8 @@ namespace embree
       Mesh* mesh;
     };        
 
-    template<int N, typename Mesh, typename Primitive>
+    /* builds the BVH from morton codes, either through the morton builder or through the PLOC builder */
+    template<int N, typename Mesh, typename Primitive, typename MortonBuilder = BVHBuilderMorton>
     class BVHNMeshBuilderMorton : public Builder
     {
       typedef BVHN<N> BVH;
@@ -389,6 +391,9 @@ namespace embree
       
       BVHNMeshBuilderMorton (BVH* bvh, Mesh* mesh, const size_t minLeafSize, const size_t maxLeafSize, const size_t singleThreadThreshold = DEFAULT_SINGLE_THREAD_THRESHOLD)
         : bvh(bvh), mesh(mesh), morton(bvh->device,0), settings(N,BVH::maxBuildDepth,minLeafSize,maxLeafSize,singleThreadThreshold) {}
+
+      BVHNMeshBuilderMorton (BVH* bvh, Mesh* mesh, const typename MortonBuilder::Settings& settings)
+        : bvh(bvh), mesh(mesh), morton(bvh->device,0), settings(settings) {}
       
       /* build function */
       void build() 
@@ -422,7 +427,7 @@ namespace embree
         SetBVHNBounds<N> setBounds(bvh);
         CreateMortonLeaf<N,Primitive> createLeaf(mesh,morton.data());
         CalculateMeshBounds<Mesh> calculateBounds(mesh);
-        auto root = BVHBuilderMorton::build<NodeRecord>(
+        auto root = MortonBuilder::template build<NodeRecord>(
           typename BVH::CreateAlloc(bvh), 
           typename BVH::AlignedNode::Create(),
           setBounds,createLeaf,calculateBounds,bvh->scene->progressInterface,
@@ -456,7 +461,7 @@ namespace embree
       BVH* bvh;
       Mesh* mesh;
       mvector<BVHBuilderMorton::BuildPrim> morton;
-      BVHBuilderMorton::Settings settings;
+      typename MortonBuilder::Settings settings;
     };
 
 #if defined(EMBREE_GEOMETRY_TRIANGLES)
@@ -467,6 +472,10 @@ namespace embree
     Builder* BVH8Triangle4MeshBuilderMortonGeneral  (void* bvh, TriangleMesh* mesh, size_t mode) { return new class BVHNMeshBuilderMorton<8,TriangleMesh,Triangle4> ((BVH8*)bvh,mesh,4,4); }
     Builder* BVH8Triangle4vMeshBuilderMortonGeneral (void* bvh, TriangleMesh* mesh, size_t mode) { return new class BVHNMeshBuilderMorton<8,TriangleMesh,Triangle4v>((BVH8*)bvh,mesh,4,4); }
     Builder* BVH8Triangle4iMeshBuilderMortonGeneral (void* bvh, TriangleMesh* mesh, size_t mode) { return new class BVHNMeshBuilderMorton<8,TriangleMesh,Triangle4i>((BVH8*)bvh,mesh,4,4); }
+#endif
+    Builder* BVH4Triangle4MeshBuilderPLOC (void* bvh, TriangleMesh* mesh, size_t mode) { return new class BVHNMeshBuilderMorton<4,TriangleMesh,Triangle4,BVHBuilderPLOC>((BVH4*)bvh,mesh,BVHBuilderPLOC::Settings(4,BVH4::maxBuildDepth,4,1,4,1.0f,1.0f,Builder::DEFAULT_SINGLE_THREAD_THRESHOLD)); }
+#if defined(__AVX__)
+    Builder* BVH8Triangle4MeshBuilderPLOC (void* bvh, TriangleMesh* mesh, size_t mode) { return new class BVHNMeshBuilderMorton<8,TriangleMesh,Triangle4,BVHBuilderPLOC>((BVH8*)bvh,mesh,BVHBuilderPLOC::Settings(8,BVH8::maxBuildDepth,4,1,4,1.0f,1.0f,Builder::DEFAULT_SINGLE_THREAD_THRESHOLD)); }
 #endif
 #endif
 
@@ -474,6 +483,10 @@ namespace embree
     Builder* BVH4Quad4vMeshBuilderMortonGeneral (void* bvh, QuadMesh* mesh, size_t mode) { return new class BVHNMeshBuilderMorton<4,QuadMesh,Quad4v>((BVH4*)bvh,mesh,4,4); }
 #if defined(__AVX__)
     Builder* BVH8Quad4vMeshBuilderMortonGeneral (void* bvh, QuadMesh* mesh, size_t mode) { return new class BVHNMeshBuilderMorton<8,QuadMesh,Quad4v>((BVH8*)bvh,mesh,4,4); }
+#endif
+    Builder* BVH4Quad4vMeshBuilderPLOC (void* bvh, QuadMesh* mesh, size_t mode) { return new class BVHNMeshBuilderMorton<4,QuadMesh,Quad4v,BVHBuilderPLOC>((BVH4*)bvh,mesh,BVHBuilderPLOC::Settings(4,BVH4::maxBuildDepth,4,1,4,1.0f,1.0f,Builder::DEFAULT_SINGLE_THREAD_THRESHOLD)); }
+#if defined(__AVX__)
+    Builder* BVH8Quad4vMeshBuilderPLOC (void* bvh, QuadMesh* mesh, size_t mode) { return new class BVHNMeshBuilderMorton<8,QuadMesh,Quad4v,BVHBuilderPLOC>((BVH8*)bvh,mesh,BVHBuilderPLOC::Settings(8,BVH8::maxBuildDepth,4,1,4,1.0f,1.0f,Builder::DEFAULT_SINGLE_THREAD_THRESHOLD)); }
 #endif
 #endif
 
@@ -16,6 +16,8 @@
 
 #include "bvh.h"
 #include "bvh_builder.h"
+#include "bvh_rotate.h"
+#include "bvh_statistics.h"
 #include "../builders/bvh_builder_msmblur.h"
 
 #include "../builders/primrefgen.h"
@@ -24,6 +26,7 @@
 #include "../geometry/bezier1v.h"
 #include "../geometry/bezier1i.h"
 #include "../geometry/linei.h"
+#include "../geometry/pointi.h"
 #include "../geometry/triangle.h"
 #include "../geometry/trianglev.h"
 #include "../geometry/trianglev_mb.h"
@@ -54,6 +57,9 @@ namespace embree
       typedef BVHN<N> BVH;
       typedef typename BVH::NodeRef NodeRef;
 
+      /* 8- and 16-wide leaf primitives need 32 and 64 byte aligned storage */
+      static const size_t leafAlignment = __alignof(Primitive) > BVH::byteAlignment ? __alignof(Primitive) : BVH::byteAlignment;
+
       __forceinline CreateLeaf (BVH* bvh) : bvh(bvh) {}
 
       __forceinline NodeRef operator() (const PrimRef* prims, const range<size_t>& set, const FastAllocator::CachedAllocator& alloc) const
@@ -61,7 +67,7 @@ namespace embree
         size_t n = set.size();
         size_t items = Primitive::blocks(n);
         size_t start = set.begin();
-        Primitive* accel = (Primitive*) alloc.malloc1(items*sizeof(Primitive),BVH::byteAlignment);
+        Primitive* accel = (Primitive*) alloc.malloc1(items*sizeof(Primitive),leafAlignment);
         typename BVH::NodeRef node = BVH::encodeLeaf((char*)accel,items);
         for (size_t i=0; i<items; i++) {
           accel[i].fill(prims,start,set.end(),bvh->scene);
@@ -231,7 +237,12 @@ namespace embree
             /* call BVH builder */
             NodeRef root = BVHNBuilderVirtual<N>::build(&bvh->alloc,CreateLeaf<N,Primitive>(bvh),bvh->scene->progressInterface,prims.data(),pinfo,settings);
             bvh->set(root,LBBox3fa(pinfo.geomBounds),pinfo.size());
-            bvh->layoutLargeNodes(size_t(pinfo.size()*0.005f));
+
+            /* after a relayout no nodes are stored in the primref array anymore */
+            if (bvh->device->relayout && bvh->relayout())
+              settings.primrefarrayalloc = inf;
+            else
+              bvh->layoutLargeNodes(size_t(pinfo.size()*0.005f));
 
 #if PROFILE
           });
@@ -322,6 +333,7 @@ namespace embree
             NodeRef root = BVHNBuilderQuantizedVirtual<N>::build(&bvh->alloc,CreateLeafQuantized<N,Primitive>(bvh),bvh->scene->progressInterface,prims.data(),pinfo,settings);
             bvh->set(root,LBBox3fa(pinfo.geomBounds),pinfo.size());
             //bvh->layoutLargeNodes(pinfo.size()*0.005f); // FIXME: COPY LAYOUT FOR LARGE NODES !!!
+            if (bvh->device->relayout) bvh->relayout();
 #if PROFILE
           });
 #endif
@@ -438,6 +450,8 @@ namespace embree
         else
           buildMultiSegment(numPrimitives);
 
+        if (bvh->device->relayout) bvh->relayout();
+
 #if PROFILE
           });
 #endif
@@ -598,7 +612,23 @@ namespace embree
           pinfo,settings);
 
         bvh->set(root,LBBox3fa(pinfo.geomBounds),pinfo.size());
-        bvh->layoutLargeNodes(size_t(pinfo.size()*0.005f));
+
+        /* optimize the tree by restructuring small treelets */
+        if (bvh->device->restructure)
+        {
+          if (bvh->device->verbosity(2))
+          {
+            const double sah0 = BVHNStatistics<N>(bvh).sah();
+            const size_t numRestructured = BVHNRestructure<N>::restructure(bvh->root);
+            const double sah1 = BVHNStatistics<N>(bvh).sah();
+            std::cout << "restructured " << numRestructured << " treelets, sah = " << sah0 << " -> " << sah1 << std::endl;
+          }
+          else
+            BVHNRestructure<N>::restructure(bvh->root);
+        }
+
+        if (!bvh->device->relayout || !bvh->relayout())
+          bvh->layoutLargeNodes(size_t(pinfo.size()*0.005f));
 
 	/* clear temporary data for static geometry */
 	bool staticGeom = mesh ? mesh->isStatic() : scene->isStatic();
@@ -631,6 +661,15 @@ namespace embree
 #endif
 #endif
 
+#if defined(EMBREE_GEOMETRY_POINTS)
+    Builder* BVH4Point4iSceneBuilderSAH   (void* bvh, Scene* scene, size_t mode) { return new BVHNBuilderSAH<4,Points,Point4i>((BVH4*)bvh,scene,4,1.0f,4,inf,mode); }
+    Builder* BVH4Point4iMBSceneBuilderSAH (void* bvh, Scene* scene, size_t mode) { return new BVHNBuilderMBlurSAH<4,Points,Point4i>((BVH4*)bvh,scene,4,1.0f,4,inf); }
+#if defined(__AVX__)
+    Builder* BVH8Point8iSceneBuilderSAH   (void* bvh, Scene* scene, size_t mode) { return new BVHNBuilderSAH<8,Points,Point8i>((BVH8*)bvh,scene,8,1.0f,8,inf,mode); }
+    Builder* BVH8Point8iMBSceneBuilderSAH (void* bvh, Scene* scene, size_t mode) { return new BVHNBuilderMBlurSAH<8,Points,Point8i>((BVH8*)bvh,scene,8,1.0f,8,inf); }
+#endif
+#endif
+
 #if defined(EMBREE_GEOMETRY_HAIR)
     Builder* BVH4Bezier1vSceneBuilderSAH   (void* bvh, Scene* scene, size_t mode) { return new BVHNBuilderSAH<4,NativeCurves,Bezier1v>((BVH4*)bvh,scene,1,1.0f,1,inf,mode); }
     Builder* BVH4Bezier1iSceneBuilderSAH   (void* bvh, Scene* scene, size_t mode) { return new BVHNBuilderSAH<4,NativeCurves,Bezier1i>((BVH4*)bvh,scene,1,1.0f,1,inf,mode); }
@@ -671,6 +710,15 @@ namespace embree
     Builder* BVH8Triangle4SceneBuilderFastSpatialSAH  (void* bvh, Scene* scene, size_t mode) { return new BVHNBuilderFastSpatialSAH<8,TriangleMesh,Triangle4,TriangleSplitterFactory>((BVH8*)bvh,scene,4,1.0f,4,inf,mode); }
     Builder* BVH8Triangle4vSceneBuilderFastSpatialSAH  (void* bvh, Scene* scene, size_t mode) { return new BVHNBuilderFastSpatialSAH<8,TriangleMesh,Triangle4v,TriangleSplitterFactory>((BVH8*)bvh,scene,4,1.0f,4,inf,mode); }
 
+    Builder* BVH8Triangle8SceneBuilderSAH  (void* bvh, Scene* scene, size_t mode) { return new BVHNBuilderSAH<8,TriangleMesh,Triangle8>((BVH8*)bvh,scene,8,1.0f,8,inf,mode); }
+    Builder* BVH8Triangle8vSceneBuilderSAH (void* bvh, Scene* scene, size_t mode) { return new BVHNBuilderSAH<8,TriangleMesh,Triangle8v>((BVH8*)bvh,scene,8,1.0f,8,inf,mode); }
+
+#endif
+
+#if defined(__AVX512VL__)
+    Builder* BVH16Triangle4SceneBuilderSAH  (void* bvh, Scene* scene, size_t mode) { return new BVHNBuilderSAH<16,TriangleMesh,Triangle4>((BVH16*)bvh,scene,4,1.0f,4,inf,mode); }
+    Builder* BVH16Triangle4vSceneBuilderSAH (void* bvh, Scene* scene, size_t mode) { return new BVHNBuilderSAH<16,TriangleMesh,Triangle4v>((BVH16*)bvh,scene,4,1.0f,4,inf,mode); }
+    Builder* BVH16Triangle16SceneBuilderSAH (void* bvh, Scene* scene, size_t mode) { return new BVHNBuilderSAH<16,TriangleMesh,Triangle16>((BVH16*)bvh,scene,16,1.0f,16,inf,mode); }
 #endif
 #endif
 
@@ -693,6 +741,12 @@ namespace embree
     Builder* BVH8Quad4vMeshBuilderSAH     (void* bvh, QuadMesh* mesh, size_t mode)     { return new BVHNBuilderSAH<8,QuadMesh,Quad4v>((BVH8*)bvh,mesh,4,1.0f,4,inf,mode); }
     Builder* BVH8Quad4vSceneBuilderFastSpatialSAH  (void* bvh, Scene* scene, size_t mode) { return new BVHNBuilderFastSpatialSAH<8,QuadMesh,Quad4v,QuadSplitterFactory>((BVH8*)bvh,scene,4,1.0f,4,inf,mode); }
 
+    Builder* BVH8Quad8vSceneBuilderSAH     (void* bvh, Scene* scene, size_t mode) { return new BVHNBuilderSAH<8,QuadMesh,Quad8v>((BVH8*)bvh,scene,8,1.0f,8,inf,mode); }
+
+#endif
+
+#if defined(__AVX512VL__)
+    Builder* BVH16Quad4vSceneBuilderSAH     (void* bvh, Scene* scene, size_t mode) { return new BVHNBuilderSAH<16,QuadMesh,Quad4v>((BVH16*)bvh,scene,4,1.0f,4,inf,mode); }
 #endif
 #endif
 
@@ -30,13 +30,21 @@
 #define SPLIT_MEMORY_RESERVE_SCALE 2
 #define SPLIT_MIN_EXT_SPACE 1000
 
+/* full toplevel rebuild once incremental updates increased the relative surface area by this factor */
+#define INCREMENTAL_REBUILD_THRESHOLD 1.5f
+
 namespace embree
 {
   namespace isa
   {
+    static __forceinline float safeHalfArea(const BBox3fa& bounds) {
+      return bounds.empty() ? 0.0f : halfArea(bounds);
+    }
+
     template<int N, typename Mesh>
     BVHNBuilderTwoLevel<N,Mesh>::BVHNBuilderTwoLevel (BVH* bvh, Scene* scene, const createMeshAccelTy createMeshAccel, const size_t singleThreadThreshold)
-      : bvh(bvh), objects(bvh->objects), scene(scene), createMeshAccel(createMeshAccel), refs(scene->device,0), prims(scene->device,0), singleThreadThreshold(singleThreadThreshold) {}
+      : bvh(bvh), objects(bvh->objects), scene(scene), createMeshAccel(createMeshAccel), refs(scene->device,0), prims(scene->device,0), singleThreadThreshold(singleThreadThreshold),
+        topLevelArea(0.0f), topLevelCost(0.0f), topLevelValid(false) {}
     
     template<int N, typename Mesh>
     BVHNBuilderTwoLevel<N,Mesh>::~BVHNBuilderTwoLevel ()
@@ -67,15 +75,14 @@ namespace embree
       while(1) 
 #endif
       {
-      /* reset memory allocator */
-      bvh->alloc.reset();
-      
       /* skip build for empty scene */
       const size_t numPrimitives = scene->getNumPrimitives<Mesh,false>();
 
       if (numPrimitives == 0) {
+        bvh->alloc.reset();
         prims.resize(0);
         bvh->set(BVH::emptyNode,empty,0);
+        invalidateTopLevel();
         return;
       }
 
@@ -85,6 +92,8 @@ namespace embree
       if (objects.size()  < num) objects.resize(num);
       if (builders.size() < num) builders.resize(num);
       if (refs.size()     < num) refs.resize(num);
+      contributes.assign(num,0);
+      modified.assign(num,0);
       nextRef.store(0);
       
       /* create acceleration structures */
@@ -121,12 +130,15 @@ namespace embree
           Builder* builder = builders[objectID]; assert(builder);
           
           /* build object if it got modified */
-          if (mesh->isModified())
+          if (mesh->isModified()) {
             builder->build();
+            modified[objectID] = 1;
+          }
 
           /* create build primitive */
           if (!object->getBounds().empty())
           {
+            contributes[objectID] = 1;
 #if ENABLE_DIRECT_SAH_MERGE_BUILDER
             refs[nextRef++] = BVHNBuilderTwoLevel::BuildRef(object->getBounds(),object->root,(unsigned int)objectID,(unsigned int)mesh->size());
 #else
@@ -140,120 +152,140 @@ namespace embree
 #if PROFILE
       double d0 = getSeconds();
 #endif
-      /* fast path for single geometry scenes */
-      if (nextRef == 1) { 
-        bvh->set(refs[0].node,LBBox3fa(refs[0].bounds()),numPrimitives);
-      }
+      /* dynamic scenes whose set of objects did not change only update the
+       * toplevel hierarchy, as long as the BVH still references the recorded
+       * toplevel nodes and was not replaced in the meantime (e.g. by rtcLoadScene) */
+      const bool incremental = topLevelValid && bvh->root == BVH::encodeNode(topLevelNodes[0].node) && 
+        contributes == lastContributes && updateTopLevel(numPrimitives);
+      std::swap(contributes,lastContributes);
+      if (!incremental)
+      {
+        invalidateTopLevel();
 
-      else
-      {     
-        /* open all large nodes */
-        refs.resize(nextRef);
+        /* fast path for single geometry scenes */
+        if (nextRef == 1) {
+          bvh->alloc.reset();
+          bvh->set(refs[0].node,LBBox3fa(refs[0].bounds()),numPrimitives);
+        }
+
+        else
+        {     
+          /* reset memory allocator */
+          bvh->alloc.reset();
 
-        /* this probably needs some more tuning */
-        const size_t extSize = max(max((size_t)SPLIT_MIN_EXT_SPACE,refs.size()*SPLIT_MEMORY_RESERVE_SCALE),size_t((float)numPrimitives / SPLIT_MEMORY_RESERVE_FACTOR));
-        //PRINT(extSize);
+          /* open all large nodes */
+          refs.resize(nextRef);
+
+          /* this probably needs some more tuning */
+          const size_t extSize = max(max((size_t)SPLIT_MIN_EXT_SPACE,refs.size()*SPLIT_MEMORY_RESERVE_SCALE),size_t((float)numPrimitives / SPLIT_MEMORY_RESERVE_FACTOR));
+          //PRINT(extSize);
  
 #if !ENABLE_DIRECT_SAH_MERGE_BUILDER
 
 #if ENABLE_OPEN_SEQUENTIAL
-        open_sequential(extSize); 
+          open_sequential(extSize); 
 #endif
-        /* compute PrimRefs */
-        prims.resize(refs.size());
+          /* compute PrimRefs */
+          prims.resize(refs.size());
 #endif
 
-        /* calculate the size of the entire BVH */
-        const size_t node_bytes = numPrimitives*sizeof(typename BVH::AlignedNodeMB)/(4*N);
-        const size_t leaf_bytes = size_t(1.2*44*numPrimitives); // assumes triangles
-        bvh->alloc.init_estimate(node_bytes+leaf_bytes); 
+          /* calculate the size of the entire BVH */
+          const size_t node_bytes = numPrimitives*sizeof(typename BVH::AlignedNodeMB)/(4*N);
+          const size_t leaf_bytes = size_t(1.2*44*numPrimitives); // assumes triangles
+          bvh->alloc.init_estimate(node_bytes+leaf_bytes); 
 
 #if defined(TASKING_TBB) && defined(__AVX512ER__) && USE_TASK_ARENA // KNL
-        tbb::task_arena limited(min(32,(int)TaskScheduler::threadCount()));
-        limited.execute([&]
+          tbb::task_arena limited(min(32,(int)TaskScheduler::threadCount()));
+          limited.execute([&]
 #endif
-        {
+          {
 #if ENABLE_DIRECT_SAH_MERGE_BUILDER
 
-          const PrimInfo pinfo = parallel_reduce(size_t(0), refs.size(),  PrimInfo(empty), [&] (const range<size_t>& r) -> PrimInfo {
+            const PrimInfo pinfo = parallel_reduce(size_t(0), refs.size(),  PrimInfo(empty), [&] (const range<size_t>& r) -> PrimInfo {
 
-              PrimInfo pinfo(empty);
-              for (size_t i=r.begin(); i<r.end(); i++) {
-                pinfo.add_center2(refs[i]);
-              }
-              return pinfo;
-            }, [] (const PrimInfo& a, const PrimInfo& b) { return PrimInfo::merge(a,b); });
+                PrimInfo pinfo(empty);
+                for (size_t i=r.begin(); i<r.end(); i++) {
+                  pinfo.add_center2(refs[i]);
+                }
+                return pinfo;
+              }, [] (const PrimInfo& a, const PrimInfo& b) { return PrimInfo::merge(a,b); });
           
 #else
-          const PrimInfo pinfo = parallel_reduce(size_t(0), refs.size(),  PrimInfo(empty), [&] (const range<size_t>& r) -> PrimInfo {
-
-              PrimInfo pinfo(empty);
-              for (size_t i=r.begin(); i<r.end(); i++) {
-                pinfo.add(refs[i].bounds());
-                prims[i] = PrimRef(refs[i].bounds(),(size_t)refs[i].node);
-              }
-              return pinfo;
-            }, [] (const PrimInfo& a, const PrimInfo& b) { return PrimInfo::merge(a,b); });
+            const PrimInfo pinfo = parallel_reduce(size_t(0), refs.size(),  PrimInfo(empty), [&] (const range<size_t>& r) -> PrimInfo {
+
+                PrimInfo pinfo(empty);
+                for (size_t i=r.begin(); i<r.end(); i++) {
+                  pinfo.add(refs[i].bounds());
+                  prims[i] = PrimRef(refs[i].bounds(),(size_t)refs[i].node);
+                }
+                return pinfo;
+              }, [] (const PrimInfo& a, const PrimInfo& b) { return PrimInfo::merge(a,b); });
 #endif   
        
-          /* skip if all objects where empty */
-          if (pinfo.size() == 0)
-            bvh->set(BVH::emptyNode,empty,0);
+            /* skip if all objects where empty */
+            if (pinfo.size() == 0)
+              bvh->set(BVH::emptyNode,empty,0);
         
-          /* otherwise build toplevel hierarchy */
-          else
-          {
-            /* settings for BVH build */
-            GeneralBVHBuilder::Settings settings;
-            settings.branchingFactor = N;
-            settings.maxDepth = BVH::maxBuildDepthLeaf;
-            settings.logBlockSize = __bsr(N);
-            settings.minLeafSize = 1;
-            settings.maxLeafSize = 1;
-            settings.travCost = 1.0f;
-            settings.intCost = 1.0f;
-            settings.singleThreadThreshold = singleThreadThreshold;
+            /* otherwise build toplevel hierarchy */
+            else
+            {
+              /* settings for BVH build */
+              GeneralBVHBuilder::Settings settings;
+              settings.branchingFactor = N;
+              settings.maxDepth = BVH::maxBuildDepthLeaf;
+              settings.logBlockSize = __bsr(N);
+              settings.minLeafSize = 1;
+              settings.maxLeafSize = 1;
+              settings.travCost = 1.0f;
+              settings.intCost = 1.0f;
+              settings.singleThreadThreshold = singleThreadThreshold;
       
 #if ENABLE_DIRECT_SAH_MERGE_BUILDER
-            refs.resize(extSize); 
+              refs.resize(extSize); 
+              if (scene->isDynamic()) leafRefs.assign(extSize,std::make_pair(size_t(0),0u));
          
-            NodeRef root = BVHBuilderBinnedOpenMergeSAH::build<NodeRef,BuildRef>(
-              typename BVH::CreateAlloc(bvh),
-              typename BVH::AlignedNode::Create2(),
-              typename BVH::AlignedNode::Set2(),
+              NodeRef root = BVHBuilderBinnedOpenMergeSAH::build<NodeRef,BuildRef>(
+                typename BVH::CreateAlloc(bvh),
+                typename BVH::AlignedNode::Create2(),
+                typename BVH::AlignedNode::Set2(),
               
-              [&] (const BuildRef* refs, const range<size_t>& range, const FastAllocator::CachedAllocator& alloc) -> NodeRef  {
-                assert(range.size() == 1);
-                return (NodeRef) refs[range.begin()].node;
-              },
-              [&] (BuildRef &bref, BuildRef *refs) -> size_t { 
-                return openBuildRef(bref,refs);
-              },              
-              [&] (size_t dn) { bvh->scene->progressMonitor(0); },
-              refs.data(),extSize,pinfo,settings);
+                [&] (const BuildRef* refs, const range<size_t>& range, const FastAllocator::CachedAllocator& alloc) -> NodeRef  {
+                  assert(range.size() == 1);
+                  if (leafRefs.size()) leafRefs[range.begin()] = std::make_pair((size_t)refs[range.begin()].node,refs[range.begin()].geomID());
+                  return (NodeRef) refs[range.begin()].node;
+                },
+                [&] (BuildRef &bref, BuildRef *refs) -> size_t { 
+                  return openBuildRef(bref,refs);
+                },              
+                [&] (size_t dn) { bvh->scene->progressMonitor(0); },
+                refs.data(),extSize,pinfo,settings);
 #else
-            NodeRef root = BVHBuilderBinnedSAH::build<NodeRef>(
-              typename BVH::CreateAlloc(bvh),
-              typename BVH::AlignedNode::Create2(),
-              typename BVH::AlignedNode::Set2(),
+              NodeRef root = BVHBuilderBinnedSAH::build<NodeRef>(
+                typename BVH::CreateAlloc(bvh),
+                typename BVH::AlignedNode::Create2(),
+                typename BVH::AlignedNode::Set2(),
               
-              [&] (const PrimRef* pims, const range<size_t>& range, const FastAllocator::CachedAllocator& alloc) -> NodeRef {
-                assert(range.size() == 1);
-                return (NodeRef) prims[range.begin()].ID();
-              },
-              [&] (size_t dn) { bvh->scene->progressMonitor(0); },
-              prims.data(),pinfo,settings);
+                [&] (const PrimRef* pims, const range<size_t>& range, const FastAllocator::CachedAllocator& alloc) -> NodeRef {
+                  assert(range.size() == 1);
+                  return (NodeRef) prims[range.begin()].ID();
+                },
+                [&] (size_t dn) { bvh->scene->progressMonitor(0); },
+                prims.data(),pinfo,settings);
 #endif
 
             
-            bvh->set(root,LBBox3fa(pinfo.geomBounds),numPrimitives);
+              bvh->set(root,LBBox3fa(pinfo.geomBounds),numPrimitives);
+
+              /* remember toplevel hierarchy for incremental updates */
+              if (leafRefs.size()) recordTopLevel(root);
+            }
           }
-        }
 #if defined(TASKING_TBB) && defined(__AVX512ER__) && USE_TASK_ARENA // KNL
-          );
+            );
 #endif
 
-      }  
+        }
+      }
         
       bvh->alloc.cleanup();
       bvh->postBuild(t0);
@@ -271,6 +303,7 @@ namespace embree
       if (geomID >= objects.size()) return;
       delete builders[geomID]; builders[geomID] = nullptr;
       delete objects [geomID]; objects [geomID] = nullptr;
+      invalidateTopLevel();
     }
 
     template<int N, typename Mesh>
@@ -283,6 +316,16 @@ namespace embree
 	if (builders[i]) builders[i]->clear();
 
       refs.clear();
+      invalidateTopLevel();
+    }
+
+    template<int N, typename Mesh>
+    void BVHNBuilderTwoLevel<N,Mesh>::invalidateTopLevel()
+    {
+      topLevelNodes.clear();
+      topLevelSlots.clear();
+      leafRefs.clear();
+      topLevelValid = false;
     }
 
     template<int N, typename Mesh>
@@ -325,6 +368,104 @@ namespace embree
       }
     }
 
+    template<int N, typename Mesh>
+    void BVHNBuilderTwoLevel<N,Mesh>::recordTopLevel(NodeRef root)
+    {
+      topLevelNodes.clear();
+      topLevelSlots.clear();
+
+      /* the leaves of the toplevel hierarchy are nodes of the object BVHs */
+      auto end = std::remove_if(leafRefs.begin(),leafRefs.end(),[] (const std::pair<size_t,unsigned int>& ref) { return ref.first == 0; });
+      leafRefs.erase(end,leafRefs.end());
+      std::sort(leafRefs.begin(),leafRefs.end());
+      if (!root.isAlignedNode() || std::binary_search(leafRefs.begin(),leafRefs.end(),std::make_pair((size_t)root,0u),
+                                                      [] (const std::pair<size_t,unsigned int>& a, const std::pair<size_t,unsigned int>& b) { return a.first < b.first; })) {
+        leafRefs.clear();
+        return;
+      }
+
+      recordTopLevel(root,-1,0);
+      std::stable_sort(topLevelSlots.begin(),topLevelSlots.end());
+      leafRefs.clear();
+
+      /* relative surface area of the toplevel hierarchy */
+      topLevelArea = 0.0f;
+      for (size_t i=1; i<topLevelNodes.size(); i++)
+        topLevelArea += safeHalfArea(topLevelNodes[i].node->bounds());
+      const float rootArea = halfArea(root.alignedNode()->bounds());
+      topLevelCost = (topLevelArea+rootArea)/rootArea;
+      topLevelValid = true;
+    }
+
+    template<int N, typename Mesh>
+    void BVHNBuilderTwoLevel<N,Mesh>::recordTopLevel(NodeRef ref, int parent, unsigned int slot)
+    {
+      const int nodeID = (int) topLevelNodes.size();
+      AlignedNode* node = ref.alignedNode();
+      topLevelNodes.push_back(TopLevelNode(node,parent,slot));
+
+      for (unsigned int i=0; i<N; i++)
+      {
+        const NodeRef child = node->child(i);
+        if (child == BVH::emptyNode) continue;
+
+        auto leaf = std::lower_bound(leafRefs.begin(),leafRefs.end(),std::make_pair((size_t)child,0u));
+        if (leaf != leafRefs.end() && leaf->first == (size_t)child)
+          topLevelSlots.push_back(TopLevelSlot(leaf->second,nodeID,i));
+        else
+          recordTopLevel(child,nodeID,i);
+      }
+    }
+
+    template<int N, typename Mesh>
+    float BVHNBuilderTwoLevel<N,Mesh>::updateTopLevelBounds(int nodeID)
+    {
+      /* propagates the bounds of a node up to the root and returns the change of the surface area */
+      float darea = 0.0f;
+      for (int parentID = topLevelNodes[nodeID].parent; parentID >= 0; nodeID = parentID, parentID = topLevelNodes[nodeID].parent)
+      {
+        const TopLevelNode& node = topLevelNodes[nodeID];
+        const BBox3fa bounds = node.node->bounds();
+        const BBox3fa old_bounds = topLevelNodes[parentID].node->bounds(node.slot);
+        if (bounds == old_bounds) return darea;
+        darea += safeHalfArea(bounds) - safeHalfArea(old_bounds);
+        topLevelNodes[parentID].node->setBounds(node.slot,bounds);
+      }
+      return darea;
+    }
+
+    template<int N, typename Mesh>
+    bool BVHNBuilderTwoLevel<N,Mesh>::updateTopLevel(const size_t numPrimitives)
+    {
+      /* a modified object is reinserted with its new root into its first
+       * slot, all other slots that referenced the old BVH get cleared */
+      for (size_t objectID=0; objectID<modified.size(); objectID++)
+      {
+        if (!modified[objectID] || !contributes[objectID]) continue;
+
+        const BVH* object = objects[objectID];
+        auto slots = std::equal_range(topLevelSlots.begin(),topLevelSlots.end(),TopLevelSlot((unsigned int)objectID,0,0));
+        if (slots.first == slots.second) return false;
+
+        for (auto slot = slots.first; slot != slots.second; slot++)
+        {
+          AlignedNode* node = topLevelNodes[slot->node].node;
+          if (slot == slots.first) node->set(slot->slot,object->root,object->getBounds());
+          else                     node->set(slot->slot,BVH::emptyNode,BBox3fa(empty));
+          topLevelArea += updateTopLevelBounds(slot->node);
+        }
+      }
+
+      /* rebuild if the quality of the hierarchy degraded too much */
+      const BBox3fa bounds = topLevelNodes[0].node->bounds();
+      const float rootArea = halfArea(bounds);
+      if (topLevelArea+rootArea > INCREMENTAL_REBUILD_THRESHOLD*topLevelCost*rootArea)
+        return false;
+
+      bvh->set(BVH::encodeNode(topLevelNodes[0].node),LBBox3fa(bounds),numPrimitives);
+      return true;
+    }
+
 #if defined(EMBREE_GEOMETRY_LINES)    
     Builder* BVH4BuilderTwoLevelLineSegmentsSAH (void* bvh, Scene* scene, const createLineSegmentsAccelTy createMeshAccel) {
       return new BVHNBuilderTwoLevel<4,LineSegments>((BVH4*)bvh,scene,createMeshAccel);
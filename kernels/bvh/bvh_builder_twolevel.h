@@ -115,6 +115,20 @@ namespace embree
 
       void open_sequential(const size_t extSize);
 
+      /*! records the toplevel hierarchy for later incremental updates */
+      void recordTopLevel(NodeRef root);
+
+      /*! reinserts all modified objects into the toplevel hierarchy and
+       *  refits it, returns false if a full rebuild is required */
+      bool updateTopLevel(const size_t numPrimitives);
+
+      /*! drops the recorded toplevel hierarchy, its nodes may get freed by the next build */
+      void invalidateTopLevel();
+
+    private:
+      void recordTopLevel(NodeRef ref, int parent, unsigned int slot);
+      float updateTopLevelBounds(int nodeID);
+
     public:
       BVH* bvh;
       std::vector<BVH*>& objects;
@@ -131,6 +145,43 @@ namespace embree
 
       typedef mvector<BuildRef> bvector;
 
+      /*! node of the toplevel hierarchy, stores the location of the node in its parent */
+      struct TopLevelNode
+      {
+        __forceinline TopLevelNode (AlignedNode* node, int parent, unsigned int slot)
+          : node(node), parent(parent), slot(slot) {}
+
+        AlignedNode* node;
+        int parent;
+        unsigned int slot;
+      };
+
+      /*! child slot of a toplevel node that references the BVH of some object */
+      struct TopLevelSlot
+      {
+        __forceinline TopLevelSlot (unsigned int geomID, int node, unsigned int slot)
+          : geomID(geomID), node(node), slot(slot) {}
+
+        friend __forceinline bool operator< (const TopLevelSlot& a, const TopLevelSlot& b) {
+          return a.geomID < b.geomID;
+        }
+
+        unsigned int geomID;
+        int node;
+        unsigned int slot;
+      };
+
+      /* state for incremental updates of the toplevel hierarchy */
+      std::vector<std::pair<size_t,unsigned int>> leafRefs; //!< object references that became leaves of the toplevel hierarchy
+      std::vector<TopLevelNode> topLevelNodes;
+      std::vector<TopLevelSlot> topLevelSlots;                //!< sorted by geomID
+      std::vector<char> contributes;                          //!< objects referenced by the toplevel hierarchy
+      std::vector<char> lastContributes;
+      std::vector<char> modified;                             //!< objects modified since the last commit
+      float topLevelArea;                                     //!< sum of the surface areas of all toplevel nodes
+      float topLevelCost;                                     //!< relative surface area after the last full build
+      bool topLevelValid;
+
     };
   }
 }
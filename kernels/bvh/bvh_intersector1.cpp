@@ -28,6 +28,7 @@
 #include "../geometry/bezier1v_intersector.h"
 #include "../geometry/bezier1i_intersector.h"
 #include "../geometry/linei_intersector.h"
+#include "../geometry/pointi_intersector.h"
 #include "../geometry/subdivpatch1eager_intersector.h"
 #include "../geometry/subdivpatch1cached_intersector.h"
 #include "../geometry/object_intersector.h"
@@ -66,6 +67,7 @@ namespace embree
 
       /*! initialize the node traverser */
       BVHNNodeTraverser1<N,Nx,types> nodeTraverser(vray);
+      TraversalCounters counters(1);
 
       /* pop loop */
       while (true) pop:
@@ -93,6 +95,7 @@ namespace embree
           STAT3(normal.trav_nodes,1,1,1);
           bool nodeIntersected = BVHNNodeIntersector1<N,Nx,types,robust>::intersect(cur,vray,ray_near,ray_far,ray.time,tNear,mask);
           if (unlikely(!nodeIntersected)) { STAT3(normal.trav_nodes,-1,-1,-1); break; }
+          counters.nodes++;
 
           /*! if no child is hit, pop next node */
           if (unlikely(mask == 0))
@@ -110,6 +113,8 @@ namespace embree
         assert(cur != BVH::emptyNode);
         STAT3(normal.trav_leaves,1,1,1);
         size_t num; Primitive* prim = (Primitive*) cur.leaf(num);
+        counters.leaves++;
+        counters.primitives += num;
         size_t lazy_node = 0;
         PrimitiveIntersector1::intersect(pre,ray,context,prim,num,lazy_node);
         ray_far = ray.tfar;
@@ -121,6 +126,7 @@ namespace embree
           stackPtr++;
         }
       }
+      context->addStats(counters);
       AVX_ZERO_UPPER();
     }
 
@@ -159,6 +165,7 @@ namespace embree
 
       /*! initialize the node traverser */
       BVHNNodeTraverser1<N,Nx,types> nodeTraverser(vray);
+      TraversalCounters counters(1);
 
       /* pop loop */
       while (true) pop:
@@ -176,6 +183,7 @@ namespace embree
           STAT3(shadow.trav_nodes,1,1,1);
           bool nodeIntersected = BVHNNodeIntersector1<N,Nx,types,robust>::intersect(cur,vray,ray_near,ray_far,ray.time,tNear,mask);
           if (unlikely(!nodeIntersected)) { STAT3(shadow.trav_nodes,-1,-1,-1); break; }
+          counters.nodes++;
 
           /*! if no child is hit, pop next node */
           if (unlikely(mask == 0))
@@ -193,9 +201,12 @@ namespace embree
         assert(cur != BVH::emptyNode);
         STAT3(shadow.trav_leaves,1,1,1);
         size_t num; Primitive* prim = (Primitive*) cur.leaf(num);
+        counters.leaves++;
+        counters.primitives += num;
         size_t lazy_node = 0;
         if (PrimitiveIntersector1::occluded(pre,ray,context,prim,num,lazy_node)) {
           ray.geomID = 0;
+          counters.earlyExits++;
           break;
         }
 
@@ -205,6 +216,7 @@ namespace embree
           stackPtr++;
         }
       }
+      context->addStats(counters);
       AVX_ZERO_UPPER();
     }
   }
@@ -28,6 +28,7 @@
 #include "../geometry/bezier1v_intersector.h"
 #include "../geometry/bezier1i_intersector.h"
 #include "../geometry/linei_intersector.h"
+#include "../geometry/pointi_intersector.h"
 #include "../geometry/subdivpatch1eager_intersector.h"
 #include "../geometry/subdivpatch1cached_intersector.h"
 #include "../geometry/object_intersector.h"
@@ -66,6 +67,7 @@ namespace embree
       /*! load the ray into SIMD registers */
       TravRay<N,Nx> vray(k,ray_org,ray_dir,ray_rdir,nearXYZ);
       vfloat<Nx> ray_near(ray_tnear[k]), ray_far(ray_tfar[k]);
+      TraversalCounters counters;
 
       /* pop loop */
       while (true) pop:
@@ -91,6 +93,7 @@ namespace embree
           /*! stop if we found a leaf node */
           if (unlikely(cur.isLeaf())) break;
           STAT3(normal.trav_nodes,1,1,1);
+          counters.nodes++;
 
           /* intersect node */
           size_t mask = 0;
@@ -109,6 +112,8 @@ namespace embree
         assert(cur != BVH::emptyNode);
         STAT3(normal.trav_leaves, 1, 1, 1);
         size_t num; Primitive* prim = (Primitive*)cur.leaf(num);
+        counters.leaves++;
+        counters.primitives += num;
 
         size_t lazy_node = 0;
         PrimitiveIntersectorK::intersect(pre, ray, k, context, prim, num, lazy_node);
@@ -121,6 +126,7 @@ namespace embree
           stackPtr++;
         }
       }
+      context->addStats(counters);
     }
 
     template<int N, int K, int types, bool robust, typename PrimitiveIntersectorK, bool single>
@@ -153,6 +159,7 @@ namespace embree
       assert(all(valid,ray.tnear >= 0.0f));
       assert(!(types & BVH_MB) || all(valid,(ray.time >= 0.0f) & (ray.time <= 1.0f)));
       Precalculations pre(valid,ray);
+      TraversalCounters counters(popcnt(valid));
 
       /* load ray */
       Vec3vf<K> ray_org = ray.org;
@@ -252,6 +259,7 @@ namespace embree
             /* process nodes */
             const vbool<K> valid_node = ray_tfar > curDist;
             STAT3(normal.trav_nodes,1,popcnt(valid_node),K);
+            counters.nodes++;
             const NodeRef nodeRef = cur;
             const BaseNode* __restrict__ const node = nodeRef.baseNode(types);
 
@@ -353,6 +361,8 @@ namespace embree
           STAT3(normal.trav_leaves,1,popcnt(valid_leaf),K);
           if (unlikely(none(valid_leaf))) continue;
           size_t items; const Primitive* prim = (Primitive*) cur.leaf(items);
+          counters.leaves++;
+          counters.primitives += items;
 
           size_t lazy_node = 0;
           PrimitiveIntersectorK::intersect(valid_leaf,pre,ray,context,prim,items,lazy_node);
@@ -365,6 +375,7 @@ namespace embree
         }
       } while(valid_bits);
 
+      context->addStats(counters);
       AVX_ZERO_UPPER();
     }
 
@@ -392,6 +403,7 @@ namespace embree
       assert(all(valid,ray.tnear >= 0.0f));
       assert(!(types & BVH_MB) || all(valid,(ray.time >= 0.0f) & (ray.time <= 1.0f)));
       Precalculations pre(valid,ray);
+      TraversalCounters counters(popcnt(valid));
 
       /* load ray */
       Vec3vf<K> ray_org = ray.org;
@@ -443,6 +455,7 @@ namespace embree
 
             vfloat<Nx> fmin;
             size_t m_frusta_node = frustum.intersect(node,fmin);
+            counters.nodes++;
 
             if (unlikely(!m_frusta_node)) goto pop;
             cur = BVH::emptyNode;
@@ -510,6 +523,8 @@ namespace embree
           STAT3(normal.trav_leaves,1,popcnt(valid_leaf),K);
           if (unlikely(none(valid_leaf))) continue;
           size_t items; const Primitive* prim = (Primitive*) cur.leaf(items);
+          counters.leaves++;
+          counters.primitives += items;
 
           size_t lazy_node = 0;
           PrimitiveIntersectorK::intersect(valid_leaf,pre,ray,context,prim,items,lazy_node);
@@ -530,6 +545,7 @@ namespace embree
         
       } while(valid_bits);
 
+      context->addStats(counters);
       AVX_ZERO_UPPER();
     }
 
@@ -551,6 +567,7 @@ namespace embree
 	/*! load the ray into SIMD registers */
         TravRay<N,Nx> vray(k,ray_org,ray_dir,ray_rdir,nearXYZ);
         const vfloat<Nx> ray_near(ray_tnear[k]), ray_far(ray_tfar[k]);
+        TraversalCounters counters;
 
 	/* pop loop */
 	while (true) pop:
@@ -566,6 +583,7 @@ namespace embree
             /*! stop if we found a leaf node */
             if (unlikely(cur.isLeaf())) break;
             STAT3(shadow.trav_nodes,1,1,1);
+            counters.nodes++;
 
             /* intersect node */
             size_t mask = 0;
@@ -584,10 +602,13 @@ namespace embree
           assert(cur != BVH::emptyNode);
 	  STAT3(shadow.trav_leaves,1,1,1);
 	  size_t num; Primitive* prim = (Primitive*) cur.leaf(num);
+          counters.leaves++;
+          counters.primitives += num;
 
           size_t lazy_node = 0;
           if (PrimitiveIntersectorK::occluded(pre,ray,k,context,prim,num,lazy_node)) {
 	    ray.geomID[k] = 0;
+            context->addStats(counters);
 	    return true;
 	  }
 
@@ -596,6 +617,7 @@ namespace embree
             stackPtr++;
           }
 	}
+        context->addStats(counters);
 	return false;
       }
 
@@ -628,6 +650,7 @@ namespace embree
       assert(all(valid,ray.tnear >= 0.0f));
       assert(!(types & BVH_MB) || all(valid,(ray.time >= 0.0f) & (ray.time <= 1.0f)));
       Precalculations pre(valid,ray);
+      TraversalCounters counters(popcnt(valid));
 
       /* load ray */
       vbool<K> terminated = !valid;
@@ -704,6 +727,7 @@ namespace embree
           /* process nodes */
           const vbool<K> valid_node = ray_tfar > curDist;
           STAT3(shadow.trav_nodes,1,popcnt(valid_node),K);
+          counters.nodes++;
           const NodeRef nodeRef = cur;
           const BaseNode* __restrict__ const node = nodeRef.baseNode(types);
 
@@ -775,6 +799,8 @@ namespace embree
         STAT3(shadow.trav_leaves,1,popcnt(valid_leaf),K);
         if (unlikely(none(valid_leaf))) continue;
         size_t items; const Primitive* prim = (Primitive*) cur.leaf(items);
+        counters.leaves++;
+        counters.primitives += items;
 
         size_t lazy_node = 0;
         terminated |= PrimitiveIntersectorK::occluded(!terminated,pre,ray,context,prim,items,lazy_node);
@@ -787,6 +813,8 @@ namespace embree
         }
       }
       vint<K>::store(valid & terminated,&ray.geomID,0);
+      counters.earlyExits += popcnt(valid & terminated);
+      context->addStats(counters);
       AVX_ZERO_UPPER();
     }
 
@@ -812,6 +840,7 @@ namespace embree
       assert(all(valid,ray.tnear >= 0.0f));
       assert(!(types & BVH_MB) || all(valid,(ray.time >= 0.0f) & (ray.time <= 1.0f)));
       Precalculations pre(valid,ray);
+      TraversalCounters counters(popcnt(valid));
 
       /* load ray */
       vbool<K> terminated = !valid;
@@ -867,6 +896,7 @@ namespace embree
 
             vfloat<Nx> fmin;
             size_t m_frusta_node = frustum.intersect(node,fmin);
+            counters.nodes++;
 
             if (unlikely(!m_frusta_node)) goto pop;
             cur = BVH::emptyNode;
@@ -910,6 +940,8 @@ namespace embree
 #endif
           if (unlikely(!m_active)) continue;
           size_t items; const Primitive* prim = (Primitive*) cur.leaf(items);
+          counters.leaves++;
+          counters.primitives += items;
 
           size_t lazy_node = 0;
           terminated |= PrimitiveIntersectorK::occluded(!terminated,pre,ray,context,prim,items,lazy_node);
@@ -926,6 +958,8 @@ namespace embree
       } while(valid_bits);
       vint<K>::store(valid & terminated,&ray.geomID,0);
 
+      counters.earlyExits += popcnt(valid & terminated);
+      context->addStats(counters);
       AVX_ZERO_UPPER();
     }
 
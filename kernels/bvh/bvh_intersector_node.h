@@ -214,6 +214,28 @@ namespace embree
 
 #endif
 
+#if defined(__AVX512VL__) // SKX
+
+    template<>
+      __forceinline size_t intersectNode<16,16>(const typename BVH16::AlignedNode* node, const TravRay<16,16>& ray,
+                                                const vfloat16& tnear, const vfloat16& tfar, vfloat16& dist)
+    {
+      const vfloat16 tNearX = msub(vfloat16::load((float*)((const char*)&node->lower_x+ray.nearX)), ray.rdir.x, ray.org_rdir.x);
+      const vfloat16 tNearY = msub(vfloat16::load((float*)((const char*)&node->lower_x+ray.nearY)), ray.rdir.y, ray.org_rdir.y);
+      const vfloat16 tNearZ = msub(vfloat16::load((float*)((const char*)&node->lower_x+ray.nearZ)), ray.rdir.z, ray.org_rdir.z);
+      const vfloat16 tFarX  = msub(vfloat16::load((float*)((const char*)&node->lower_x+ray.farX )), ray.rdir.x, ray.org_rdir.x);
+      const vfloat16 tFarY  = msub(vfloat16::load((float*)((const char*)&node->lower_x+ray.farY )), ray.rdir.y, ray.org_rdir.y);
+      const vfloat16 tFarZ  = msub(vfloat16::load((float*)((const char*)&node->lower_x+ray.farZ )), ray.rdir.z, ray.org_rdir.z);
+      const vfloat16 tNear  = maxi(tNearX,tNearY,tNearZ,tnear);
+      const vfloat16 tFar   = mini(tFarX ,tFarY ,tFarZ ,tfar);
+      const vbool16 vmask   = asInt(tNear) <= asInt(tFar);
+      const size_t mask     = movemask(vmask);
+      dist = tNear;
+      return mask;
+    }
+
+#endif
+
 #if defined(__AVX512F__) && !defined(__AVX512VL__) // KNL
 
     template<>
@@ -889,6 +911,34 @@ namespace embree
     
 #endif
 
+    template<int N, int K>
+      __forceinline vbool<K> intersectNode(const typename BVHN<N>::QuantizedNode* node, size_t i, 
+                                           const Vec3vf<K>& org, const Vec3vf<K>& dir, const Vec3vf<K>& rdir, const Vec3vf<K>& org_rdir,
+                                           const vfloat<K>& tnear, const vfloat<K>& tfar, vfloat<K>& dist)
+    {
+      const BBox3fa bounds = node->bounds(i);
+#if defined(__AVX2__)
+      const vfloat<K> lclipMinX = msub(bounds.lower.x,rdir.x,org_rdir.x);
+      const vfloat<K> lclipMinY = msub(bounds.lower.y,rdir.y,org_rdir.y);
+      const vfloat<K> lclipMinZ = msub(bounds.lower.z,rdir.z,org_rdir.z);
+      const vfloat<K> lclipMaxX = msub(bounds.upper.x,rdir.x,org_rdir.x);
+      const vfloat<K> lclipMaxY = msub(bounds.upper.y,rdir.y,org_rdir.y);
+      const vfloat<K> lclipMaxZ = msub(bounds.upper.z,rdir.z,org_rdir.z);
+#else
+      const vfloat<K> lclipMinX = (bounds.lower.x - org.x) * rdir.x;
+      const vfloat<K> lclipMinY = (bounds.lower.y - org.y) * rdir.y;
+      const vfloat<K> lclipMinZ = (bounds.lower.z - org.z) * rdir.z;
+      const vfloat<K> lclipMaxX = (bounds.upper.x - org.x) * rdir.x;
+      const vfloat<K> lclipMaxY = (bounds.upper.y - org.y) * rdir.y;
+      const vfloat<K> lclipMaxZ = (bounds.upper.z - org.z) * rdir.z;
+#endif
+      const vfloat<K> lnearP = maxi(mini(lclipMinX, lclipMaxX), mini(lclipMinY, lclipMaxY), mini(lclipMinZ, lclipMaxZ));
+      const vfloat<K> lfarP  = mini(maxi(lclipMinX, lclipMaxX), maxi(lclipMinY, lclipMaxY), maxi(lclipMinZ, lclipMaxZ));
+      const vbool<K> lhit    = maxi(lnearP, tnear) <= mini(lfarP, tfar);
+      dist = lnearP;
+      return lhit;
+    }
+
     //////////////////////////////////////////////////////////////////////////////////////
     // fast ray/BVHN::UnalignedNode intersection
     //////////////////////////////////////////////////////////////////////////////////////
@@ -1196,6 +1246,17 @@ namespace embree
       }
     };
 
+    template<int N, int K>
+      struct BVHNNodeIntersectorK<N,K,BVH_QN1,false>
+    {
+      static __forceinline bool intersect(const typename BVHN<N>::NodeRef& node, const size_t i, const Vec3vf<K>& org, const Vec3vf<K>& dir, const Vec3vf<K>& rdir, const Vec3vf<K>& org_rdir,
+                                          const vfloat<K>& tnear, const vfloat<K>& tfar, const vfloat<K>& time, vfloat<K>& dist, vbool<K>& vmask)
+      {
+        vmask = intersectNode<N,K>((const typename BVHN<N>::QuantizedNode*)node.quantizedNode(),i,org,dir,rdir,org_rdir,tnear,tfar,dist);
+        return true;
+      }
+    };
+
     template<int N, int K>
     struct BVHNNodeIntersectorK<N,K,BVH_AN2,false>
     {
@@ -27,6 +27,7 @@
 #include "../geometry/bezier1v_intersector.h"
 #include "../geometry/bezier1i_intersector.h"
 #include "../geometry/linei_intersector.h"
+#include "../geometry/pointi_intersector.h"
 #include "../geometry/subdivpatch1eager_intersector.h"
 #include "../geometry/subdivpatch1cached_intersector.h"
 #include "../geometry/object_intersector.h"
@@ -66,6 +67,7 @@ namespace embree
         return;
       }
 
+      TraversalCounters counters(std::bitset<64>(m_active).count());
       stack[0].mask    = m_active;
       stack[0].parent  = 0;
       stack[0].child   = bvh->root;
@@ -98,6 +100,7 @@ namespace embree
           for (size_t i = 0; i < N; i++) maskK[i] = m_trav_active;
           vfloat<Nx> dist;
           const size_t m_node_hit = traverseCoherentStream(m_trav_active, packet, node, frusta, maskK, dist);
+          counters.nodes++;
           if (unlikely(m_node_hit == 0)) goto pop;
 
           BVHNNodeTraverserStreamHitCoherent<N, Nx, types>::traverseClosestHit(cur, m_trav_active, vbool<Nx>((int)m_node_hit), dist, (size_t*)maskK, stackPtr);
@@ -124,6 +127,8 @@ namespace embree
         assert(cur != BVH::emptyNode);
         STAT3(normal.trav_leaves, 1, 1, 1);
         size_t num; Primitive* prim = (Primitive*)cur.leaf(num);
+        counters.leaves++;
+        counters.primitives += num;
 
         size_t bits = m_trav_active;
 
@@ -146,6 +151,7 @@ namespace embree
         };
 
       } // traversal + intersection
+      context->addStats(counters);
     }
 
     template<int N, int Nx, int K, int types, bool robust, typename PrimitiveIntersector>
@@ -175,6 +181,7 @@ namespace embree
         return;
       }
 
+      TraversalCounters counters(std::bitset<64>(m_active).count());
       stack[0].mask    = m_active;
       stack[0].parent  = 0;
       stack[0].child   = bvh->root;
@@ -209,6 +216,7 @@ namespace embree
 
           vfloat<Nx> dist;
           const size_t m_node_hit = traverseCoherentStream(m_trav_active, packet, node, frusta, maskK, dist);
+          counters.nodes++;
           if (unlikely(m_node_hit == 0)) goto pop;
 
           BVHNNodeTraverserStreamHitCoherent<N, Nx, types>::traverseAnyHit(cur, m_trav_active, vbool<Nx>((int)m_node_hit), (size_t*)maskK, stackPtr);
@@ -231,6 +239,8 @@ namespace embree
         assert(cur != BVH::emptyNode);
         STAT3(normal.trav_leaves, 1, 1, 1);
         size_t num; Primitive* prim = (Primitive*)cur.leaf(num);
+        counters.leaves++;
+        counters.primitives += num;
 
         size_t bits = m_trav_active & m_active;
         /*! intersect stream of rays with all primitives */
@@ -252,6 +262,8 @@ namespace embree
         }
 
       } // traversal + intersection
+      counters.earlyExits = counters.rays - std::bitset<64>(m_active).count();
+      context->addStats(counters);
     }
 
     ////////////////////////////////////////////////////////////////////////////////
@@ -269,6 +281,20 @@ namespace embree
     typedef ArrayIntersectorKStream<VSIZEX,QuadMvIntersectorKPluecker<4 COMMA VSIZEX COMMA true > > Quad4vIntersectorStreamPluecker;
     typedef ArrayIntersectorKStream<VSIZEX,QuadMiIntersectorKPluecker<4 COMMA VSIZEX COMMA true > > Quad4iIntersectorStreamPluecker;
     typedef ArrayIntersectorKStream<VSIZEX,ObjectIntersectorK<VSIZEX COMMA false > > ObjectIntersectorStream;
+    typedef ArrayIntersectorKStream<VSIZEX,PointMiIntersectorK<4 COMMA VSIZEX COMMA true > > Point4iIntersectorStream;
+#if defined(__AVX__)
+    typedef ArrayIntersectorKStream<VSIZEX,PointMiIntersectorK<8 COMMA VSIZEX COMMA true > > Point8iIntersectorStream;
+    typedef ArrayIntersectorKStream<VSIZEX,TriangleMIntersectorKMoeller<8 COMMA VSIZEX COMMA VSIZEX COMMA true > > Triangle8IntersectorStreamMoeller;
+    typedef ArrayIntersectorKStream<VSIZEX,TriangleMIntersectorKMoeller<8 COMMA VSIZEX COMMA VSIZEX COMMA false > > Triangle8IntersectorStreamMoellerNoFilter;
+    typedef ArrayIntersectorKStream<VSIZEX,TriangleMvIntersectorKPluecker<8 COMMA VSIZEX COMMA VSIZEX COMMA true > > Triangle8vIntersectorStreamPluecker;
+    typedef ArrayIntersectorKStream<VSIZEX,QuadMvIntersectorKMoeller<8 COMMA VSIZEX COMMA true > > Quad8vIntersectorStreamMoeller;
+    typedef ArrayIntersectorKStream<VSIZEX,QuadMvIntersectorKMoeller<8 COMMA VSIZEX COMMA false > > Quad8vIntersectorStreamMoellerNoFilter;
+    typedef ArrayIntersectorKStream<VSIZEX,QuadMvIntersectorKPluecker<8 COMMA VSIZEX COMMA true > > Quad8vIntersectorStreamPluecker;
+#endif
+#if defined(__AVX512F__)
+    typedef ArrayIntersectorKStream<VSIZEX,TriangleMIntersectorKMoeller<16 COMMA VSIZEX COMMA VSIZEX COMMA true > > Triangle16IntersectorStreamMoeller;
+    typedef ArrayIntersectorKStream<VSIZEX,TriangleMIntersectorKMoeller<16 COMMA VSIZEX COMMA VSIZEX COMMA false > > Triangle16IntersectorStreamMoellerNoFilter;
+#endif
 
 
     // =====================================================================================================
@@ -46,6 +46,9 @@ namespace embree
       typedef typename BVH::NodeRef NodeRef;
       typedef typename BVH::BaseNode BaseNode;
 
+      /*! the lowest bits of the sorted distances store the child index */
+      static const int index_mask = (N <= 8) ? 0x7 : 0xf;
+
     public:
       template<class T>
       static __forceinline void traverseClosestHit(NodeRef& cur,
@@ -62,7 +65,7 @@ namespace embree
 
         /*! one child is hit, continue with that child */
         const size_t r0 = __bscf(mask);          
-        assert(r0 < 8);
+        assert(r0 < N);
         cur = node->child(r0);         
         cur.prefetch(types);
         m_trav_active = tMask[r0];        
@@ -75,7 +78,7 @@ namespace embree
         NodeRef c0 = cur; 
         unsigned int d0 = tNear_i[r0];
         const size_t r1 = __bscf(mask);
-        assert(r1 < 8);
+        assert(r1 < N);
         NodeRef c1 = node->child(r1); 
         c1.prefetch(types); 
         unsigned int d1 = tNear_i[r1];
@@ -107,20 +110,20 @@ namespace embree
 
         /*! slow path for more than two hits */
         size_t hits = movemask(vmask);
-        const vint<Nx> dist_i = select(vmask, (asInt(tNear) & 0xfffffff8) | vint<Nx>(step), 0);
+        const vint<Nx> dist_i = select(vmask, (asInt(tNear) & ~index_mask) | vint<Nx>(step), 0);
 #if defined(__AVX512F__) && !defined(__AVX512VL__) // KNL
         const vint<N> tmp = extractN<N,0>(dist_i);
         const vint<Nx> dist_i_sorted = usort_descending(tmp);
 #else
         const vint<Nx> dist_i_sorted = usort_descending(dist_i);
 #endif
-        const vint<Nx> sorted_index = dist_i_sorted & 7;
+        const vint<Nx> sorted_index = dist_i_sorted & index_mask;
 
         size_t i = 0;
         for (;;)
         {
           const unsigned int index = sorted_index[i];
-          assert(index < 8);
+          assert(index < N);
           cur = node->child(index);
           m_trav_active = tMask[index];
           assert(m_trav_active);
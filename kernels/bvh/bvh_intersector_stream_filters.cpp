@@ -16,6 +16,7 @@
 
 #include "bvh_intersector_stream_filters.h"
 #include "bvh_intersector_stream.h"
+#include "../../common/algorithms/parallel_sort.h"
 
 namespace embree
 {
@@ -23,6 +24,79 @@ namespace embree
   {
     MAYBE_UNUSED static const size_t MAX_PACKET_STREAM_SIZE = MAX_INTERNAL_STREAM_SIZE / VSIZEX;
 
+    /*! incoherent streams get only sorted if they contain at least this many rays */
+    static const size_t MIN_SORTED_STREAM_SIZE = 4*VSIZEX;
+
+    /*! number of rays that get sorted together */
+    static const size_t MAX_SORTED_STREAM_SIZE = 1024;
+
+    /*! sort key and index of a ray, compatible with radixsort32 */
+    struct __aligned(8) RaySortKey
+    {
+      unsigned int code;  //!< direction octant and morton code of the origin
+      unsigned int index; //!< i'th ray of the stream
+
+      /*! interface for radix sort */
+      __forceinline operator unsigned() const { return code; }
+
+      /*! interface for standard sort */
+      __forceinline bool operator<(const RaySortKey& k) const { return code < k.code; }
+    };
+
+    __noinline void RayStreamFilter::filterSorted(Scene* scene, RTCRay** _rayN, size_t N, IntersectContext* context, bool intersect)
+    {
+      assert(N <= MAX_SORTED_STREAM_SIZE);
+      Ray** rays = (Ray**) _rayN;
+      __aligned(64) RaySortKey keys[MAX_SORTED_STREAM_SIZE];
+      Ray* sorted[MAX_SORTED_STREAM_SIZE];
+
+      /* compute bounds of ray origins */
+      BBox3fa bounds(empty);
+      for (size_t i=0; i<N; i++)
+        bounds.extend(rays[i]->org);
+
+      /* map origins to a 10 bit lattice per dimension */
+      const vfloat4 base = (vfloat4)bounds.lower;
+      const vfloat4 diag = (vfloat4)bounds.upper - (vfloat4)bounds.lower;
+      const vfloat4 scale = select(diag > vfloat4(1E-19f), rcp(diag) * vfloat4(1024.0f * 0.99f), vfloat4(0.0f));
+
+      /* the direction octant forms the 3 highest bits of the key, followed by the 29 highest bits of the origin morton code */
+      for (size_t i=0; i<N; i++)
+      {
+        const Ray& ray = *rays[i];
+        const vint4 binID = vint4(((vfloat4)ray.org-base)*scale);
+        const unsigned int x = extract<0>(binID);
+        const unsigned int y = extract<1>(binID);
+        const unsigned int z = extract<2>(binID);
+        const unsigned int morton = bitInterleave(x,y,z);
+        const unsigned int octant = (ray.dir.x < 0.0f ? 1 : 0) | (ray.dir.y < 0.0f ? 2 : 0) | (ray.dir.z < 0.0f ? 4 : 0);
+        keys[i].code = (octant << 29) | (morton >> 1);
+        keys[i].index = (unsigned int)i;
+      }
+      radixsort32(keys,N);
+
+      for (size_t i=0; i<N; i++)
+        sorted[i] = rays[keys[i].index];
+
+      /* trace packets of neighboring rays and scatter the hits back through the ray pointers */
+      RayStreamAOP rayN(sorted);
+      for (size_t i=0; i<N; i+=VSIZEX)
+      {
+        const vintx vi = vintx(int(i)) + vintx(step);
+        vboolx valid = vi < vintx(int(N));
+
+        RayK<VSIZEX> ray = rayN.getRayByIndex(valid, i);
+        valid &= ray.tnear <= ray.tfar;
+
+        if (intersect)
+          scene->intersectors.intersect(valid, ray, context);
+        else
+          scene->intersectors.occluded(valid, ray, context);
+
+        rayN.setHitByIndex(valid, i, ray, intersect);
+      }
+    }
+
     __forceinline void RayStreamFilter::filterAOS(Scene* scene, RTCRay* _rayN, size_t N, size_t stride, IntersectContext* context, bool intersect)
     {
       RayStreamAOS rayN(_rayN);
@@ -70,6 +144,19 @@ namespace embree
           }
         }
       }
+      else if (isSortRays(context->user->flags) && N >= MIN_SORTED_STREAM_SIZE)
+      {
+        /* sort large incoherent streams into coherent packets */
+        RTCRay* rays[MAX_SORTED_STREAM_SIZE];
+
+        for (size_t i = 0; i < N; i += MAX_SORTED_STREAM_SIZE)
+        {
+          const size_t size = min(N - i, MAX_SORTED_STREAM_SIZE);
+          for (size_t j = 0; j < size; j++)
+            rays[j] = (RTCRay*)((char*)_rayN + (i+j)*stride);
+          filterSorted(scene, rays, size, context, intersect);
+        }
+      }
       else
       {
         /* fallback to packets */
@@ -138,6 +225,12 @@ namespace embree
           }
         }
       }
+      else if (isSortRays(context->user->flags) && N >= MIN_SORTED_STREAM_SIZE)
+      {
+        /* sort large incoherent streams into coherent packets */
+        for (size_t i = 0; i < N; i += MAX_SORTED_STREAM_SIZE)
+          filterSorted(scene, _rayN + i, min(N - i, MAX_SORTED_STREAM_SIZE), context, intersect);
+      }
       else
       {
         /* fallback to packets */
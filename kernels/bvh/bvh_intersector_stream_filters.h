@@ -31,6 +31,9 @@ namespace embree
       static void filterAOP(Scene* scene, RTCRay** rays, size_t N, IntersectContext* context, bool intersect);
       static void filterSOA(Scene* scene, char* rays, size_t N, size_t numPackets, size_t stride, IntersectContext* context, bool intersect);
       static void filterSOP(Scene* scene, const RTCRayNp& rays, size_t N, IntersectContext* context, bool intersect);
+
+    private:
+      static void filterSorted(Scene* scene, RTCRay** rays, size_t N, IntersectContext* context, bool intersect);
     };
   }
 };
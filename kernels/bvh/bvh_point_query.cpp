@@ -0,0 +1,269 @@
+// ======================================================================== //
+// Copyright 2009-2017 Intel Corporation                                    //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ======================================================================== //
+
+#include "bvh.h"
+#include "bvh_traverser1.h"
+#include "../common/scene.h"
+#include "../geometry/triangle.h"
+#include "../geometry/trianglev.h"
+#include "../geometry/trianglei.h"
+#include "../geometry/quadv.h"
+#include "../geometry/quadi.h"
+#include "../geometry/linei.h"
+#include "../geometry/pointi.h"
+#include "../geometry/object.h"
+#include "../geometry/closest_point.h"
+
+namespace embree
+{
+  namespace isa
+  {
+    /*! node types traversed by point queries */
+    static const int pointQueryTypes = BVH_AN1_UN1 | BVH_QN1;
+
+    /*! Computes lower bounds of the squared distances of the query
+     *  position to the children of a node, returns the mask of all
+     *  children that overlap the query sphere. */
+    template<int N>
+      __forceinline size_t pointQueryNode(const typename BVHN<N>::NodeRef& cur, const Vec3vf<N>& p, const vfloat<N>& radius2, vfloat<N>& dist2)
+    {
+      if (likely(cur.isAlignedNode()))
+      {
+        const typename BVHN<N>::AlignedNode* node = cur.alignedNode();
+        const Vec3vf<N> lower(node->lower_x,node->lower_y,node->lower_z);
+        const Vec3vf<N> upper(node->upper_x,node->upper_y,node->upper_z);
+        const Vec3vf<N> d = max(max(lower-p,p-upper),Vec3vf<N>(zero));
+        dist2 = dot(d,d);
+        return movemask((lower.x <= upper.x) & (dist2 <= radius2));
+      }
+      else if (cur.isQuantizedNode())
+      {
+        const typename BVHN<N>::QuantizedNode* node = cur.quantizedNode();
+        const Vec3vf<N> lower(node->dequantizeLowerX(),node->dequantizeLowerY(),node->dequantizeLowerZ());
+        const Vec3vf<N> upper(node->dequantizeUpperX(),node->dequantizeUpperY(),node->dequantizeUpperZ());
+        const Vec3vf<N> d = max(max(lower-p,p-upper),Vec3vf<N>(zero));
+        dist2 = dot(d,d);
+        return movemask((lower.x <= upper.x) & (dist2 <= radius2));
+      }
+      else
+      {
+        /* the box is the intersection of 3 slabs, the distance to each
+         * slab in world space is a lower bound of the distance to the box */
+        const AffineSpace3vf<N>& naabb = cur.unalignedNode()->naabb;
+        const Vec3vf<N> q = xfmPoint(naabb,p);
+        const Vec3vf<N> d = max(max(-q,q-Vec3vf<N>(one)),Vec3vf<N>(zero));
+        const vfloat<N> sx = sqr(naabb.l.vx.x) + sqr(naabb.l.vy.x) + sqr(naabb.l.vz.x);
+        const vfloat<N> sy = sqr(naabb.l.vx.y) + sqr(naabb.l.vy.y) + sqr(naabb.l.vz.y);
+        const vfloat<N> sz = sqr(naabb.l.vx.z) + sqr(naabb.l.vy.z) + sqr(naabb.l.vz.z);
+        dist2 = max(sqr(d.x)/sx,sqr(d.y)/sy,sqr(d.z)/sz);
+        return movemask(dist2 <= radius2);
+      }
+    }
+
+    template<int M>
+      __forceinline void pointQueryPrimitives(RTCPointQuery& query, const Vec3vf<M>& p, const TriangleM<M>* prims, size_t num, const Scene* scene)
+    {
+      for (size_t i=0; i<num; i++)
+      {
+        const TriangleM<M>& tri = prims[i];
+        const Vec3vf<M> q = closestPointTriangle(p,tri.v0,tri.v0-tri.e1,tri.v0+tri.e2);
+        updatePointQuery(query,p,tri.valid(),q,tri.geomID(),tri.primID());
+      }
+    }
+
+    template<int M>
+      __forceinline void pointQueryPrimitives(RTCPointQuery& query, const Vec3vf<M>& p, const TriangleMv<M>* prims, size_t num, const Scene* scene)
+    {
+      for (size_t i=0; i<num; i++)
+      {
+        const TriangleMv<M>& tri = prims[i];
+        const Vec3vf<M> q = closestPointTriangle(p,tri.v0,tri.v1,tri.v2);
+        updatePointQuery(query,p,tri.valid(),q,tri.geomID(),tri.primID());
+      }
+    }
+
+    __forceinline void pointQueryPrimitives(RTCPointQuery& query, const Vec3vf4& p, const Triangle4i* prims, size_t num, const Scene* scene)
+    {
+      for (size_t i=0; i<num; i++)
+      {
+        const Triangle4i& tri = prims[i];
+        Vec3vf4 v0, v1, v2; tri.gather(v0,v1,v2,scene);
+        const Vec3vf4 q = closestPointTriangle(p,v0,v1,v2);
+        updatePointQuery(query,p,tri.valid(),q,tri.geomID(),tri.primID());
+      }
+    }
+
+    /*! quads are handled as the triangles (v0,v1,v3) and (v2,v3,v1) */
+    template<int M>
+      __forceinline Vec3vf<M> closestPointQuad(const Vec3vf<M>& p, const Vec3vf<M>& v0, const Vec3vf<M>& v1, const Vec3vf<M>& v2, const Vec3vf<M>& v3)
+    {
+      const Vec3vf<M> q0 = closestPointTriangle(p,v0,v1,v3);
+      const Vec3vf<M> q1 = closestPointTriangle(p,v2,v3,v1);
+      return select(dot(q0-p,q0-p) <= dot(q1-p,q1-p),q0,q1);
+    }
+
+    template<int M>
+      __forceinline void pointQueryPrimitives(RTCPointQuery& query, const Vec3vf<M>& p, const QuadMv<M>* prims, size_t num, const Scene* scene)
+    {
+      for (size_t i=0; i<num; i++)
+      {
+        const QuadMv<M>& quad = prims[i];
+        const Vec3vf<M> q = closestPointQuad(p,quad.v0,quad.v1,quad.v2,quad.v3);
+        updatePointQuery(query,p,quad.valid(),q,quad.geomID(),quad.primID());
+      }
+    }
+
+    __forceinline void pointQueryPrimitives(RTCPointQuery& query, const Vec3vf4& p, const Quad4i* prims, size_t num, const Scene* scene)
+    {
+      for (size_t i=0; i<num; i++)
+      {
+        const Quad4i& quad = prims[i];
+        Vec3vf4 v0, v1, v2, v3; quad.gather(v0,v1,v2,v3,scene);
+        const Vec3vf4 q = closestPointQuad(p,v0,v1,v2,v3);
+        updatePointQuery(query,p,quad.valid(),q,quad.geomID(),quad.primID());
+      }
+    }
+
+    /*! line segments are handled as their center line */
+    __forceinline void pointQueryPrimitives(RTCPointQuery& query, const Vec3vf4& p, const Line4i* prims, size_t num, const Scene* scene)
+    {
+      for (size_t i=0; i<num; i++)
+      {
+        const Line4i& line = prims[i];
+        Vec4vf4 v0, v1; line.gather(v0,v1,scene);
+        const Vec3vf4 q = closestPointLine(p,Vec3vf4(v0.x,v0.y,v0.z),Vec3vf4(v1.x,v1.y,v1.z));
+        updatePointQuery(query,p,line.valid(),q,line.geomID(),line.primID());
+      }
+    }
+
+    /*! points are handled as their center */
+    template<int M>
+      __forceinline void pointQueryPrimitives(RTCPointQuery& query, const PointMi<M>* prims, size_t num, const Scene* scene)
+    {
+      const Vec3vf<M> p(query.p[0],query.p[1],query.p[2]);
+      for (size_t i=0; i<num; i++)
+      {
+        const PointMi<M>& point = prims[i];
+        Vec4vf<M> v; Vec3vf<M> n; point.gather(v,n,scene);
+        updatePointQuery(query,p,point.valid(),Vec3vf<M>(v.x,v.y,v.z),point.geomID(),point.primID());
+      }
+    }
+
+    /*! user geometries provide the closest point through a callback */
+    __forceinline void pointQueryPrimitives(RTCPointQuery& query, const Vec3vf4& p, const Object* prims, size_t num, const Scene* scene)
+    {
+      for (size_t i=0; i<num; i++)
+      {
+        const Object& object = prims[i];
+        AccelSet* accel = (AccelSet*) scene->get(object.geomID());
+        if (accel->pointQueryFunc == nullptr) continue;
+
+        Vec3fa q;
+        accel->pointQueryFunc(accel->intersectors.ptr,query,object.primID(),&q.x);
+        const Vec3fa d = q-Vec3fa(query.p[0],query.p[1],query.p[2]);
+        const float dist2 = dot(d,d);
+        if (!(dist2 < sqr(query.radius))) continue;
+
+        query.closest[0] = q.x;
+        query.closest[1] = q.y;
+        query.closest[2] = q.z;
+        query.radius = sqrt(dist2);
+        query.geomID = object.geomID();
+        query.primID = object.primID();
+      }
+    }
+  }
+
+  template<int N>
+  void BVHN<N>::pointQuery(RTCPointQuery& query)
+  {
+    if (root == emptyNode) return;
+
+    const Vec3vf<N> pN(query.p[0],query.p[1],query.p[2]);
+    const Vec3vf4   p4(query.p[0],query.p[1],query.p[2]);
+
+    /*! stack state */
+    static const size_t stackSize = 1+(N-1)*maxDepth+3;
+    StackItemT<NodeRef> stack[stackSize];            //!< stack of nodes
+    StackItemT<NodeRef>* stackPtr = stack+1;         //!< current stack pointer
+    StackItemT<NodeRef>* stackEnd = stack+stackSize;
+    stack[0].ptr  = root;
+    stack[0].dist = 0;
+
+    /* pop loop */
+    while (true) pop:
+    {
+      /*! pop next node */
+      if (unlikely(stackPtr == stack)) break;
+      stackPtr--;
+      NodeRef cur = NodeRef(stackPtr->ptr);
+
+      /*! if popped node is outside the shrunken query sphere, pop next one */
+      if (unlikely(*(float*)&stackPtr->dist > sqr(query.radius)))
+        continue;
+
+      /* downtraversal loop */
+      while (!cur.isLeaf())
+      {
+        /* motion blur and transformation nodes are not supported */
+        if (unlikely(!cur.isAlignedNode() && !cur.isUnalignedNode() && !cur.isQuantizedNode()))
+          goto pop;
+
+        vfloat<N> dist2;
+        const size_t mask = isa::pointQueryNode<N>(cur,pN,vfloat<N>(sqr(query.radius)),dist2);
+        if (unlikely(mask == 0))
+          goto pop;
+
+        /* continue with closest child and push other children sorted by distance */
+        isa::BVHNNodeTraverser1Hit<N,N,isa::pointQueryTypes>::traverseClosestHit(cur,mask,dist2,stackPtr,stackEnd);
+      }
+
+      /*! this is a leaf node */
+      size_t num; const char* prims = cur.leaf(num);
+      if      (primTy == &Triangle4::type ) isa::pointQueryPrimitives(query,p4,(const Triangle4* )prims,num,scene);
+      else if (primTy == &Triangle4v::type) isa::pointQueryPrimitives(query,p4,(const Triangle4v*)prims,num,scene);
+      else if (primTy == &Triangle4i::type) isa::pointQueryPrimitives(query,p4,(const Triangle4i*)prims,num,scene);
+      else if (primTy == &Quad4v::type    ) isa::pointQueryPrimitives(query,p4,(const Quad4v*    )prims,num,scene);
+      else if (primTy == &Quad4i::type    ) isa::pointQueryPrimitives(query,p4,(const Quad4i*    )prims,num,scene);
+      else if (primTy == &Line4i::type    ) isa::pointQueryPrimitives(query,p4,(const Line4i*    )prims,num,scene);
+      else if (primTy == &Point4i::type   ) isa::pointQueryPrimitives(query,(const Point4i*   )prims,num,scene);
+#if defined(__AVX__)
+      else if (primTy == &Point8i::type   ) isa::pointQueryPrimitives(query,(const Point8i*   )prims,num,scene);
+      else if (primTy == &Triangle8::type ) isa::pointQueryPrimitives(query,Vec3vf8(query.p[0],query.p[1],query.p[2]),(const Triangle8* )prims,num,scene);
+      else if (primTy == &Triangle8v::type) isa::pointQueryPrimitives(query,Vec3vf8(query.p[0],query.p[1],query.p[2]),(const Triangle8v*)prims,num,scene);
+      else if (primTy == &Quad8v::type    ) isa::pointQueryPrimitives(query,Vec3vf8(query.p[0],query.p[1],query.p[2]),(const Quad8v*    )prims,num,scene);
+#endif
+#if defined(__AVX512F__)
+      else if (primTy == &Triangle16::type) isa::pointQueryPrimitives(query,Vec3vf16(query.p[0],query.p[1],query.p[2]),(const Triangle16*)prims,num,scene);
+#endif
+      else if (primTy == &Object::type    ) isa::pointQueryPrimitives(query,p4,(const Object*    )prims,num,scene);
+      else break; // other primitive types do not support point queries
+    }
+    AVX_ZERO_UPPER();
+  }
+
+#if defined(__AVX512VL__)
+  template void BVHN<16>::pointQuery(RTCPointQuery& query);
+#endif
+
+#if defined(__AVX__) && !defined(EMBREE_BVH16_ONLY)
+  template void BVHN<8>::pointQuery(RTCPointQuery& query);
+#endif
+
+#if (!defined(__AVX__) || !defined(EMBREE_TARGET_SSE2) && !defined(EMBREE_TARGET_SSE42)) && !defined(EMBREE_BVH16_ONLY)
+  template void BVHN<4>::pointQuery(RTCPointQuery& query);
+#endif
+}
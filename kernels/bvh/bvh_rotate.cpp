@@ -15,6 +15,7 @@
 // ======================================================================== //
 
 #include "bvh_rotate.h"
+#include "../../common/algorithms/parallel_for.h"
 
 namespace embree
 {
@@ -136,5 +137,163 @@ namespace embree
       cdepth[bestChild1]++; // bestChild1 was pushed down one level
       return 1+reduce_max(cdepth); 
     }
+
+    /*! Treelets with up to this many grandchildren are optimized by
+     *  trying all partitions, larger ones use a sweep over the
+     *  centroid sorted grandchildren along each axis. */
+    static const size_t MAX_EXHAUSTIVE_TREELET_SIZE = 10;
+
+    /*! Subtrees above this depth are processed in parallel. */
+    static const size_t MAX_PARALLEL_RESTRUCTURE_DEPTH = 4;
+
+    template<int N>
+    bool BVHNRestructure<N>::restructureTreelet(AlignedNode* parent, size_t a, size_t b)
+    {
+      AlignedNode* nodeA = parent->child(a).alignedNode();
+      AlignedNode* nodeB = parent->child(b).alignedNode();
+
+      /*! gather all grandchildren of the treelet */
+      NodeRef refs[2*N];
+      BBox3fa bounds[2*N];
+      size_t n = 0;
+      for (size_t i=0; i<N && nodeA->child(i) != BVHN<N>::emptyNode; i++) {
+        refs[n] = nodeA->child(i); bounds[n] = nodeA->bounds(i); n++;
+      }
+      for (size_t i=0; i<N && nodeB->child(i) != BVHN<N>::emptyNode; i++) {
+        refs[n] = nodeB->child(i); bounds[n] = nodeB->bounds(i); n++;
+      }
+
+      /*! each node has to keep at least two children */
+      if (n < 4) return false;
+      const size_t minSize = max(size_t(2),n-N);
+      const size_t maxSize = min(size_t(N),n-2);
+
+      /*! only accept partitions that noticeably reduce the cost */
+      const float curCost = halfArea(parent->bounds(a)) + halfArea(parent->bounds(b));
+      float bestCost = 0.999f*curCost;
+      unsigned bestMask = 0;
+
+      if (n <= MAX_EXHAUSTIVE_TREELET_SIZE)
+      {
+        /*! try all partitions, the last grandchild always goes to the first node */
+        for (unsigned mask=0; mask<(1u<<(n-1)); mask++)
+        {
+          size_t sizeA = 1;
+          BBox3fa boundsA = bounds[n-1], boundsB = empty;
+          for (size_t i=0; i<n-1; i++) {
+            if (mask & (1u<<i)) { boundsA.extend(bounds[i]); sizeA++; }
+            else                  boundsB.extend(bounds[i]);
+          }
+          if (sizeA < minSize || sizeA > maxSize) continue;
+
+          const float cost = halfArea(boundsA) + halfArea(boundsB);
+          if (cost < bestCost) {
+            bestCost = cost;
+            bestMask = mask | (1u<<(n-1));
+          }
+        }
+      }
+      else
+      {
+        /*! sweep over the centroid sorted grandchildren along each axis */
+        for (size_t dim=0; dim<3; dim++)
+        {
+          size_t order[2*N];
+          for (size_t i=0; i<n; i++) order[i] = i;
+          std::sort(order,order+n,[&] (size_t i, size_t j) {
+              return center2(bounds[i])[dim] < center2(bounds[j])[dim];
+            });
+
+          BBox3fa rightBounds[2*N];
+          rightBounds[n-1] = bounds[order[n-1]];
+          for (ssize_t i=n-2; i>=0; i--)
+            rightBounds[i] = merge(rightBounds[i+1],bounds[order[i]]);
+
+          BBox3fa leftBounds = empty;
+          unsigned mask = 0;
+          for (size_t i=0; i<maxSize; i++)
+          {
+            leftBounds.extend(bounds[order[i]]);
+            mask |= 1u<<order[i];
+            if (i+1 < minSize) continue;
+            const float cost = halfArea(leftBounds) + halfArea(rightBounds[i+1]);
+            if (cost < bestCost) {
+              bestCost = cost;
+              bestMask = mask;
+            }
+          }
+        }
+      }
+
+      /*! if we did not find a better partition then do nothing */
+      if (bestMask == 0) return false;
+
+      /*! redistribute the grandchildren */
+      nodeA->clear();
+      nodeB->clear();
+      size_t ia = 0, ib = 0;
+      for (size_t i=0; i<n; i++) {
+        if (bestMask & (1u<<i)) nodeA->set(ia++,refs[i],bounds[i]);
+        else                    nodeB->set(ib++,refs[i],bounds[i]);
+      }
+      parent->setBounds(a,nodeA->bounds());
+      parent->setBounds(b,nodeB->bounds());
+      return true;
+    }
+
+    template<int N>
+    size_t BVHNRestructure<N>::restructurePass(NodeRef ref, size_t depth)
+    {
+      if (ref.isBarrier()) return 0;
+      if (!ref.isAlignedNode()) return 0;
+      AlignedNode* node = ref.alignedNode();
+
+      /*! restructure all subtrees first */
+      size_t numRestructured = 0;
+      if (depth < MAX_PARALLEL_RESTRUCTURE_DEPTH)
+      {
+        size_t counts[N];
+        parallel_for(size_t(0), size_t(N), [&] (const range<size_t>& r) {
+            for (size_t i=r.begin(); i<r.end(); i++)
+              counts[i] = restructurePass(node->child(i),depth+1);
+          });
+        for (size_t i=0; i<N; i++) numRestructured += counts[i];
+      }
+      else
+      {
+        for (size_t i=0; i<N; i++)
+          numRestructured += restructurePass(node->child(i),depth+1);
+      }
+
+      /*! optimize all treelets formed by pairs of inner children */
+      for (size_t a=0; a<N; a++)
+      {
+        if (!node->child(a).isAlignedNode()) continue;
+        for (size_t b=a+1; b<N; b++)
+        {
+          if (!node->child(b).isAlignedNode()) continue;
+          numRestructured += restructureTreelet(node,a,b);
+        }
+      }
+      return numRestructured;
+    }
+
+    template<int N>
+    size_t BVHNRestructure<N>::restructure(NodeRef root, size_t maxIterations)
+    {
+      size_t numRestructured = 0;
+      for (size_t i=0; i<maxIterations; i++)
+      {
+        const size_t num = restructurePass(root,0);
+        numRestructured += num;
+        if (num == 0) break;
+      }
+      return numRestructured;
+    }
+
+    template class BVHNRestructure<4>;
+#if defined(__AVX__)
+    template class BVHNRestructure<8>;
+#endif
   }
 }
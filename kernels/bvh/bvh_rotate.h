@@ -46,5 +46,29 @@ namespace embree
 
       static size_t rotate(NodeRef parentRef, size_t depth = 1);
     };
+
+    /* SAH driven treelet restructuring. Each treelet is formed by a
+     * node and two of its inner children, the grandchildren of the
+     * treelet get redistributed between the two inner children such
+     * that their summed surface area gets minimal. As the bounds of
+     * the treelet root do not change, each such step strictly reduces
+     * the SAH cost of the tree, while the number of nodes and the
+     * depth of the tree stay the same. */
+    template<int N>
+    class BVHNRestructure
+    {
+      typedef typename BVHN<N>::AlignedNode AlignedNode;
+      typedef typename BVHN<N>::NodeRef NodeRef;
+
+    public:
+
+      /*! performs up to maxIterations bottom up restructuring passes
+       *  over the tree and returns the number of modified treelets */
+      static size_t restructure(NodeRef root, size_t maxIterations = 3);
+
+    private:
+      static size_t restructurePass(NodeRef ref, size_t depth);
+      static bool restructureTreelet(AlignedNode* parent, size_t a, size_t b);
+    };
   }
 }
@@ -174,11 +174,15 @@ namespace embree
     return s;
   } 
 
-#if defined(__AVX__)
+#if defined(__AVX512VL__)
+  template class BVHNStatistics<16>;
+#endif
+
+#if defined(__AVX__) && !defined(EMBREE_BVH16_ONLY)
   template class BVHNStatistics<8>;
 #endif
 
-#if !defined(__AVX__) || !defined(EMBREE_TARGET_SSE2) && !defined(EMBREE_TARGET_SSE42)
+#if (!defined(__AVX__) || !defined(EMBREE_TARGET_SSE2) && !defined(EMBREE_TARGET_SSE42)) && !defined(EMBREE_BVH16_ONLY)
   template class BVHNStatistics<4>;
 #endif
 }
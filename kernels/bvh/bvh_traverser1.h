@@ -669,6 +669,61 @@ namespace embree
     };
 
 
+#if defined(__AVX512VL__)
+
+    /* Specialization for BVH16, only supported on AVX-512 (Skylake). */
+    template<int Nx, int types>
+      class BVHNNodeTraverser1Hit<16,Nx,types>
+    {
+      typedef BVH16 BVH;
+      typedef BVH16::NodeRef NodeRef;
+      typedef BVH16::BaseNode BaseNode;
+
+    public:
+      static __forceinline void traverseClosestHit(NodeRef& cur,
+                                                   size_t mask,
+                                                   const vfloat<Nx>& tNear,
+                                                   StackItemT<NodeRef>*& stackPtr,
+                                                   StackItemT<NodeRef>* stackEnd)
+      {
+        assert(mask != 0);
+        traverseClosestHitAVX512VL<16,Nx,types,NodeRef,BaseNode>(cur,mask,tNear,stackPtr,stackEnd);
+      }
+
+      static __forceinline void traverseAnyHit(NodeRef& cur,
+                                               size_t mask,
+                                               const vfloat<Nx>& tNear,
+                                               NodeRef*& stackPtr,
+                                               NodeRef* stackEnd)
+      {
+        const BaseNode* node = cur.baseNode(types);
+
+        /*! one child is hit, continue with that child */
+        size_t r = __bscf(mask);
+        cur = node->child(r);
+        cur.prefetch(types);
+
+        /* simpler in sequence traversal order */
+        assert(cur != BVH::emptyNode);
+        if (likely(mask == 0)) return;
+        assert(stackPtr < stackEnd);
+        *stackPtr = cur; stackPtr++;
+
+        for (; ;)
+        {
+          r = __bscf(mask);
+          cur = node->child(r); cur.prefetch(types);
+          assert(cur != BVH::emptyNode);
+          if (likely(mask == 0)) return;
+          assert(stackPtr < stackEnd);
+          *stackPtr = cur; stackPtr++;
+        }
+      }
+    };
+
+#endif
+
+
     /*! BVH transform node traversal for single rays. */
     template<int N, int Nx, int types, bool transform>
     class BVHNNodeTraverser1Transform;
@@ -28,7 +28,7 @@ namespace embree
   class AccelData : public RefCount 
   {
   public:
-    enum Type { TY_UNKNOWN = 0, TY_ACCELN = 1, TY_ACCEL_INSTANCE = 2, TY_BVH4 = 3, TY_BVH8 = 4 };
+    enum Type { TY_UNKNOWN = 0, TY_ACCELN = 1, TY_ACCEL_INSTANCE = 2, TY_BVH4 = 3, TY_BVH8 = 4, TY_BVH16 = 5 };
 
   public:
     AccelData (const Type type) 
@@ -40,6 +40,23 @@ namespace embree
     /*! clears the acceleration structure data */
     virtual void clear() = 0;
 
+    /*! writes the acceleration structure data to a stream, returns false if the data cannot get stored */
+    virtual bool save(std::ostream& out) { return false; }
+
+    /*! restores the acceleration structure data from memory written by save, the memory has to stay valid during the lifetime of the data */
+    virtual bool load(char* ptr, size_t bytes) { return false; }
+
+    /*! finds the closest point to the query position within the query radius and updates the query */
+    virtual void pointQuery(RTCPointQuery& query) {}
+
+    /*! pads the stream with zeros to the specified alignment */
+    static void alignStream(std::ostream& out, size_t alignment)
+    {
+      const size_t pos = (size_t) out.tellp();
+      for (size_t i=pos; i<((pos+alignment-1) & ~(alignment-1)); i++)
+        out.put(0);
+    }
+
     /*! returns normal bounds */
     __forceinline BBox3fa getBounds() const {
       return bounds.bounds();
@@ -37,6 +37,21 @@ namespace embree
       bounds = accel->bounds;
     }
 
+    bool save(std::ostream& out) {
+      return accel->save(out);
+    }
+
+    bool load(char* ptr, size_t bytes) 
+    {
+      if (!accel->load(ptr,bytes)) return false;
+      bounds = accel->bounds;
+      return true;
+    }
+
+    void pointQuery(RTCPointQuery& query) {
+      accel->pointQuery(query);
+    }
+
     void deleteGeometry(size_t geomID) {
       if (accel  ) accel->deleteGeometry(geomID);
       if (builder) builder->deleteGeometry(geomID);
@@ -161,6 +161,60 @@ namespace embree
         accels[i]->build();
       });
 
+    updateValidAccels();
+  }
+
+  bool AccelN::save(std::ostream& out)
+  {
+    /* write table of contents, gets filled in after all acceleration structures got written */
+    const size_t begin = (size_t) out.tellp();
+    std::vector<uint64_t> table(1+2*accels.size(),0);
+    table[0] = accels.size();
+    out.write((char*)table.data(),table.size()*sizeof(uint64_t));
+
+    for (size_t i=0; i<accels.size(); i++) 
+    {
+      alignStream(out,64);
+      const size_t offset = (size_t) out.tellp();
+      if (!accels[i]->save(out)) return false;
+      table[1+2*i+0] = offset-begin;
+      table[1+2*i+1] = (size_t) out.tellp()-offset;
+    }
+    const size_t end = (size_t) out.tellp();
+
+    out.seekp(begin);
+    out.write((char*)table.data(),table.size()*sizeof(uint64_t));
+    out.seekp(end);
+    return out.good();
+  }
+
+  bool AccelN::load(char* ptr, size_t bytes)
+  {
+    /* the stored acceleration structures have to match the ones of this scene */
+    const uint64_t* table = (const uint64_t*) ptr;
+    if (bytes < sizeof(uint64_t) || table[0] != accels.size()) return false;
+    if (bytes < (1+2*accels.size())*sizeof(uint64_t)) return false;
+
+    for (size_t i=0; i<accels.size(); i++) 
+    {
+      const uint64_t offset = table[1+2*i+0];
+      const uint64_t num    = table[1+2*i+1];
+      if (offset > bytes || num > bytes-offset) return false;
+      if (!accels[i]->load(ptr+offset,num)) return false;
+    }
+
+    updateValidAccels();
+    return true;
+  }
+
+  void AccelN::pointQuery(RTCPointQuery& query)
+  {
+    for (size_t i=0; i<validAccels.size(); i++)
+      validAccels[i]->pointQuery(query);
+  }
+
+  void AccelN::updateValidAccels()
+  {
     /* create list of non-empty acceleration structures */
     validAccels.clear();
     for (size_t i=0; i<accels.size(); i++) {
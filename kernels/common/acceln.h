@@ -48,10 +48,16 @@ namespace embree
     void print(size_t ident);
     void immutable();
     void build ();
+    bool save(std::ostream& out);
+    bool load(char* ptr, size_t bytes);
+    void pointQuery(RTCPointQuery& query);
     void select(bool filter4, bool filter8, bool filter16, bool filterN);
     void deleteGeometry(size_t geomID);
     void clear ();
 
+  private:
+    void updateValidAccels();
+
   public:
     darray_t<Accel*,16> accels;
     darray_t<Accel*,16> validAccels;
@@ -371,6 +371,7 @@ namespace embree
       RTCBoundsFunc2 boundsFunc2;
       RTCBoundsFunc3 boundsFunc3;
       void* boundsFuncUserPtr;
+      RTCPointQueryFunc pointQueryFunc;
 
       struct Intersectors 
       {
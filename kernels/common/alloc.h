@@ -181,7 +181,7 @@ namespace embree
     };
 
     FastAllocator (Device* device, bool osAllocation) 
-      : device(device), slotMask(0), usedBlocks(nullptr), freeBlocks(nullptr), use_single_mode(false), defaultBlockSize(PAGE_SIZE), estimatedSize(0),
+      : device(device), slotMask(0), numaNodes(1), usedBlocks(nullptr), freeBlocks(nullptr), use_single_mode(false), defaultBlockSize(PAGE_SIZE), estimatedSize(0),
         growSize(PAGE_SIZE), maxGrowSize(maxAllocationSize), log2_grow_size_scale(0), bytesUsed(0), bytesFree(0), bytesWasted(0), atype(osAllocation ? OS_MALLOC : ALIGNED_MALLOC),
         primrefarray(device,0)
     {
@@ -191,6 +191,12 @@ namespace embree
         threadBlocks[i] = nullptr;
         assert(!slotMutex[i].isLocked());
       }
+
+      /* in NUMA mode the slots get partitioned among the NUMA nodes */
+      if (device && device->numa) {
+        const size_t nodes = getNumberOfNumaNodes();
+        while (numaNodes < nodes && numaNodes < MAX_THREAD_USED_BLOCK_SLOTS) numaNodes *= 2;
+      }
     }
 
     ~FastAllocator () {
@@ -478,6 +484,43 @@ namespace embree
       primrefarray.clear();
     }
 
+    /*! lets the copy function move all data into fresh blocks and frees the old blocks afterwards, the old blocks stay valid during the copy and are kept if the copy fails */
+    template<typename CopyFunc>
+    bool reallocate(const CopyFunc& copy)
+    {
+      cleanup();
+      const size_t oldBytesUsed = bytesUsed, oldBytesFree = bytesFree, oldBytesWasted = bytesWasted;
+      bytesUsed.store(0);
+      bytesFree.store(0);
+      bytesWasted.store(0);
+
+      /* detach all used blocks, shared blocks are not reused as they belong to the primref array */
+      Block* oldBlocks = usedBlocks.load();
+      usedBlocks = nullptr;
+      freeBlocks.store(Block::remove_shared_blocks(freeBlocks.load()));
+      for (size_t i=0; i<MAX_THREAD_USED_BLOCK_SLOTS; i++)
+        threadUsedBlocks[i] = nullptr;
+
+      const bool success = copy();
+      cleanup();
+
+      if (success) {
+        if (oldBlocks) oldBlocks->clear_list(device);
+        primrefarray.clear();
+      }
+      else if (oldBlocks)
+      {
+        Block* last = oldBlocks;
+        while (last->next) last = last->next;
+        last->next = usedBlocks.load();
+        usedBlocks = oldBlocks;
+        bytesUsed += oldBytesUsed;
+        bytesFree += oldBytesFree;
+        bytesWasted += oldBytesWasted;
+      }
+      return success;
+    }
+
     __forceinline size_t incGrowSizeScale()
     {
       size_t scale = log2_grow_size_scale.fetch_add(1)+1;
@@ -494,6 +537,12 @@ namespace embree
         /* allocate using current block */
         size_t threadID = TaskScheduler::threadID();
         size_t slot = threadID & slotMask;
+        unsigned int node = 0;
+        if (unlikely(numaNodes > 1)) {
+          const size_t slotsPerNode = MAX_THREAD_USED_BLOCK_SLOTS/numaNodes;
+          node = getThreadNumaNode();
+          slot = (node & (numaNodes-1))*slotsPerNode + (slot & (slotsPerNode-1));
+        }
 	Block* myUsedBlocks = threadUsedBlocks[slot];
         if (myUsedBlocks) {
           void* ptr = myUsedBlocks->malloc(device,bytes,align,partial);
@@ -512,7 +561,9 @@ namespace embree
             const size_t alignedBytes = (bytes+(align-1)) & ~(align-1);
             const size_t allocSize = max(min(growSize,maxGrowSize),alignedBytes);
             assert(allocSize >= bytes);
-            threadBlocks[slot] = threadUsedBlocks[slot] = Block::create(device,allocSize,allocSize,threadBlocks[slot],atype); // FIXME: a large allocation might throw away a block here!
+            Block* block = Block::create(device,allocSize,allocSize,threadBlocks[slot],atype);
+            if (numaNodes > 1) block->bindNuma(node); // on purpose ignore failure, memory then gets placed at first touch
+            threadBlocks[slot] = threadUsedBlocks[slot] = block; // FIXME: a large allocation might throw away a block here!
             // FIXME: a direct allocation should allocate inside the block here, and not in the next loop! a different thread could do some allocation and make the large allocation fail.
           }
           continue;
@@ -774,6 +825,11 @@ namespace embree
         return NULL;
       }
 
+      /*! places the pages of the block on some NUMA node */
+      bool bindNuma(unsigned int node) {
+        return os_bind_numa(this,offsetof(Block,data[0])+reserveEnd,node);
+      }
+
       Block (AllocationType atype, size_t bytesAllocate, size_t bytesReserve, Block* next, size_t wasted, bool huge_pages = false)
       : cur(0), allocEnd(bytesAllocate), reserveEnd(bytesReserve), next(next), wasted(wasted), atype(atype), huge_pages(huge_pages)
       {
@@ -945,6 +1001,7 @@ namespace embree
     Device* device;
     SpinLock mutex;
     size_t slotMask;
+    size_t numaNodes; //!< number of NUMA nodes the slots are partitioned among, a power of two
     std::atomic<Block*> threadUsedBlocks[MAX_THREAD_USED_BLOCK_SLOTS];
     std::atomic<Block*> usedBlocks;
     std::atomic<Block*> freeBlocks;
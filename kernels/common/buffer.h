@@ -112,6 +112,29 @@ namespace embree
     }
   };
 
+  /*! converts 3 half precision floats to single precision */
+  __forceinline Vec3fa half3ToFloat3(const uint16_t* h)
+  {
+    const vint4 bits(h[0],h[1],h[2],0);
+    const vint4 shiftedExp(0x7C00 << 13);
+    const vint4 o = (bits & 0x7FFF) << 13;
+    const vint4 exp = o & shiftedExp;
+    const vint4 normal = o + vint4((127-15) << 23);
+    const vint4 infnan = normal + vint4((128-16) << 23);
+    const vint4 denormal = asInt(asFloat(o + vint4(113 << 23)) - asFloat(vint4(113 << 23)));
+    const vint4 r = select(exp == shiftedExp, infnan, select(exp == vint4(zero), denormal, normal));
+    return Vec3fa(asFloat(r | ((bits & 0x8000) << 16)));
+  }
+
+  /*! decodes a vertex stored in some compressed vertex format */
+  __forceinline Vec3fa decodeVertex(const char* ptr, RTCFormat format, const Vec3fa& lower, const Vec3fa& scale)
+  {
+    const uint16_t* v = (const uint16_t*) ptr;
+    if (format == RTC_FORMAT_HALF3) return half3ToFloat3(v);
+    assert(format == RTC_FORMAT_QUANTIZED16x3);
+    return madd(Vec3fa(float(v[0]),float(v[1]),float(v[2])),scale,lower);
+  }
+
   /*! Implements an API data buffer object. This class may or may not own the data. */
   template<typename T>
     class APIBuffer : public BufferRefT<T>
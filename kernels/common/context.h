@@ -23,11 +23,102 @@ namespace embree
 {
   class Scene;
 
+  /*! counters of a single traversal, which get added to the traversal statistics at its end */
+  struct TraversalCounters
+  {
+    __forceinline TraversalCounters (size_t rays = 0)
+      : rays(rays), nodes(0), leaves(0), primitives(0), filterCalls(0), earlyExits(0) {}
+
+  public:
+    size_t rays;
+    size_t nodes;
+    size_t leaves;
+    size_t primitives;
+    size_t filterCalls;
+    size_t earlyExits;
+  };
+
+  /*! Context of one instancing level of a nested instancing query. As
+   *  instances share their accel with other geometries, a closer hit
+   *  of a non-instanced geometry can get committed after an instance
+   *  stored its ID. Thus the context remembers for each ray the hit
+   *  the instance ID of its level belongs to, and the ID gets
+   *  terminated if the traversal of the level ends with another hit. */
+  struct InstanceStackContext : public RTCInstanceStackContext
+  {
+    enum { MAX_RAYS = 16 }; // largest supported ray packet
+
+    __forceinline InstanceStackContext() {}
+
+    __forceinline InstanceStackContext(const RTCInstanceStackContext& other)
+      : RTCInstanceStackContext(other)
+    {
+      for (size_t k=0; k<MAX_RAYS; k++)
+        hitGeomID[k] = RTC_INVALID_GEOMETRY_ID;
+    }
+
+    /*! the ID of the instance that reported the current hit of ray k got stored for this level */
+    __forceinline void setHit(size_t k, float t, unsigned geomID, unsigned primID) const
+    {
+      assert(k < MAX_RAYS);
+      hitT[k] = t; hitGeomID[k] = geomID; hitPrimID[k] = primID;
+    }
+
+    /*! terminates the instance path of ray k at this level if its final hit did not get reported by an instance, returns true if terminated */
+    __forceinline bool resolveHit(size_t k, float t, unsigned geomID, unsigned primID) const
+    {
+      assert(k < MAX_RAYS);
+      if (geomID == RTC_INVALID_GEOMETRY_ID || instLevel >= RTC_MAX_INSTANCE_LEVEL_COUNT) return false;
+      if (hitGeomID[k] == geomID && hitPrimID[k] == primID && hitT[k] == t) return false;
+      instIDs[k*RTC_MAX_INSTANCE_LEVEL_COUNT+instLevel] = RTC_INVALID_GEOMETRY_ID;
+      return true;
+    }
+
+  public:
+    mutable float hitT[MAX_RAYS];
+    mutable unsigned hitGeomID[MAX_RAYS];
+    mutable unsigned hitPrimID[MAX_RAYS];
+  };
+
   struct IntersectContext
   {
   public:
     __forceinline IntersectContext(Scene* scene, const RTCIntersectContext* user_context)
-      : scene(scene), user(user_context), flags(0), geomID_to_instID(nullptr) {}
+      : scene(scene), user(user_context), flags(0), geomID_to_instID(nullptr),
+        multiHit(user_context && isMultiHit(user_context->flags) ? (const RTCMultiHitContext*) user_context : nullptr),
+        instStack(user_context && !multiHit && isInstanceStack(user_context->flags) ? (const RTCInstanceStackContext*) user_context : nullptr),
+        stats(user_context && !multiHit && isTraversalStats(user_context->flags) ? (instStack ? instStack->stats : ((const RTCTraversalStatsContext*) user_context)->stats) : nullptr) {}
+
+    /*! adds the counters of a traversal to the statistics of the scene
+     *  and the ray query, the stats of the ray query are shared by all
+     *  threads using the same context. Scene is incomplete here, thus
+     *  the access to its statistics gets resolved at instantiation. */
+    template<typename SceneTy = Scene>
+    __forceinline void addStats(const TraversalCounters& counters) const
+    {
+      SceneTy* s = scene;
+      if (unlikely(s->traversalStats.enabled))
+        s->traversalStats.add(counters);
+
+      if (unlikely(stats != nullptr)) 
+      {
+        atomic_add(&stats->rays       ,counters.rays);
+        atomic_add(&stats->nodes      ,counters.nodes);
+        atomic_add(&stats->leaves     ,counters.leaves);
+        atomic_add(&stats->primitives ,counters.primitives);
+        atomic_add(&stats->filterCalls,counters.filterCalls);
+        atomic_add(&stats->earlyExits ,counters.earlyExits);
+      }
+    }
+
+    /*! counts the invocation of a filter function */
+    template<typename SceneTy = Scene>
+    __forceinline void addFilterCall() const
+    {
+      TraversalCounters counters;
+      counters.filterCalls = 1;
+      addStats<SceneTy>(counters);
+    }
 
   public:
     Scene* scene;
@@ -36,5 +127,8 @@ namespace embree
     const unsigned* geomID_to_instID; // required for xfm node handling
     unsigned instID; // required for xfm node handling
     unsigned geomID; // required for xfm node handling
+    const RTCMultiHitContext* multiHit; // hit buffers of multi-hit queries
+    const RTCInstanceStackContext* instStack; // instance ID buffers of nested instancing queries
+    RTCTraversalStats* stats; // traversal statistics of the ray query
   };
 }
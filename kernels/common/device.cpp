@@ -31,6 +31,7 @@
 
 #include "../bvh/bvh4_factory.h"
 #include "../bvh/bvh8_factory.h"
+#include "../bvh/bvh16_factory.h"
 
 #include "../common/tasking/taskscheduler.h"
 #include "../../common/sys/alloc.h"
@@ -76,6 +77,9 @@ namespace embree
     
     /*! set tessellation cache size */
     setCacheSize( State::tessellation_cache_size );
+#if defined(EMBREE_GEOMETRY_SUBDIV)
+    cache_stats_base = cache_stats_adapted = getTessellationCacheStats();
+#endif
 
     /*! enable some floating point exceptions to catch bugs */
     if (State::float_exceptions)
@@ -105,6 +109,10 @@ namespace embree
     bvh8_factory = make_unique(new BVH8Factory(enabled_builder_cpu_features, enabled_cpu_features));
 #endif
 
+#if defined(EMBREE_TARGET_AVX512SKX)
+    bvh16_factory = make_unique(new BVH16Factory(enabled_builder_cpu_features, enabled_cpu_features));
+#endif
+
     /* setup tasking system */
     initTaskingSystem(numThreads);
 
@@ -196,6 +204,9 @@ namespace embree
 #endif
 #if defined(TASKING_PPL)
 	std::cout << "PPL ";
+#endif
+#if defined(TASKING_OPENMP)
+    std::cout << "OpenMP" << _OPENMP << " ";
 #endif
     std::cout << std::endl;
 
@@ -336,6 +347,51 @@ namespace embree
 #endif
   }
 
+  void Device::adaptCacheSize()
+  {
+#if defined(EMBREE_GEOMETRY_SUBDIV)
+    if (State::tessellation_cache_max_size == 0)
+      return;
+
+    Lock<MutexSys> lock(g_mutex);
+    const TessellationCacheStats stats = getTessellationCacheStats();
+    const TessellationCacheStats delta = stats - cache_stats_adapted;
+    cache_stats_adapted = stats;
+
+    std::map<Device*,size_t>::iterator i = g_cache_size_map.find(this);
+    if (i == g_cache_size_map.end()) return;
+    
+    const size_t minSize = State::tessellation_cache_size;
+    const size_t maxSize = max(minSize,State::tessellation_cache_max_size);
+    const size_t bytes = adaptTessellationCacheSize(delta,(*i).second,minSize,maxSize);
+    if (bytes == (*i).second) return;
+
+    if (State::verbosity(2))
+      std::cout << "adapting tessellation cache size to " << float(bytes)*1E-6 << " MB" << std::endl;
+
+    (*i).second = bytes;
+    resizeTessellationCache(getMaxCacheSize());
+#endif
+  }
+
+  TessellationCacheStats Device::getCacheStats()
+  {
+#if defined(EMBREE_GEOMETRY_SUBDIV)
+    Lock<MutexSys> lock(g_mutex);
+    return getTessellationCacheStats() - cache_stats_base;
+#else
+    return TessellationCacheStats();
+#endif
+  }
+
+  void Device::resetCacheStats(size_t TessellationCacheStats::*counter)
+  {
+#if defined(EMBREE_GEOMETRY_SUBDIV)
+    Lock<MutexSys> lock(g_mutex);
+    cache_stats_base.*counter = getTessellationCacheStats().*counter;
+#endif
+  }
+
   void Device::initTaskingSystem(size_t numThreads) 
   {
     Lock<MutexSys> lock(g_mutex);
@@ -346,7 +402,7 @@ namespace embree
 
     /* create task scheduler */
     size_t maxNumThreads = getMaxNumThreads();
-    TaskScheduler::create(maxNumThreads,State::set_affinity,State::start_threads);
+    TaskScheduler::create(maxNumThreads,State::set_affinity || State::numa,State::start_threads,State::spin_count);
 #if USE_TASK_ARENA
     arena = make_unique(new tbb::task_arena((int)min(maxNumThreads,TaskScheduler::threadCount())));
 #endif
@@ -364,7 +420,7 @@ namespace embree
     /* or configure new number of threads */
     else {
       size_t maxNumThreads = getMaxNumThreads();
-      TaskScheduler::create(maxNumThreads,State::set_affinity,State::start_threads);
+      TaskScheduler::create(maxNumThreads,State::set_affinity || State::numa,State::start_threads,State::spin_count);
     }
 #if USE_TASK_ARENA
     arena.reset();
@@ -383,7 +439,18 @@ namespace embree
     }
 
     switch (parm) {
-    case RTC_SOFTWARE_CACHE_SIZE: setCacheSize(val); break;
+    case RTC_SOFTWARE_CACHE_SIZE: State::tessellation_cache_size = val; setCacheSize(val); break;
+    case RTC_SOFTWARE_CACHE_MAX_SIZE: State::tessellation_cache_max_size = val; break;
+    case RTC_SOFTWARE_CACHE_HITS:
+    case RTC_SOFTWARE_CACHE_MISSES:
+    case RTC_SOFTWARE_CACHE_FLUSHES:
+    {
+      if (val != 0) throw_RTCError(RTC_INVALID_ARGUMENT, "software cache statistics can only be reset to 0");
+      if      (parm == RTC_SOFTWARE_CACHE_HITS  ) resetCacheStats(&TessellationCacheStats::hits);
+      else if (parm == RTC_SOFTWARE_CACHE_MISSES) resetCacheStats(&TessellationCacheStats::misses);
+      else                                        resetCacheStats(&TessellationCacheStats::flushes);
+      break;
+    }
     default: throw_RTCError(RTC_INVALID_ARGUMENT, "unknown writable parameter"); break;
     };
   }
@@ -418,6 +485,16 @@ namespace embree
 
     case RTC_CONFIG_INTERSECT1: return 1;
 
+#if defined(EMBREE_GEOMETRY_SUBDIV)
+    case RTC_SOFTWARE_CACHE_SIZE: return SharedLazyTessellationCache::sharedLazyTessellationCache.getSize();
+#else
+    case RTC_SOFTWARE_CACHE_SIZE: return 0;
+#endif
+    case RTC_SOFTWARE_CACHE_MAX_SIZE: return State::tessellation_cache_max_size;
+    case RTC_SOFTWARE_CACHE_HITS:     return getCacheStats().hits;
+    case RTC_SOFTWARE_CACHE_MISSES:   return getCacheStats().misses;
+    case RTC_SOFTWARE_CACHE_FLUSHES:  return getCacheStats().flushes;
+
 #if defined(EMBREE_TARGET_SIMD4) && defined(EMBREE_RAY_PACKETS)
     case RTC_CONFIG_INTERSECT4:  return hasISA(SSE2);
 #else
@@ -484,6 +561,10 @@ namespace embree
     case RTC_CONFIG_TASKING_SYSTEM: return 2;
 #endif
 
+#if defined(TASKING_OPENMP)
+    case RTC_CONFIG_TASKING_SYSTEM: return 3;
+#endif
+
 #if defined(EMBREE_GEOMETRY_TRIANGLES)
     case RTC_CONFIG_TRIANGLE_GEOMETRY: return 1;
 #else
@@ -520,6 +601,12 @@ namespace embree
     case RTC_CONFIG_USER_GEOMETRY: return 0;
 #endif
 
+#if defined(EMBREE_GEOMETRY_POINTS)
+    case RTC_CONFIG_POINT_GEOMETRY: return 1;
+#else
+    case RTC_CONFIG_POINT_GEOMETRY: return 0;
+#endif
+
 #if defined(TASKING_TBB) && (TBB_INTERFACE_VERSION_MAJOR < 8)
     case RTC_CONFIG_COMMIT_JOIN: return 0;
     case RTC_CONFIG_COMMIT_THREAD: return 0;
@@ -19,11 +19,13 @@
 #include "default.h"
 #include "state.h"
 #include "accel.h"
+#include "../subdiv/tessellation_cache.h"
 
 namespace embree
 {
   class BVH4Factory;
   class BVH8Factory;
+  class BVH16Factory;
   class InstanceFactory;
 
   class Device : public State, public MemoryMonitorInterface
@@ -62,6 +64,12 @@ namespace embree
     /*! sets the size of the software cache. */
     void setCacheSize(size_t bytes);
 
+    /*! adapts the size of the software cache to the statistics gathered since the last adaptation */
+    void adaptCacheSize();
+
+    /*! returns the software cache statistics gathered since the last reset, includes the lookups of all devices as the cache is shared */
+    TessellationCacheStats getCacheStats();
+
     /*! configures some parameter */
     void setParameter1i(const RTCParameter parm, ssize_t val);
 
@@ -76,6 +84,13 @@ namespace embree
     /*! shuts down the tasking system */
     void exitTaskingSystem();
 
+    /*! resets the selected software cache statistics counter */
+    void resetCacheStats(size_t TessellationCacheStats::*counter);
+
+  private:
+    TessellationCacheStats cache_stats_base;     //!< software cache statistics at last reset
+    TessellationCacheStats cache_stats_adapted;  //!< software cache statistics at last adaptation
+
     /*! some variables that can be set via rtcSetParameter1i for debugging purposes */
   public:
     static ssize_t debug_int0;
@@ -91,6 +106,9 @@ namespace embree
 #if defined(EMBREE_TARGET_SIMD8)
     std::unique_ptr<BVH8Factory> bvh8_factory;
 #endif
+#if defined(EMBREE_TARGET_AVX512SKX)
+    std::unique_ptr<BVH16Factory> bvh16_factory;
+#endif
     
 #if USE_TASK_ARENA
     std::unique_ptr<tbb::task_arena> arena;
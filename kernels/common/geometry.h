@@ -21,6 +21,7 @@
 namespace embree
 {
   class Scene;
+  struct QuaternionDecomposition;
 
   /* calculate time segment itime and fractional time ftime */
   __forceinline int getTimeSegment(float time, float numTimeSegments, float& ftime)
@@ -55,8 +56,8 @@ namespace embree
   public:
 
     /*! type of geometry */
-    enum Type { TRIANGLE_MESH = 1, QUAD_MESH = 2, BEZIER_CURVES = 4, LINE_SEGMENTS = 8, SUBDIV_MESH = 16, USER_GEOMETRY = 32, INSTANCE = 64, GROUP = 128 };
-    static const int NUM_TYPES = 8;
+    enum Type { TRIANGLE_MESH = 1, QUAD_MESH = 2, BEZIER_CURVES = 4, LINE_SEGMENTS = 8, SUBDIV_MESH = 16, USER_GEOMETRY = 32, INSTANCE = 64, GROUP = 128, POINTS = 256 };
+    static const int NUM_TYPES = 9;
 
   public:
     
@@ -204,6 +205,16 @@ namespace embree
       throw_RTCError(RTC_INVALID_OPERATION,"operation not supported for this geometry"); 
     }
 
+    /*! Sets data format of specified buffer. */
+    virtual void setBufferFormat(RTCBufferType type, RTCFormat format) { 
+      throw_RTCError(RTC_INVALID_OPERATION,"operation not supported for this geometry"); 
+    }
+
+    /*! Sets bounds of quantized vertex formats. */
+    virtual void setQuantizationBounds(const BBox3fa& bounds) { 
+      throw_RTCError(RTC_INVALID_OPERATION,"operation not supported for this geometry"); 
+    }
+
     /*! Set displacement function. */
     virtual void setDisplacementFunction (RTCDisplacementFunc filter, RTCBounds* bounds) {
       throw_RTCError(RTC_INVALID_OPERATION,"operation not supported for this geometry"); 
@@ -252,6 +263,11 @@ namespace embree
       throw_RTCError(RTC_INVALID_OPERATION,"operation not supported for this geometry"); 
     }
 
+    /*! Sets transformation of the instance as scale/skew/shift, rotation, and translation */
+    virtual void setQuaternionDecomposition(const QuaternionDecomposition& qd, size_t timeStep) {
+      throw_RTCError(RTC_INVALID_OPERATION,"operation not supported for this geometry"); 
+    }
+
     /*! for user geometries only */
   public:
 
@@ -330,6 +346,11 @@ namespace embree
       throw_RTCError(RTC_INVALID_OPERATION,"operation not supported for this geometry"); 
     }
 
+    /*! Set closest point function. */
+    virtual void setPointQueryFunction (RTCPointQueryFunc pointQuery) { 
+      throw_RTCError(RTC_INVALID_OPERATION,"operation not supported for this geometry"); 
+    }
+
     /*! returns number of time segments */
     __forceinline unsigned numTimeSegments () const {
       return numTimeSteps-1;
@@ -246,16 +246,59 @@ namespace embree
     RTCORE_CATCH_BEGIN;
     RTCORE_TRACE(rtcCommit);
     RTCORE_VERIFY_HANDLE(hscene);
+    scene->commitWait();
     scene->commit(0,0,true);
     RTCORE_CATCH_END2(scene);
   }
 
+  RTCORE_API void rtcCommitAsync (RTCScene hscene) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcCommitAsync);
+    RTCORE_VERIFY_HANDLE(hscene);
+    scene->commitAsync();
+    RTCORE_CATCH_END2(scene);
+  }
+
+  RTCORE_API bool rtcCommitPoll (RTCScene hscene) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcCommitPoll);
+    RTCORE_VERIFY_HANDLE(hscene);
+    return scene->commitPoll();
+    RTCORE_CATCH_END2(scene);
+    return true;
+  }
+
+  RTCORE_API void rtcCommitWait (RTCScene hscene) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcCommitWait);
+    RTCORE_VERIFY_HANDLE(hscene);
+    scene->commitWait();
+    RTCORE_CATCH_END2(scene);
+  }
+
+  RTCORE_API void rtcSetBuildThreadCount (RTCScene hscene, unsigned int numThreads) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcSetBuildThreadCount);
+    RTCORE_VERIFY_HANDLE(hscene);
+    scene->setBuildThreadCount(numThreads);
+    RTCORE_CATCH_END2(scene);
+  }
+
   RTCORE_API void rtcCommitJoin (RTCScene hscene) 
   {
     Scene* scene = (Scene*) hscene;
     RTCORE_CATCH_BEGIN;
     RTCORE_TRACE(rtcCommitJoin);
     RTCORE_VERIFY_HANDLE(hscene);
+    scene->commitWait();
     scene->commit(0,0,false);
     RTCORE_CATCH_END2(scene);
   }
@@ -276,15 +319,47 @@ namespace embree
     unsigned int mxcsr = _mm_getcsr();
     _mm_setcsr(mxcsr | /* FTZ */ (1<<15) | /* DAZ */ (1<<6));
     
+    /* an asynchronous commit in progress has to finish first, but
+     * all threads have to take part in the build even if it failed */
+    std::exception_ptr asyncError = nullptr;
+    try { scene->commitWait(); } 
+    catch (...) { asyncError = std::current_exception(); }
+
     /* perform scene build */
     scene->commit(threadID,numThreads,false);
 
     /* reset MXCSR register again */
     _mm_setcsr(mxcsr);
+
+    if (asyncError) std::rethrow_exception(asyncError);
     
     RTCORE_CATCH_END2(scene);
   }
 
+  RTCORE_API void rtcSaveScene(RTCScene hscene, const char* fileName) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcSaveScene);
+    RTCORE_VERIFY_HANDLE(hscene);
+    if (fileName == nullptr)
+      throw_RTCError(RTC_INVALID_ARGUMENT,"invalid file name");
+    scene->save(fileName);
+    RTCORE_CATCH_END2(scene);
+  }
+
+  RTCORE_API void rtcLoadScene(RTCScene hscene, const char* fileName) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcLoadScene);
+    RTCORE_VERIFY_HANDLE(hscene);
+    if (fileName == nullptr)
+      throw_RTCError(RTC_INVALID_ARGUMENT,"invalid file name");
+    scene->load(fileName);
+    RTCORE_CATCH_END2(scene);
+  }
+
   RTCORE_API void rtcGetBounds(RTCScene hscene, RTCBounds& bounds_o)
   {
     Scene* scene = (Scene*) hscene;
@@ -334,6 +409,41 @@ namespace embree
     RTCORE_CATCH_END2(scene);
   }
   
+  /*! traces a single ray of a multi-hit stream, the hit buffers are addressed by the stream index */
+  static __forceinline void intersectMultiHit(Scene* scene, const RTCMultiHitContext* multiHit, RTCRay& ray, size_t index)
+  {
+    RTCMultiHitContext user_context = *multiHit;
+    user_context.numHits = multiHit->numHits+index;
+    user_context.hits = multiHit->hits+index*multiHit->maxHits;
+    IntersectContext context(scene,&user_context.context);
+    if (likely(ray.tnear <= ray.tfar))
+      scene->intersectors.intersect(ray,&context);
+  }
+
+  /*! traces a single ray of a nested instancing stream, the instance ID buffers are addressed by the stream index */
+  static __forceinline void intersectInstanceStack(Scene* scene, const RTCInstanceStackContext* instStack, RTCRay& ray, size_t index)
+  {
+    InstanceStackContext user_context(*instStack);
+    user_context.instIDs = instStack->instIDs+index*RTC_MAX_INSTANCE_LEVEL_COUNT;
+    IntersectContext context(scene,&user_context.context);
+    if (likely(ray.tnear <= ray.tfar))
+      scene->intersectors.intersect(ray,&context);
+    if (user_context.resolveHit(0,ray.tfar,ray.geomID,ray.primID))
+      ray.instID = RTC_INVALID_GEOMETRY_ID;
+  }
+
+  /*! traces a ray packet of a nested instancing query, the instance ID buffers are addressed by the packet lane */
+  template<int K, typename RTCRayK, typename Intersect>
+  static __forceinline void intersectInstanceStack(Scene* scene, const RTCInstanceStackContext* instStack, const void* valid, RTCRayK& ray, const Intersect& intersect)
+  {
+    InstanceStackContext user_context(*instStack);
+    IntersectContext context(scene,&user_context.context);
+    intersect(&context);
+    for (size_t k=0; k<K; k++)
+      if (((const int*)valid)[k] == -1 && user_context.resolveHit(k,ray.tfar[k],ray.geomID[k],ray.primID[k]))
+        ray.instID[k] = RTC_INVALID_GEOMETRY_ID;
+  }
+
   RTCORE_API void rtcIntersect (RTCScene hscene, RTCRay& ray) 
   {
     Scene* scene = (Scene*) hscene;
@@ -365,7 +475,10 @@ namespace embree
 #endif
     STAT3(normal.travs,1,1,1);
     IntersectContext context(scene,user_context);
-    scene->intersectors.intersect(ray,&context);
+    if (unlikely(context.instStack))
+      intersectInstanceStack(scene,context.instStack,ray,0);
+    else
+      scene->intersectors.intersect(ray,&context);
 #if defined(DEBUG)
     ((Ray&)ray).verifyHit();
 #endif
@@ -411,7 +524,10 @@ namespace embree
     STAT(size_t cnt=0; for (size_t i=0; i<4; i++) cnt += ((int*)valid)[i] == -1;);
     STAT3(normal.travs,cnt,cnt,cnt);
     IntersectContext context(scene,user_context);
-    scene->intersectors.intersect4(valid,ray,&context);
+    if (unlikely(context.instStack))
+      intersectInstanceStack<4>(scene,context.instStack,valid,ray,[&] (IntersectContext* stack_context) { scene->intersectors.intersect4(valid,ray,stack_context); });
+    else
+      scene->intersectors.intersect4(valid,ray,&context);
 #else
     throw_RTCError(RTC_INVALID_OPERATION,"rtcIntersect4Ex not supported");  
 #endif
@@ -458,7 +574,10 @@ namespace embree
     STAT3(normal.travs,cnt,cnt,cnt);
 
     IntersectContext context(scene,user_context);
-    scene->intersectors.intersect8(valid,ray,&context);
+    if (unlikely(context.instStack))
+      intersectInstanceStack<8>(scene,context.instStack,valid,ray,[&] (IntersectContext* stack_context) { scene->intersectors.intersect8(valid,ray,stack_context); });
+    else
+      scene->intersectors.intersect8(valid,ray,&context);
 #else
     throw_RTCError(RTC_INVALID_OPERATION,"rtcIntersect8Ex not supported");
 #endif
@@ -506,7 +625,10 @@ namespace embree
     STAT3(normal.travs,cnt,cnt,cnt);
 
     IntersectContext context(scene,user_context);
-    scene->intersectors.intersect16(valid,ray,&context);
+    if (unlikely(context.instStack))
+      intersectInstanceStack<16>(scene,context.instStack,valid,ray,[&] (IntersectContext* stack_context) { scene->intersectors.intersect16(valid,ray,stack_context); });
+    else
+      scene->intersectors.intersect16(valid,ray,&context);
 #else
     throw_RTCError(RTC_INVALID_OPERATION,"rtcIntersect16Ex not supported");
 #endif
@@ -529,11 +651,23 @@ namespace embree
     IntersectContext context(scene,user_context);
 
     /* fast codepath for single rays */
-    if (likely(M == 1)) {
+    if (likely(M == 1 && !context.instStack)) {
       if (likely(rays->tnear <= rays->tfar)) 
         scene->intersectors.intersect(*rays,&context);
     } 
 
+    /* multi-hit streams are traced ray by ray to keep the stream index */
+    else if (unlikely(context.multiHit)) {
+      for (size_t i=0; i<M; i++)
+        intersectMultiHit(scene,context.multiHit,*(RTCRay*)((char*)rays+i*stride),i);
+    }
+
+    /* nested instancing streams are traced ray by ray to keep the stream index */
+    else if (unlikely(context.instStack)) {
+      for (size_t i=0; i<M; i++)
+        intersectInstanceStack(scene,context.instStack,*(RTCRay*)((char*)rays+i*stride),i);
+    }
+
     /* codepath for streams */
     else {
       scene->device->rayStreamFilters.filterAOS(scene,rays,M,stride,&context,true);   
@@ -560,11 +694,23 @@ namespace embree
     IntersectContext context(scene,user_context);
 
     /* fast codepath for single rays */
-    if (likely(M == 1)) {
+    if (likely(M == 1 && !context.instStack)) {
       if (likely(rays[0]->tnear <= rays[0]->tfar)) 
         scene->intersectors.intersect(*rays[0],&context);
     } 
 
+    /* multi-hit streams are traced ray by ray to keep the stream index */
+    else if (unlikely(context.multiHit)) {
+      for (size_t i=0; i<M; i++)
+        intersectMultiHit(scene,context.multiHit,*rays[i],i);
+    }
+
+    /* nested instancing streams are traced ray by ray to keep the stream index */
+    else if (unlikely(context.instStack)) {
+      for (size_t i=0; i<M; i++)
+        intersectInstanceStack(scene,context.instStack,*rays[i],i);
+    }
+
     /* codepath for streams */
     else {
       scene->device->rayStreamFilters.filterAOP(scene,rays,M,&context,true);   
@@ -594,10 +740,20 @@ namespace embree
     if (likely(N == 1))
     {
       /* fast code path for streams of size 1 */
-      if (likely(M == 1)) {
+      if (likely(M == 1 && !context.instStack)) {
         if (likely(((RTCRay*)rays)->tnear <= ((RTCRay*)rays)->tfar))
           scene->intersectors.intersect(*(RTCRay*)rays,&context);
       } 
+      /* multi-hit streams are traced ray by ray to keep the stream index */
+      else if (unlikely(context.multiHit)) {
+        for (size_t i=0; i<M; i++)
+          intersectMultiHit(scene,context.multiHit,*(RTCRay*)((char*)rays+i*stride),i);
+      }
+      /* nested instancing streams are traced ray by ray to keep the stream index */
+      else if (unlikely(context.instStack)) {
+        for (size_t i=0; i<M; i++)
+          intersectInstanceStack(scene,context.instStack,*(RTCRay*)((char*)rays+i*stride),i);
+      }
       /* normal codepath for single ray streams */
       else {
         scene->device->rayStreamFilters.filterAOS(scene,(RTCRay*)rays,M,stride,&context,true);
@@ -605,6 +761,8 @@ namespace embree
     }
     /* code path for ray packet streams */
     else {
+      if (unlikely(context.multiHit)) throw_RTCError(RTC_INVALID_OPERATION,"multi-hit queries not supported for ray packet streams");
+      if (unlikely(context.instStack)) throw_RTCError(RTC_INVALID_OPERATION,"instance stack queries not supported for ray packet streams");
       scene->device->rayStreamFilters.filterSOA(scene,(char*)rays,N,M,stride,&context,true);
     }
 #else
@@ -644,6 +802,8 @@ namespace embree
 #endif
     STAT3(normal.travs,N,N,N);
     IntersectContext context(scene,user_context);
+    if (unlikely(context.multiHit)) throw_RTCError(RTC_INVALID_OPERATION,"multi-hit queries not supported for ray packet streams");
+    if (unlikely(context.instStack)) throw_RTCError(RTC_INVALID_OPERATION,"instance stack queries not supported for ray packet streams");
     scene->device->rayStreamFilters.filterSOP(scene,rays,N,&context,true);
 #else
     throw_RTCError(RTC_INVALID_OPERATION,"rtcIntersectNp not supported");
@@ -961,6 +1121,49 @@ namespace embree
     RTCORE_CATCH_END2(scene);
   }
   
+  RTCORE_API void rtcPointQuery (RTCScene hscene, RTCPointQuery& query) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcPointQuery);
+    RTCORE_VERIFY_HANDLE(hscene);
+    if (scene->isModified()) throw_RTCError(RTC_INVALID_OPERATION,"scene got not committed");
+    if (!(query.radius >= 0.0f)) throw_RTCError(RTC_INVALID_ARGUMENT,"invalid query radius");
+    scene->pointQuery(query);
+    RTCORE_CATCH_END2(scene);
+  }
+
+  RTCORE_API void rtcEnableTraversalStats (RTCScene hscene, bool enable) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcEnableTraversalStats);
+    RTCORE_VERIFY_HANDLE(hscene);
+    scene->traversalStats.enabled = enable;
+    RTCORE_CATCH_END2(scene);
+  }
+
+  RTCORE_API void rtcGetTraversalStats (RTCScene hscene, RTCTraversalStats* stats) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcGetTraversalStats);
+    RTCORE_VERIFY_HANDLE(hscene);
+    if (stats == nullptr) throw_RTCError(RTC_INVALID_ARGUMENT,"invalid stats pointer");
+    *stats = scene->traversalStats.get();
+    RTCORE_CATCH_END2(scene);
+  }
+
+  RTCORE_API void rtcResetTraversalStats (RTCScene hscene) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcResetTraversalStats);
+    RTCORE_VERIFY_HANDLE(hscene);
+    scene->traversalStats.clear();
+    RTCORE_CATCH_END2(scene);
+  }
+
   RTCORE_API void rtcDeleteScene (RTCScene hscene) 
   {
     Scene* scene = (Scene*) hscene;
@@ -1095,6 +1298,24 @@ namespace embree
     RTCORE_CATCH_END2(scene);
   }
 
+  RTCORE_API void rtcSetTransformQuaternion (RTCScene hscene, unsigned geomID, const RTCQuaternionDecomposition* qd, size_t timeStep) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcSetTransformQuaternion);
+    RTCORE_VERIFY_HANDLE(hscene);
+    RTCORE_VERIFY_GEOMID(geomID);
+    RTCORE_VERIFY_HANDLE(qd);
+    QuaternionDecomposition decomposition;
+    decomposition.scale = Vec3fa(qd->scale_x,qd->scale_y,qd->scale_z);
+    decomposition.skew  = Vec3fa(qd->skew_xy,qd->skew_xz,qd->skew_yz);
+    decomposition.shift = Vec3fa(qd->shift_x,qd->shift_y,qd->shift_z);
+    decomposition.translation = Vec3fa(qd->translation_x,qd->translation_y,qd->translation_z);
+    decomposition.quaternion = normalize(Quaternion3f(qd->quaternion_r,qd->quaternion_i,qd->quaternion_j,qd->quaternion_k));
+    ((Scene*) scene)->get_locked(geomID)->setQuaternionDecomposition(decomposition,timeStep);
+    RTCORE_CATCH_END2(scene);
+  }
+
   unsigned rtcNewUserGeometryImpl (RTCScene hscene, RTCGeometryFlags gflags, size_t numItems, size_t numTimeSteps, unsigned int geomID) 
   {
     Scene* scene = (Scene*) hscene;
@@ -1318,6 +1539,32 @@ namespace embree
     return rtcNewLineSegmentsImpl(hscene,gflags,numSegments,numVertices,numTimeSteps,geomID);
   }
 
+  unsigned rtcNewPointsImpl(RTCScene hscene, RTCGeometryFlags gflags, size_t numPoints, size_t numTimeSteps, unsigned int geomID)
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcNewPoints);
+    RTCORE_VERIFY_HANDLE(hscene);
+    RTCORE_VERIFY_RANGE(numTimeSteps,1,RTC_MAX_TIME_STEPS);
+    if (scene->isStatic() && (gflags != RTC_GEOMETRY_STATIC))
+      throw_RTCError(RTC_INVALID_OPERATION,"static scenes can only contain static geometries");
+#if defined(EMBREE_GEOMETRY_POINTS)
+    return scene->newPoints(geomID,gflags,numPoints,numTimeSteps);
+#else
+    throw_RTCError(RTC_UNKNOWN_ERROR,"rtcNewPoints is not supported");
+#endif
+    RTCORE_CATCH_END2(scene);
+    return -1;
+  }
+
+  RTCORE_API unsigned rtcNewPoints (RTCScene hscene, RTCGeometryFlags gflags, size_t numPoints, size_t numTimeSteps) {
+    return rtcNewPointsImpl(hscene,gflags,numPoints,numTimeSteps,RTC_INVALID_GEOMETRY_ID);
+  }
+
+  RTCORE_API unsigned rtcNewPoints2(RTCScene hscene, RTCGeometryFlags gflags, size_t numPoints, size_t numTimeSteps, unsigned int geomID) {
+    return rtcNewPointsImpl(hscene,gflags,numPoints,numTimeSteps,geomID);
+  }
+
   unsigned rtcNewSubdivisionMeshImpl(RTCScene hscene, RTCGeometryFlags gflags, size_t numFaces, size_t numEdges, size_t numVertices, 
                                          size_t numEdgeCreases, size_t numVertexCreases, size_t numHoles, size_t numTimeSteps, unsigned int geomID) 
   {
@@ -1440,6 +1687,31 @@ namespace embree
     RTCORE_CATCH_END2(scene);
   }
 
+  RTCORE_API void rtcSetBufferFormat(RTCScene hscene, unsigned geomID, RTCBufferType type, RTCFormat format)
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcSetBufferFormat);
+    RTCORE_VERIFY_HANDLE(hscene);
+    RTCORE_VERIFY_GEOMID(geomID);
+    scene->get_locked(geomID)->setBufferFormat(type,format);
+    RTCORE_CATCH_END2(scene);
+  }
+
+  RTCORE_API void rtcSetQuantizationBounds(RTCScene hscene, unsigned geomID, const RTCBounds& bounds)
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcSetQuantizationBounds);
+    RTCORE_VERIFY_HANDLE(hscene);
+    RTCORE_VERIFY_GEOMID(geomID);
+    const BBox3fa box(Vec3fa(bounds.lower_x,bounds.lower_y,bounds.lower_z),Vec3fa(bounds.upper_x,bounds.upper_y,bounds.upper_z));
+    if (!(box.lower.x <= box.upper.x && box.lower.y <= box.upper.y && box.lower.z <= box.upper.z))
+      throw_RTCError(RTC_INVALID_ARGUMENT,"invalid quantization bounds");
+    scene->get_locked(geomID)->setQuantizationBounds(box);
+    RTCORE_CATCH_END2(scene);
+  }
+
   RTCORE_API void rtcEnable (RTCScene hscene, unsigned geomID) 
   {
     Scene* scene = (Scene*) hscene;
@@ -1716,6 +1988,17 @@ namespace embree
     RTCORE_CATCH_END2(scene);
   }
 
+  RTCORE_API void rtcSetPointQueryFunction (RTCScene hscene, unsigned geomID, RTCPointQueryFunc pointQuery) 
+  {
+    Scene* scene = (Scene*) hscene;
+    RTCORE_CATCH_BEGIN;
+    RTCORE_TRACE(rtcSetPointQueryFunction);
+    RTCORE_VERIFY_HANDLE(hscene);
+    RTCORE_VERIFY_GEOMID(geomID);
+    scene->get_locked(geomID)->setPointQueryFunction(pointQuery);
+    RTCORE_CATCH_END2(scene);
+  }
+
   RTCORE_API void rtcSetIntersectionFilterFunction (RTCScene hscene, unsigned geomID, RTCFilterFunc intersect) 
   {
     Scene* scene = (Scene*) hscene;
@@ -41,6 +41,10 @@ namespace embree
    /*! decoding of intersection flags */
   __forceinline bool isCoherent  (RTCIntersectFlags flags) { return (flags & RTC_INTERSECT_INCOHERENT) == 0; }
   __forceinline bool isIncoherent(RTCIntersectFlags flags) { return (flags & RTC_INTERSECT_INCOHERENT) != 0; }
+  __forceinline bool isMultiHit  (RTCIntersectFlags flags) { return (flags & RTC_INTERSECT_MULTI_HIT) != 0; }
+  __forceinline bool isSortRays  (RTCIntersectFlags flags) { return (flags & RTC_INTERSECT_SORT_RAYS) != 0; }
+  __forceinline bool isTraversalStats(RTCIntersectFlags flags) { return (flags & RTC_INTERSECT_TRAVERSAL_STATS) != 0; }
+  __forceinline bool isInstanceStack(RTCIntersectFlags flags) { return (flags & RTC_INTERSECT_INSTANCE_STACK) != 0; }
 
 #if defined(TASKING_TBB) && (TBB_INTERFACE_VERSION_MAJOR >= 8)
 #  define USE_TASK_ARENA 1
@@ -28,15 +28,46 @@
 
 #include "../builders/bvh_builder_sah.h"
 #include "../builders/bvh_builder_morton.h"
+#include "../builders/bvh_builder_ploc.h"
 
 namespace embree
 { 
   namespace isa // FIXME: support more ISAs for builders
   {
+    /*! node of the hierarchy recorded during build, used to refit the BVH */
+    struct RefitNode
+    {
+      static RefitNode* create(const FastAllocator::CachedAllocator& alloc, void* ptr, size_t numChildren, size_t numPrimitives)
+      {
+        RefitNode* node = (RefitNode*) alloc.malloc1(sizeof(RefitNode)+numChildren*sizeof(RefitNode*),sizeof(void*));
+        node->ptr = ptr;
+        node->numChildren = numChildren;
+        node->numPrimitives = numPrimitives;
+        node->children = (RefitNode**) (node+1);
+        return node;
+      }
+
+      __forceinline void setChildren(RefitNode* const* nodes, void** childPtrs)
+      {
+        numPrimitives = 0;
+        for (size_t i=0; i<numChildren; i++) {
+          children[i] = nodes[i];
+          childPtrs[i] = nodes[i]->ptr;
+          numPrimitives += nodes[i]->numPrimitives;
+        }
+      }
+
+    public:
+      void* ptr;              //!< user node or leaf
+      size_t numChildren;     //!< number of children, 0 for leaves
+      size_t numPrimitives;   //!< number of primitives in this subtree
+      RefitNode** children;   //!< children of inner nodes
+    };
+
     struct BVH
     {
       BVH (Device* device)
-        : device(device), isStatic(false), allocator(device,true), morton_src(device,0), morton_tmp(device,0) {}
+        : device(device), isStatic(false), allocator(device,true), morton_src(device,0), morton_tmp(device,0), root(nullptr) {}
 
     public:
       Device* device;
@@ -44,6 +75,7 @@ namespace embree
       FastAllocator allocator;
       mvector<BVHBuilderMorton::BuildPrim> morton_src;
       mvector<BVHBuilderMorton::BuildPrim> morton_tmp;
+      RefitNode* root;        //!< hierarchy of last build
     };
 
     RTCORE_API RTCBVH rtcNewBVH(RTCDevice device)
@@ -56,6 +88,10 @@ namespace embree
       return nullptr;
     }
 
+    /*! leaves of the morton and PLOC builders up to this size gather their primitives on the stack */
+    static const size_t MORTON_LEAF_STACK_SIZE = 32;
+
+    template<typename MortonBuilder>
     void* rtcBuildBVHMorton(BVH* bvh,
                             const RTCBuildSettings& settings,
                             RTCBuildPrimitive* prims_i,
@@ -93,7 +129,7 @@ namespace embree
         });
 
       /* start morton build */
-      std::pair<void*,BBox3fa> root = BVHBuilderMorton::build<std::pair<void*,BBox3fa>>(
+      std::pair<RefitNode*,BBox3fa> root = MortonBuilder::template build<std::pair<RefitNode*,BBox3fa>>(
         
         /* thread local allocator for fast allocations */
         [&] () -> FastAllocator::CachedAllocator { 
@@ -101,33 +137,42 @@ namespace embree
         },
         
         /* lambda function that allocates BVH nodes */
-        [&] ( const FastAllocator::CachedAllocator& alloc, size_t N ) -> void* {
-          return createNode((RTCThreadLocalAllocator)&alloc,N,userPtr);
+        [&] ( const FastAllocator::CachedAllocator& alloc, size_t N ) -> RefitNode* {
+          void* node = createNode((RTCThreadLocalAllocator)&alloc,N,userPtr);
+          return RefitNode::create(alloc,node,N,0);
         },
         
         /* lambda function that sets bounds */
-        [&] (void* node, const std::pair<void*,BBox3fa>* children, size_t N) -> std::pair<void*,BBox3fa>
+        [&] (RefitNode* node, const std::pair<RefitNode*,BBox3fa>* children, size_t N) -> std::pair<RefitNode*,BBox3fa>
         {
           BBox3fa bounds = empty;
           void* childptrs[BVHBuilderMorton::MAX_BRANCHING_FACTOR];
+          RefitNode* childnodes[BVHBuilderMorton::MAX_BRANCHING_FACTOR];
           const RTCBounds* cbounds[BVHBuilderMorton::MAX_BRANCHING_FACTOR];
           for (size_t i=0; i<N; i++) {
             bounds.extend(children[i].second);
-            childptrs[i] = children[i].first;
+            childnodes[i] = children[i].first;
             cbounds[i] = (const RTCBounds*)&children[i].second;
           }
-          setNodeBounds(node,cbounds,N,userPtr);
-          setNodeChildren(node,childptrs,N,userPtr);
+          node->setChildren(childnodes,childptrs);
+          setNodeBounds(node->ptr,cbounds,N,userPtr);
+          setNodeChildren(node->ptr,childptrs,N,userPtr);
           return std::make_pair(node,bounds);
         },
         
         /* lambda function that creates BVH leaves */
-        [&]( const range<unsigned>& current, const FastAllocator::CachedAllocator& alloc) -> std::pair<void*,BBox3fa>
+        [&]( const range<unsigned>& current, const FastAllocator::CachedAllocator& alloc) -> std::pair<RefitNode*,BBox3fa>
         {
-          const size_t id = morton_src[current.begin()].index;
-          const BBox3fa bounds = prims[id].bounds(); 
-          void* node = createLeaf((RTCThreadLocalAllocator)&alloc,prims_i+current.begin(),current.size(),userPtr);
-          return std::make_pair(node,bounds);
+          /* the primitives of the leaf are only sorted through the morton codes */
+          dynamic_large_stack_array(RTCBuildPrimitive,leafPrims,current.size(),MORTON_LEAF_STACK_SIZE*sizeof(RTCBuildPrimitive));
+          BBox3fa bounds = empty;
+          for (size_t i=0; i<current.size(); i++) {
+            const size_t id = morton_src[current.begin()+i].index;
+            bounds.extend(prims[id].bounds());
+            leafPrims[i] = prims_i[id];
+          }
+          void* node = createLeaf((RTCThreadLocalAllocator)&alloc,leafPrims,current.size(),userPtr);
+          return std::make_pair(RefitNode::create(alloc,node,0,current.size()),bounds);
         },
         
         /* lambda that calculates the bounds for some primitive */
@@ -141,10 +186,11 @@ namespace embree
         },
         
         morton_src.data(),morton_tmp.data(),numPrimitives,
-        settings);
+        typename MortonBuilder::Settings(settings));
 
       bvh->allocator.cleanup();
-      return root.first;
+      bvh->root = root.first;
+      return root.first ? root.first->ptr : nullptr;
     }
 
     void* rtcBuildBVHBinnedSAH(BVH* bvh,
@@ -172,7 +218,7 @@ namespace embree
       const PrimInfo pinfo(0,numPrimitives,bounds);
       
       /* build BVH */
-      void* root = BVHBuilderBinnedSAH::build<void*>(
+      RefitNode* root = BVHBuilderBinnedSAH::build<RefitNode*>(
         
         /* thread local allocator for fast allocations */
         [&] () -> FastAllocator::CachedAllocator { 
@@ -180,24 +226,27 @@ namespace embree
         },
 
         /* lambda function that creates BVH nodes */
-        [&](BVHBuilderBinnedSAH::BuildRecord* children, const size_t N, const FastAllocator::CachedAllocator& alloc) -> void*
+        [&](BVHBuilderBinnedSAH::BuildRecord* children, const size_t N, const FastAllocator::CachedAllocator& alloc) -> RefitNode*
         {
           void* node = createNode((RTCThreadLocalAllocator)&alloc,N,userPtr);
           const RTCBounds* cbounds[GeneralBVHBuilder::MAX_BRANCHING_FACTOR];
           for (size_t i=0; i<N; i++) cbounds[i] = (const RTCBounds*) &children[i].prims.geomBounds;
           setNodeBounds(node,cbounds,N,userPtr);
-          return node;
+          return RefitNode::create(alloc,node,N,0);
         },
 
         /* lambda function that updates BVH nodes */
-        [&](const BVHBuilderBinnedSAH::BuildRecord& precord, const BVHBuilderBinnedSAH::BuildRecord* crecords, void* node, void** children, const size_t N) -> void* {
-          setNodeChildren(node,children,N,userPtr);
+        [&](const BVHBuilderBinnedSAH::BuildRecord& precord, const BVHBuilderBinnedSAH::BuildRecord* crecords, RefitNode* node, RefitNode** children, const size_t N) -> RefitNode* {
+          void* childptrs[GeneralBVHBuilder::MAX_BRANCHING_FACTOR];
+          node->setChildren(children,childptrs);
+          setNodeChildren(node->ptr,childptrs,N,userPtr);
           return node;
         },
         
         /* lambda function that creates BVH leaves */
-        [&](const PrimRef* prims, const range<size_t>& range, const FastAllocator::CachedAllocator& alloc) -> void* {
-          return createLeaf((RTCThreadLocalAllocator)&alloc,(RTCBuildPrimitive*)(prims+range.begin()),range.size(),userPtr);
+        [&](const PrimRef* prims, const range<size_t>& range, const FastAllocator::CachedAllocator& alloc) -> RefitNode* {
+          void* node = createLeaf((RTCThreadLocalAllocator)&alloc,(RTCBuildPrimitive*)(prims+range.begin()),range.size(),userPtr);
+          return RefitNode::create(alloc,node,0,range.size());
         },
         
         /* progress monitor function */
@@ -208,7 +257,8 @@ namespace embree
         (PrimRef*)prims,pinfo,settings);
         
       bvh->allocator.cleanup();
-      return root;
+      bvh->root = root;
+      return root ? root->ptr : nullptr;
     }
 
      void* rtcBuildBVHSpatialSAH(BVH* bvh,
@@ -263,7 +313,7 @@ namespace embree
       };
 
       /* build BVH */
-      void* root = BVHBuilderBinnedFastSpatialSAH::build<void*>(
+      RefitNode* root = BVHBuilderBinnedFastSpatialSAH::build<RefitNode*>(
         
         /* thread local allocator for fast allocations */
         [&] () -> FastAllocator::CachedAllocator { 
@@ -271,24 +321,27 @@ namespace embree
         },
 
         /* lambda function that creates BVH nodes */
-        [&] (BVHBuilderBinnedFastSpatialSAH::BuildRecord* children, const size_t N, const FastAllocator::CachedAllocator& alloc) -> void*
+        [&] (BVHBuilderBinnedFastSpatialSAH::BuildRecord* children, const size_t N, const FastAllocator::CachedAllocator& alloc) -> RefitNode*
         {
           void* node = createNode((RTCThreadLocalAllocator)&alloc,N,userPtr);
           const RTCBounds* cbounds[GeneralBVHBuilder::MAX_BRANCHING_FACTOR];
           for (size_t i=0; i<N; i++) cbounds[i] = (const RTCBounds*) &children[i].prims.geomBounds;
           setNodeBounds(node,cbounds,N,userPtr);
-          return node;
+          return RefitNode::create(alloc,node,N,0);
         },
 
         /* lambda function that updates BVH nodes */
-        [&] (const BVHBuilderBinnedFastSpatialSAH::BuildRecord& precord, const BVHBuilderBinnedFastSpatialSAH::BuildRecord* crecords, void* node, void** children, const size_t N) -> void* {
-          setNodeChildren(node,children,N,userPtr);
+        [&] (const BVHBuilderBinnedFastSpatialSAH::BuildRecord& precord, const BVHBuilderBinnedFastSpatialSAH::BuildRecord* crecords, RefitNode* node, RefitNode** children, const size_t N) -> RefitNode* {
+          void* childptrs[GeneralBVHBuilder::MAX_BRANCHING_FACTOR];
+          node->setChildren(children,childptrs);
+          setNodeChildren(node->ptr,childptrs,N,userPtr);
           return node;
         },
         
         /* lambda function that creates BVH leaves */
-        [&] (const PrimRef* prims, const range<size_t>& range, const FastAllocator::CachedAllocator& alloc) -> void* {
-          return createLeaf((RTCThreadLocalAllocator)&alloc,(RTCBuildPrimitive*)(prims+range.begin()),range.size(),userPtr);
+        [&] (const PrimRef* prims, const range<size_t>& range, const FastAllocator::CachedAllocator& alloc) -> RefitNode* {
+          void* node = createLeaf((RTCThreadLocalAllocator)&alloc,(RTCBuildPrimitive*)(prims+range.begin()),range.size(),userPtr);
+          return RefitNode::create(alloc,node,0,range.size());
         },
         
         /* returns the splitter */
@@ -306,7 +359,8 @@ namespace embree
         pinfo,settings);
         
       bvh->allocator.cleanup();
-      return root;
+      bvh->root = root;
+      return root ? root->ptr : nullptr;
     }
 
     RTCORE_API void* rtcBuildBVH(RTCBVH hbvh,
@@ -335,12 +389,15 @@ namespace embree
         throw_RTCError(RTC_INVALID_OPERATION,"static BVH cannot get rebuild");
 
       /* initialize the allocator */
+      bvh->root = nullptr;
       bvh->allocator.init_estimate(numPrimitives*sizeof(BBox3fa));
       bvh->allocator.reset();
 
       /* switch between differnet builders based on quality level */
       if (settings.quality == RTC_BUILD_QUALITY_LOW)
-        return rtcBuildBVHMorton   (bvh,settings,prims,numPrimitives,createNode,setNodeChildren,setNodeBounds,createLeaf,buildProgress,userPtr);
+        return rtcBuildBVHMorton<BVHBuilderMorton>(bvh,settings,prims,numPrimitives,createNode,setNodeChildren,setNodeBounds,createLeaf,buildProgress,userPtr);
+      else if (settings.quality == RTC_BUILD_QUALITY_MEDIUM)
+        return rtcBuildBVHMorton<BVHBuilderPLOC>  (bvh,settings,prims,numPrimitives,createNode,setNodeChildren,setNodeBounds,createLeaf,buildProgress,userPtr);
       else if (settings.quality == RTC_BUILD_QUALITY_NORMAL)
         return rtcBuildBVHBinnedSAH(bvh,settings,prims,numPrimitives,createNode,setNodeChildren,setNodeBounds,createLeaf,buildProgress,userPtr);
       else if (settings.quality == RTC_BUILD_QUALITY_HIGH) {
@@ -356,6 +413,68 @@ namespace embree
       return nullptr;
     }
 
+    BBox3fa refitBVH(RefitNode* node,
+                     RTCLeafBoundsFunc leafBounds,
+                     RTCSetNodeBoundsFunc setNodeBounds,
+                     void* userPtr)
+    {
+      /* leaves compute their bounds from the user data */
+      if (node->numChildren == 0) {
+        BBox3fa bounds = empty;
+        leafBounds(node->ptr,(RTCBounds&)bounds,userPtr);
+        return bounds;
+      }
+
+      /* refit children in parallel for large subtrees */
+      BBox3fa cbounds[GeneralBVHBuilder::MAX_BRANCHING_FACTOR];
+      if (node->numPrimitives > 1024)
+      {
+        parallel_for(size_t(0), node->numChildren, [&] (const range<size_t>& r) {
+            for (size_t i=r.begin(); i<r.end(); i++)
+              cbounds[i] = refitBVH(node->children[i],leafBounds,setNodeBounds,userPtr);
+          });
+      }
+      else
+      {
+        for (size_t i=0; i<node->numChildren; i++)
+          cbounds[i] = refitBVH(node->children[i],leafBounds,setNodeBounds,userPtr);
+      }
+
+      /* update the bounds stored in the node */
+      BBox3fa bounds = empty;
+      const RTCBounds* cboundsptrs[GeneralBVHBuilder::MAX_BRANCHING_FACTOR];
+      for (size_t i=0; i<node->numChildren; i++) {
+        bounds.extend(cbounds[i]);
+        cboundsptrs[i] = (const RTCBounds*) &cbounds[i];
+      }
+      setNodeBounds(node->ptr,cboundsptrs,node->numChildren,userPtr);
+      return bounds;
+    }
+
+    RTCORE_API void* rtcRefitBVH(RTCBVH hbvh,
+                                 RTCLeafBoundsFunc leafBounds,
+                                 RTCSetNodeBoundsFunc setNodeBounds,
+                                 RTCBounds* bounds,
+                                 void* userPtr)
+    {
+      BVH* bvh = (BVH*) hbvh;
+      RTCORE_CATCH_BEGIN;
+      RTCORE_TRACE(rtcRefitBVH);
+      RTCORE_VERIFY_HANDLE(hbvh);
+      RTCORE_VERIFY_HANDLE(leafBounds);
+      RTCORE_VERIFY_HANDLE(setNodeBounds);
+
+      if (bvh->root == nullptr)
+        throw_RTCError(RTC_INVALID_OPERATION,"BVH has to get built before it can get refitted");
+
+      const BBox3fa rootBounds = refitBVH(bvh->root,leafBounds,setNodeBounds,userPtr);
+      if (bounds) *(BBox3fa*)bounds = rootBounds;
+      return bvh->root->ptr;
+
+      RTCORE_CATCH_END(bvh->device);
+      return nullptr;
+    }
+
     RTCORE_API void* rtcThreadLocalAlloc(RTCThreadLocalAllocator localAllocator, size_t bytes, size_t align)
     {
       FastAllocator::CachedAllocator* alloc = (FastAllocator::CachedAllocator*) localAllocator;
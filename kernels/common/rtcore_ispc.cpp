@@ -113,6 +113,22 @@ namespace embree
     return rtcCommit(scene);
   }
 
+  extern "C" void ispcCommitAsync (RTCScene scene) {
+    return rtcCommitAsync(scene);
+  }
+
+  extern "C" bool ispcCommitPoll (RTCScene scene) {
+    return rtcCommitPoll(scene);
+  }
+
+  extern "C" void ispcCommitWait (RTCScene scene) {
+    return rtcCommitWait(scene);
+  }
+
+  extern "C" void ispcSetBuildThreadCount (RTCScene scene, unsigned int numThreads) {
+    rtcSetBuildThreadCount(scene,numThreads);
+  }
+
   extern "C" void ispcCommitJoin (RTCScene scene) {
     return rtcCommitJoin(scene);
   }
@@ -121,6 +137,14 @@ namespace embree
     return rtcCommitThread(scene,threadID,numThreads);
   }
 
+  extern "C" void ispcSaveScene (RTCScene scene, const char* fileName) {
+    rtcSaveScene(scene,fileName);
+  }
+
+  extern "C" void ispcLoadScene (RTCScene scene, const char* fileName) {
+    rtcLoadScene(scene,fileName);
+  }
+
   extern "C" void ispcGetBounds(RTCScene scene, RTCBounds& bounds_o) {
     rtcGetBounds(scene,bounds_o);
   }
@@ -193,6 +217,22 @@ namespace embree
     rtcOccludedNp(scene,context,rays,N);
   }
   
+  extern "C" void ispcPointQuery (RTCScene scene, RTCPointQuery& query) {
+    rtcPointQuery(scene,query);
+  }
+  
+  extern "C" void ispcEnableTraversalStats (RTCScene scene, bool enable) {
+    rtcEnableTraversalStats(scene,enable);
+  }
+  
+  extern "C" void ispcGetTraversalStats (RTCScene scene, RTCTraversalStats* stats) {
+    rtcGetTraversalStats(scene,stats);
+  }
+  
+  extern "C" void ispcResetTraversalStats (RTCScene scene) {
+    rtcResetTraversalStats(scene);
+  }
+  
   extern "C" void ispcDeleteScene (RTCScene scene) {
     rtcDeleteScene(scene);
   }
@@ -212,6 +252,10 @@ namespace embree
   extern "C" void ispcSetTransform2 (RTCScene scene, unsigned geomID, RTCMatrixType layout, const float* xfm, size_t timeStep) {
     return rtcSetTransform2(scene,geomID,layout,xfm,timeStep);
   }
+
+  extern "C" void ispcSetTransformQuaternion (RTCScene scene, unsigned geomID, const RTCQuaternionDecomposition* qd, size_t timeStep) {
+    return rtcSetTransformQuaternion(scene,geomID,qd,timeStep);
+  }
   
   extern "C" unsigned ispcNewUserGeometry (RTCScene scene, RTCGeometryFlags gflags, size_t numItems, size_t numTimeSteps, unsigned int geomID) {
     return rtcNewUserGeometry4(scene,gflags,numItems,numTimeSteps,geomID);
@@ -229,6 +273,10 @@ namespace embree
     return rtcNewLineSegments2(scene,flags,numSegments,numVertices,numTimeSteps,geomID);
   }
 
+  extern "C" unsigned ispcNewPoints (RTCScene scene, RTCGeometryFlags flags, size_t numPoints, size_t numTimeSteps, unsigned int geomID) {
+    return rtcNewPoints2(scene,flags,numPoints,numTimeSteps,geomID);
+  }
+
   extern "C" unsigned ispcNewHairGeometry (RTCScene scene, RTCGeometryFlags flags, size_t numCurves, size_t numVertices, size_t numTimeSteps) {
     return rtcNewHairGeometry(scene,flags,numCurves,numVertices,numTimeSteps);
   }
@@ -271,6 +319,14 @@ namespace embree
     rtcSetBuffer2(scene,geomID,type,ptr,offset,stride,size);
   }
 
+  extern "C" void ispcSetBufferFormat(RTCScene scene, unsigned geomID, RTCBufferType type, RTCFormat format) {
+    rtcSetBufferFormat(scene,geomID,type,format);
+  }
+
+  extern "C" void ispcSetQuantizationBounds(RTCScene scene, unsigned geomID, const RTCBounds* bounds) {
+    rtcSetQuantizationBounds(scene,geomID,*bounds);
+  }
+
   extern "C" void ispcEnable (RTCScene scene, unsigned geomID) {
     rtcEnable(scene,geomID);
   }
@@ -462,6 +518,10 @@ namespace embree
     RTCORE_CATCH_END(scene->device);
   }
 
+  extern "C" void ispcSetPointQueryFunction (RTCScene scene, unsigned geomID, RTCPointQueryFunc pointQuery) {
+    rtcSetPointQueryFunction(scene,geomID,pointQuery);
+  }
+
   extern "C" void ispcSetIntersectionFilterFunction1 (RTCScene hscene, unsigned geomID, RTCFilterFunc filter) 
   {
     Scene* scene = (Scene*) hscene;
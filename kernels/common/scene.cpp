@@ -18,6 +18,7 @@
 
 #include "../bvh/bvh4_factory.h"
 #include "../bvh/bvh8_factory.h"
+#include "../bvh/bvh16_factory.h"
  
 namespace embree
 {
@@ -31,6 +32,7 @@ namespace embree
 
   Scene::Scene (Device* device, RTCSceneFlags sflags, RTCAlgorithmFlags aflags)
     : Accel(AccelData::TY_UNKNOWN),
+      compressedVertices(false), instanceLevels(0),
       device(device), 
       commitCounterSubdiv(0), 
       numMappedBuffers(0),
@@ -40,7 +42,10 @@ namespace embree
       needBezierIndices(false), needBezierVertices(false),
       needLineIndices(false), needLineVertices(false),
       needSubdivIndices(false), needSubdivVertices(false),
+      needPointVertices(false),
       is_build(false), modified(true),
+      bvhFilePtr(nullptr), bvhFileBytes(0), bvhFileLoad(false),
+      commitThread(nullptr), commitFinished(true), commitException(nullptr), frontAccels(&accels), rebuildAccels(false), buildThreadCount(0),
       progressInterface(this), progress_monitor_function(nullptr), progress_monitor_ptr(nullptr), progress_monitor_counter(0), 
       numIntersectionFilters1(0), numIntersectionFilters4(0), numIntersectionFilters8(0), numIntersectionFilters16(0), numIntersectionFiltersN(0)
   {
@@ -68,26 +73,34 @@ namespace embree
       needBezierVertices = true;
       needLineVertices = true;
       needSubdivVertices = true;
+      needPointVertices = true;
     }
 
-    createTriangleAccel();
-    createTriangleMBAccel();
-    createQuadAccel();
-    createQuadMBAccel();
-    createSubdivAccel();
-    createSubdivMBAccel();
-    createHairAccel();
-    createHairMBAccel();
-    createLineAccel();
-    createLineMBAccel();
+    createAccels(accels);
+  }
+
+  void Scene::createAccels(AccelN& accels)
+  {
+    createTriangleAccel(accels);
+    createTriangleMBAccel(accels);
+    createQuadAccel(accels);
+    createQuadMBAccel(accels);
+    createSubdivAccel(accels);
+    createSubdivMBAccel(accels);
+    createHairAccel(accels);
+    createHairMBAccel(accels);
+    createLineAccel(accels);
+    createLineMBAccel(accels);
+    createPointAccel(accels);
+    createPointMBAccel(accels);
 
 #if defined(EMBREE_GEOMETRY_TRIANGLES)
     accels.add(device->bvh4_factory->BVH4InstancedBVH4Triangle4ObjectSplit(this));
 #endif
 
     // has to be the last as the instID field of a hit instance is not invalidated by other hit geometry
-    createUserGeometryAccel();
-    createUserGeometryMBAccel();
+    createUserGeometryAccel(accels);
+    createUserGeometryMBAccel(accels);
   }
 
   void Scene::printStatistics()
@@ -121,7 +134,8 @@ namespace embree
       "subdivs",
       "usergeom",
       "instance",
-      "group"
+      "group",
+      "points"
     };
 
     std::cout << "  segments: ";
@@ -143,7 +157,7 @@ namespace embree
     }
   }
 
-  void Scene::createTriangleAccel()
+  void Scene::createTriangleAccel(AccelN& accels)
   {
 #if defined(EMBREE_GEOMETRY_TRIANGLES)
     if (device->tri_accel == "default") 
@@ -179,7 +193,15 @@ namespace embree
             accels.add(device->bvh4_factory->BVH4Triangle4v(this,BVHFactory::BuildVariant::STATIC,BVHFactory::IntersectVariant::ROBUST));
 
           break;
-        case /*0b10*/ 2: accels.add(device->bvh4_factory->BVH4Triangle4i(this,BVHFactory::BuildVariant::STATIC,BVHFactory::IntersectVariant::FAST  )); break;
+        case /*0b10*/ 2: 
+#if defined (EMBREE_TARGET_SIMD8)
+          /* quantized nodes and shared vertices minimize the memory footprint of large scenes */
+          if (device->hasISA(AVX2))
+            accels.add(device->bvh8_factory->BVH8QuantizedTriangle4i(this));
+          else
+#endif
+            accels.add(device->bvh4_factory->BVH4Triangle4i(this,BVHFactory::BuildVariant::STATIC,BVHFactory::IntersectVariant::FAST));
+          break;
         case /*0b11*/ 3: accels.add(device->bvh4_factory->BVH4Triangle4i(this,BVHFactory::BuildVariant::STATIC,BVHFactory::IntersectVariant::ROBUST)); break;
         }
       }
@@ -220,12 +242,19 @@ namespace embree
     else if (device->tri_accel == "bvh8.triangle4i")      accels.add(device->bvh8_factory->BVH8Triangle4i(this));
     else if (device->tri_accel == "qbvh8.triangle4i")     accels.add(device->bvh8_factory->BVH8QuantizedTriangle4i(this));
     else if (device->tri_accel == "qbvh8.triangle4")      accels.add(device->bvh8_factory->BVH8QuantizedTriangle4(this));
+    else if (device->tri_accel == "bvh8.triangle8")       accels.add(device->bvh8_factory->BVH8Triangle8 (this));
+    else if (device->tri_accel == "bvh8.triangle8v")      accels.add(device->bvh8_factory->BVH8Triangle8v(this,BVHFactory::BuildVariant::STATIC,BVHFactory::IntersectVariant::ROBUST));
+#endif
+#if defined (EMBREE_TARGET_AVX512SKX)
+    else if (device->tri_accel == "bvh16.triangle4")      accels.add(device->bvh16_factory->BVH16Triangle4 (this));
+    else if (device->tri_accel == "bvh16.triangle4v")     accels.add(device->bvh16_factory->BVH16Triangle4v(this,BVHFactory::BuildVariant::STATIC,BVHFactory::IntersectVariant::ROBUST));
+    else if (device->tri_accel == "bvh16.triangle16")     accels.add(device->bvh16_factory->BVH16Triangle16(this));
 #endif
     else throw_RTCError(RTC_INVALID_ARGUMENT,"unknown triangle acceleration structure "+device->tri_accel);
 #endif
   }
 
-  void Scene::createTriangleMBAccel()
+  void Scene::createTriangleMBAccel(AccelN& accels)
   {
 #if defined(EMBREE_GEOMETRY_TRIANGLES)
     if (device->tri_accel_mb == "default")
@@ -263,7 +292,7 @@ namespace embree
 #endif
   }
 
-  void Scene::createQuadAccel()
+  void Scene::createQuadAccel(AccelN& accels)
   {
 #if defined(EMBREE_GEOMETRY_QUADS)
     if (device->quad_accel == "default") 
@@ -301,7 +330,14 @@ namespace embree
             accels.add(device->bvh4_factory->BVH4Quad4v(this,BVHFactory::BuildVariant::STATIC,BVHFactory::IntersectVariant::ROBUST));
           break;
 
-        case /*0b10*/ 2: accels.add(device->bvh4_factory->BVH4Quad4i(this,BVHFactory::BuildVariant::STATIC,BVHFactory::IntersectVariant::FAST)); break;
+        case /*0b10*/ 2:
+#if defined (EMBREE_TARGET_SIMD8)
+          if (device->hasISA(AVX2))
+            accels.add(device->bvh8_factory->BVH8QuantizedQuad4i(this));
+          else
+#endif
+            accels.add(device->bvh4_factory->BVH4Quad4i(this,BVHFactory::BuildVariant::STATIC,BVHFactory::IntersectVariant::FAST));
+          break;
         case /*0b11*/ 3: accels.add(device->bvh4_factory->BVH4Quad4i(this,BVHFactory::BuildVariant::STATIC,BVHFactory::IntersectVariant::ROBUST)); break;
         }
       }
@@ -339,12 +375,16 @@ namespace embree
     else if (device->quad_accel == "bvh8.quad4v")       accels.add(device->bvh8_factory->BVH8Quad4v(this));
     else if (device->quad_accel == "bvh8.quad4i")       accels.add(device->bvh8_factory->BVH8Quad4i(this));
     else if (device->quad_accel == "qbvh8.quad4i")      accels.add(device->bvh8_factory->BVH8QuantizedQuad4i(this));
+    else if (device->quad_accel == "bvh8.quad8v")       accels.add(device->bvh8_factory->BVH8Quad8v(this,BVHFactory::BuildVariant::STATIC,isRobust() ? BVHFactory::IntersectVariant::ROBUST : BVHFactory::IntersectVariant::FAST));
+#endif
+#if defined (EMBREE_TARGET_AVX512SKX)
+    else if (device->quad_accel == "bvh16.quad4v")      accels.add(device->bvh16_factory->BVH16Quad4v(this,BVHFactory::BuildVariant::STATIC,isRobust() ? BVHFactory::IntersectVariant::ROBUST : BVHFactory::IntersectVariant::FAST));
 #endif
     else throw_RTCError(RTC_INVALID_ARGUMENT,"unknown quad acceleration structure "+device->quad_accel);
 #endif
   }
 
-  void Scene::createQuadMBAccel()
+  void Scene::createQuadMBAccel(AccelN& accels)
   {
 #if defined(EMBREE_GEOMETRY_QUADS)
     if (device->quad_accel_mb == "default") 
@@ -381,7 +421,7 @@ namespace embree
 #endif
   }
 
-  void Scene::createHairAccel()
+  void Scene::createHairAccel(AccelN& accels)
   {
 #if defined(EMBREE_GEOMETRY_HAIR)
     if (device->hair_accel == "default")
@@ -432,7 +472,7 @@ namespace embree
 #endif
   }
 
-  void Scene::createHairMBAccel()
+  void Scene::createHairMBAccel(AccelN& accels)
   {
 #if defined(EMBREE_GEOMETRY_HAIR)
     if (device->hair_accel_mb == "default")
@@ -456,7 +496,7 @@ namespace embree
 #endif
   }
 
-  void Scene::createLineAccel()
+  void Scene::createLineAccel(AccelN& accels)
   {
 #if defined(EMBREE_GEOMETRY_LINES)
     if (device->line_accel == "default")
@@ -483,7 +523,7 @@ namespace embree
 #endif
   }
 
-  void Scene::createLineMBAccel()
+  void Scene::createLineMBAccel(AccelN& accels)
   {
 #if defined(EMBREE_GEOMETRY_LINES)
     if (device->line_accel_mb == "default")
@@ -503,7 +543,47 @@ namespace embree
 #endif
   }
 
-  void Scene::createSubdivAccel()
+  void Scene::createPointAccel(AccelN& accels)
+  {
+#if defined(EMBREE_GEOMETRY_POINTS)
+    if (device->point_accel == "default")
+    {
+#if defined (EMBREE_TARGET_SIMD8)
+      if (device->hasISA(AVX) && !isCompact())
+        accels.add(device->bvh8_factory->BVH8Point8i(this));
+      else
+#endif
+        accels.add(device->bvh4_factory->BVH4Point4i(this));
+    }
+    else if (device->point_accel == "bvh4.point4i") accels.add(device->bvh4_factory->BVH4Point4i(this));
+#if defined (EMBREE_TARGET_SIMD8)
+    else if (device->point_accel == "bvh8.point8i") accels.add(device->bvh8_factory->BVH8Point8i(this));
+#endif
+    else throw_RTCError(RTC_INVALID_ARGUMENT,"unknown point acceleration structure "+device->point_accel);
+#endif
+  }
+
+  void Scene::createPointMBAccel(AccelN& accels)
+  {
+#if defined(EMBREE_GEOMETRY_POINTS)
+    if (device->point_accel_mb == "default")
+    {
+#if defined (EMBREE_TARGET_SIMD8)
+      if (device->hasISA(AVX) && !isCompact())
+        accels.add(device->bvh8_factory->BVH8Point8iMB(this));
+      else
+#endif
+        accels.add(device->bvh4_factory->BVH4Point4iMB(this));
+    }
+    else if (device->point_accel_mb == "bvh4.point4imb") accels.add(device->bvh4_factory->BVH4Point4iMB(this));
+#if defined (EMBREE_TARGET_SIMD8)
+    else if (device->point_accel_mb == "bvh8.point8imb") accels.add(device->bvh8_factory->BVH8Point8iMB(this));
+#endif
+    else throw_RTCError(RTC_INVALID_ARGUMENT,"unknown motion blur point acceleration structure "+device->point_accel_mb);
+#endif
+  }
+
+  void Scene::createSubdivAccel(AccelN& accels)
   {
 #if defined(EMBREE_GEOMETRY_SUBDIV)
     if (device->subdiv_accel == "default") 
@@ -521,7 +601,7 @@ namespace embree
 #endif
   }
 
-  void Scene::createSubdivMBAccel()
+  void Scene::createSubdivMBAccel(AccelN& accels)
   {
 #if defined(EMBREE_GEOMETRY_SUBDIV)
     if (device->subdiv_accel_mb == "default") 
@@ -537,7 +617,7 @@ namespace embree
 #endif
   }
 
-  void Scene::createUserGeometryAccel()
+  void Scene::createUserGeometryAccel(AccelN& accels)
   {
 #if defined(EMBREE_GEOMETRY_USER)
     if (device->object_accel == "default") 
@@ -569,7 +649,7 @@ namespace embree
 #endif
   }
 
-  void Scene::createUserGeometryMBAccel()
+  void Scene::createUserGeometryMBAccel(AccelN& accels)
   {
 #if defined(EMBREE_GEOMETRY_USER)
     if (device->object_accel_mb == "default"    ) {
@@ -590,12 +670,20 @@ namespace embree
   
   Scene::~Scene () 
   {
+    /* errors of a pending asynchronous commit cannot get reported anymore */
+    try {
+      commitWait();
+    } catch (...) {
+    }
+
     for (size_t i=0; i<geometries.size(); i++)
       delete geometries[i];
 
 #if defined(TASKING_TBB) || defined(TASKING_PPL)
     delete group; group = nullptr;
 #endif
+
+    os_unmap_file(bvhFilePtr,bvhFileBytes);
   }
 
   void Scene::clear() {
@@ -672,6 +760,15 @@ namespace embree
   }
 #endif
 
+#if defined(EMBREE_GEOMETRY_POINTS)
+  unsigned Scene::newPoints (unsigned geomID, RTCGeometryFlags gflags, size_t numPoints, size_t numTimeSteps)
+  {
+    createPointsTy createPoints = nullptr;
+    SELECT_SYMBOL_DEFAULT_AVX(device->enabled_cpu_features,createPoints);
+    return bind(geomID,createPoints(this,gflags,numPoints,numTimeSteps));
+  }
+#endif
+
   unsigned Scene::bind(unsigned geomID, Geometry* geometry) 
   {
     Lock<SpinLock> lock(geometriesMutex);
@@ -705,18 +802,48 @@ namespace embree
     
     geometry->disable();
     accels.deleteGeometry(unsigned(geomID));
+    if (secondAccels) secondAccels->deleteGeometry(unsigned(geomID));
     id_pool.deallocate((unsigned)geomID);
     geometries[geomID] = nullptr;
     vertices[geomID] = nullptr;
     delete geometry;
   }
 
-  void Scene::updateInterface()
+  /*! ray queries of a double buffered scene traverse the acceleration structures of the last commit */
+  static void intersectCommitted (Accel::Intersectors* This, RTCRay& ray, IntersectContext* context) {
+    ((Scene*)This->ptr)->frontAccels.load()->intersectors.intersect(ray,context);
+  }
+  static void intersectCommitted4 (const void* valid, Accel::Intersectors* This, RTCRay4& ray, IntersectContext* context) {
+    ((Scene*)This->ptr)->frontAccels.load()->intersectors.intersect4(valid,ray,context);
+  }
+  static void intersectCommitted8 (const void* valid, Accel::Intersectors* This, RTCRay8& ray, IntersectContext* context) {
+    ((Scene*)This->ptr)->frontAccels.load()->intersectors.intersect8(valid,ray,context);
+  }
+  static void intersectCommitted16 (const void* valid, Accel::Intersectors* This, RTCRay16& ray, IntersectContext* context) {
+    ((Scene*)This->ptr)->frontAccels.load()->intersectors.intersect16(valid,ray,context);
+  }
+  static void intersectCommittedN (Accel::Intersectors* This, RayK<VSIZEX>** ray, const size_t N, IntersectContext* context) {
+    ((Scene*)This->ptr)->frontAccels.load()->intersectors.intersectN(ray,N,context);
+  }
+  static void occludedCommitted (Accel::Intersectors* This, RTCRay& ray, IntersectContext* context) {
+    ((Scene*)This->ptr)->frontAccels.load()->intersectors.occluded(ray,context);
+  }
+  static void occludedCommitted4 (const void* valid, Accel::Intersectors* This, RTCRay4& ray, IntersectContext* context) {
+    ((Scene*)This->ptr)->frontAccels.load()->intersectors.occluded4(valid,ray,context);
+  }
+  static void occludedCommitted8 (const void* valid, Accel::Intersectors* This, RTCRay8& ray, IntersectContext* context) {
+    ((Scene*)This->ptr)->frontAccels.load()->intersectors.occluded8(valid,ray,context);
+  }
+  static void occludedCommitted16 (const void* valid, Accel::Intersectors* This, RTCRay16& ray, IntersectContext* context) {
+    ((Scene*)This->ptr)->frontAccels.load()->intersectors.occluded16(valid,ray,context);
+  }
+  static void occludedCommittedN (Accel::Intersectors* This, RayK<VSIZEX>** ray, const size_t N, IntersectContext* context) {
+    ((Scene*)This->ptr)->frontAccels.load()->intersectors.occludedN(ray,N,context);
+  }
+
+  void Scene::selectIntersectors(const Accel::Intersectors& in)
   {
-    /* update bounds */
-    is_build = true;
-    bounds = accels.bounds;
-    intersectors = accels.intersectors;
+    intersectors = in;
 
     /* enable only algorithms choosen by application */
     if ((aflags & RTC_INTERSECT_STREAM) == 0) 
@@ -729,6 +856,154 @@ namespace embree
     }
   }
 
+  /*! intersectors that forward ray queries to the acceleration structures of the last commit */
+  static Accel::Intersectors committedIntersectors(Scene* scene)
+  {
+    Accel::Intersectors intersectors;
+    intersectors.ptr = scene;
+    intersectors.intersector1  = Accel::Intersector1 (intersectCommitted  ,occludedCommitted  ,"Scene::committed");
+    intersectors.intersector4  = Accel::Intersector4 (intersectCommitted4 ,occludedCommitted4 ,"Scene::committed");
+    intersectors.intersector8  = Accel::Intersector8 (intersectCommitted8 ,occludedCommitted8 ,"Scene::committed");
+    intersectors.intersector16 = Accel::Intersector16(intersectCommitted16,occludedCommitted16,"Scene::committed");
+    intersectors.intersectorN  = Accel::IntersectorN (intersectCommittedN ,occludedCommittedN ,"Scene::committed");
+    return intersectors;
+  }
+
+  void Scene::enableDoubleBuffering()
+  {
+    if (secondAccels) return;
+    secondAccels.reset(new AccelN);
+    createAccels(*secondAccels);
+    rebuildAccels = true;
+
+    /* a scene that never got committed cannot be in use by ray queries yet */
+    if (is_build) selectIntersectors(committedIntersectors(this));
+  }
+
+  void Scene::updateInterface(AccelN& committed)
+  {
+    /* update bounds */
+    bounds = committed.bounds;
+    frontAccels = &committed;
+
+    /* queries of a double buffered scene switch to the new acceleration structures through frontAccels */
+    if (!secondAccels) selectIntersectors(committed.intersectors);
+    else if (!is_build) selectIntersectors(committedIntersectors(this));
+    is_build = true;
+  }
+
+  void Scene::abortCommit()
+  {
+    /* a double buffered scene keeps the acceleration structures of the last commit */
+    AccelN& target = buildAccels();
+    target.clear();
+    if (&target == frontAccels) updateInterface(target);
+    else rebuildAccels = true;
+  }
+
+  void Scene::updateBuildAccels()
+  {
+    /* the set of acceleration structures the commit builds into was
+     * last built by the commit before the last one, thus it misses the
+     * modifications of the last commit, or all geometries if it is new */
+    std::vector<unsigned> modified;
+    for (size_t i=0; i<geometries.size(); i++)
+      if (geometries[i] && geometries[i]->isModified()) modified.push_back(unsigned(i));
+
+    if (secondAccels && !isStatic())
+    {
+      if (rebuildAccels) {
+        for (size_t i=0; i<geometries.size(); i++)
+          if (geometries[i]) geometries[i]->update();
+      }
+      else {
+        for (unsigned geomID : lastModified)
+          if (geomID < geometries.size() && geometries[geomID]) geometries[geomID]->update();
+      }
+    }
+    rebuildAccels = false;
+    lastModified = std::move(modified);
+  }
+
+  /*! header of a file written by Scene::save */
+  struct SceneFileHeader
+  {
+    char magic[8];            //!< identifies the file as stored scene
+    uint64_t version;         //!< version of the file format
+    uint64_t flags;           //!< scene flags the acceleration structures got build with
+    uint64_t numGeometries;   //!< number of geometry IDs of the scene
+    uint64_t numPrimitives;   //!< number of primitives of the scene
+  };
+
+  static const char sceneFileMagic[8] = { 'E','M','B','R','E','E','S','C' };
+  static const uint64_t sceneFileVersion = 1;
+  static const size_t sceneFileHeaderBytes = (sizeof(SceneFileHeader)+63) & ~size_t(63);
+
+  void Scene::save(const std::string& fileName)
+  {
+    Lock<MutexSys> lock(buildMutex);
+    if (isModified() || !isBuild())
+      throw_RTCError(RTC_INVALID_OPERATION,"scene got not committed");
+
+    std::ofstream out(fileName.c_str(),std::ios::out | std::ios::binary);
+    if (!out.is_open())
+      throw_RTCError(RTC_INVALID_OPERATION,"cannot open file "+fileName);
+
+    SceneFileHeader header{};
+    memcpy(header.magic,sceneFileMagic,sizeof(sceneFileMagic));
+    header.version = sceneFileVersion;
+    header.flags = flags;
+    header.numGeometries = size();
+    header.numPrimitives = numPrimitives();
+    out.write((char*)&header,sizeof(header));
+    AccelData::alignStream(out,64);
+
+    if (!frontAccels.load()->save(out))
+      throw_RTCError(RTC_INVALID_OPERATION,"acceleration structures of scene cannot get stored");
+  }
+
+  void Scene::load(const std::string& fileName)
+  {
+    size_t bytes = 0;
+    char* ptr = (char*) os_map_file(fileName.c_str(),bytes);
+    if (ptr == nullptr)
+      throw_RTCError(RTC_INVALID_OPERATION,"cannot open file "+fileName);
+
+    const SceneFileHeader* header = (const SceneFileHeader*) ptr;
+    if (bytes < sceneFileHeaderBytes || 
+        memcmp(header->magic,sceneFileMagic,sizeof(sceneFileMagic)) != 0 ||
+        header->version != sceneFileVersion ||
+        header->flags != (uint64_t) flags ||
+        header->numGeometries != size() ||
+        header->numPrimitives != numPrimitives())
+    {
+      os_unmap_file(ptr,bytes);
+      throw_RTCError(RTC_INVALID_OPERATION,"file "+fileName+" does not store acceleration structures of this scene");
+    }
+
+    /* the previously loaded file is in use until the commit succeeded */
+    char* oldPtr = bvhFilePtr;
+    size_t oldBytes = bvhFileBytes;
+    bvhFilePtr = ptr;
+    bvhFileBytes = bytes;
+    bvhFileLoad = true;
+    setModified();
+
+    try {
+      commit(0,0,true);
+    }
+    catch (...) {
+      bvhFileLoad = false;
+      bvhFilePtr = oldPtr;
+      bvhFileBytes = oldBytes;
+      os_unmap_file(ptr,bytes);
+      throw;
+    }
+
+    bvhFileLoad = false;
+    os_unmap_file(oldPtr,oldBytes);
+  }
+
   void Scene::commit_task ()
   {
     /* print scene statistics */
@@ -737,19 +1012,44 @@ namespace embree
 
     progress_monitor_counter = 0;
 
+    /* a double buffered scene rebuilds the geometries the other set of acceleration structures got updated for */
+    updateBuildAccels();
+
     /* call preCommit function of each geometry */
+    compressedVertices = false;
     parallel_for(geometries.size(), [&] ( const size_t i ) {
         if (geometries[i]) geometries[i]->preCommit();
       });
 
+    /* determine number of nested instancing levels, the instanced scenes are already committed */
+    instanceLevels = 0;
+    for (size_t i=0; i<geometries.size(); i++) {
+      if (Instance* instance = dynamic_cast<Instance*>(geometries[i]))
+        instanceLevels = max(instanceLevels,instance->object->instanceLevels+1);
+    }
+    if (instanceLevels > RTC_MAX_INSTANCE_LEVEL_COUNT)
+      throw_RTCError(RTC_INVALID_OPERATION,"too many nested instancing levels");
+
+    /* a double buffered scene gets built into the acceleration structures not in use by ray queries */
+    AccelN& accels = buildAccels();
+
     /* select fast code path if no intersection filter is present */
     accels.select(numIntersectionFiltersN+numIntersectionFilters4,
                   numIntersectionFiltersN+numIntersectionFilters8,
                   numIntersectionFiltersN+numIntersectionFilters16,
                   numIntersectionFiltersN);
   
-    /* build all hierarchies of this scene */
-    accels.build();
+    /* adapt the software cache size to the lookups since the last commit */
+    if (world.numSubdivPatches || worldMB.numSubdivPatches)
+      device->adaptCacheSize();
+
+    /* build all hierarchies of this scene, or restore them from a file */
+    if (bvhFileLoad) {
+      if (!accels.load(bvhFilePtr+sceneFileHeaderBytes,bvhFileBytes-sceneFileHeaderBytes))
+        throw_RTCError(RTC_INVALID_OPERATION,"stored acceleration structures do not match scene");
+    }
+    else 
+      accels.build();
 
     /* make static geometry immutable */
     if (isStatic()) accels.immutable();
@@ -759,7 +1059,7 @@ namespace embree
         if (geometries[i]) geometries[i]->postCommit();
       });
       
-    updateInterface();
+    updateInterface(accels);
 
     if (device->verbosity(2)) {
       std::cout << "created scene intersector" << std::endl;
@@ -785,6 +1085,7 @@ namespace embree
       if (scheduler == null) {
         buildLock.lock();
         this->scheduler = scheduler = new TaskScheduler;
+        scheduler->setMaxThreads(buildThreadCount);
       }
     }
 
@@ -815,8 +1116,7 @@ namespace embree
       scheduler->spawn_root([&]() { commit_task(); this->scheduler = nullptr; }, 1, useThreadPool);
     }
     catch (...) {
-      accels.clear();
-      updateInterface();
+      abortCommit();
       throw;
     }
   }
@@ -848,7 +1148,7 @@ namespace embree
       throw_RTCError(RTC_INVALID_OPERATION,"join not supported");
 #endif
 #if USE_TASK_ARENA
-      device->arena->execute([&]{ group->wait(); });
+      arena()->execute([&]{ group->wait(); });
 #else
       group->wait();
 #endif
@@ -856,7 +1156,7 @@ namespace embree
         __pause_cpu();
         yield();
 #if USE_TASK_ARENA
-        device->arena->execute([&]{ group->wait(); });
+        arena()->execute([&]{ group->wait(); });
 #else
         group->wait();
 #endif
@@ -890,7 +1190,7 @@ namespace embree
       //ctx.set_priority(tbb::priority_high);
 
 #if USE_TASK_ARENA
-      device->arena->execute([&]{
+      arena()->execute([&]{
 #endif
           group->run([&]{
               tbb::parallel_for (size_t(0), size_t(1), size_t(1), [&] (size_t) { commit_task(); }, ctx);
@@ -917,13 +1217,183 @@ namespace embree
       /* reset MXCSR register again */
       _mm_setcsr(mxcsr);
       
-      accels.clear();
-      updateInterface();
+      abortCommit();
       throw;
     }
   }
 #endif
 
+#if defined(TASKING_OPENMP)
+
+  void Scene::commit (size_t threadIndex, size_t threadCount, bool useThreadPool) 
+  {
+    /* application threads cannot join a running OpenMP parallel
+     * region, thus in rtcCommitThread mode they wait for the build */
+    if (threadCount != 0 && threadIndex > 0) {
+      group_barrier.wait(threadCount);
+      Lock<MutexSys> wait(buildMutex);
+      return;
+    }
+
+    /* try to obtain build lock */
+    Lock<MutexSys> lock(buildMutex,buildMutex.try_lock());
+
+    /* wait for hierarchy build of other thread to finish */
+    if (!lock.isLocked()) {
+      Lock<MutexSys> wait(buildMutex);
+      return;
+    }
+
+    if (!isModified()) {
+      if (threadCount) group_barrier.wait(threadCount);
+      return;
+    }
+
+    if (!ready()) {
+      if (threadCount) group_barrier.wait(threadCount);
+      throw_RTCError(RTC_INVALID_OPERATION,"not all buffers are unmapped");
+    }
+
+    /* build lock is held, thus the waiting threads can get released */
+    if (threadCount) group_barrier.wait(threadCount);
+
+    /* for best performance set FTZ and DAZ flags in the MXCSR control and status register */
+    unsigned int mxcsr = _mm_getcsr();
+    _mm_setcsr(mxcsr | /* FTZ */ (1<<15) | /* DAZ */ (1<<6));
+    
+    try {
+      TaskScheduler::spawn_root([&]() { commit_task(); }, buildThreadCount);
+
+      /* reset MXCSR register again */
+      _mm_setcsr(mxcsr);
+    } 
+    catch (...) {
+
+      /* reset MXCSR register again */
+      _mm_setcsr(mxcsr);
+      
+      abortCommit();
+      throw;
+    }
+  }
+#endif
+
+  /*! threads get assigned to the slots of the traversal statistics round robin */
+  static std::atomic<size_t> traversalStatsThreads(0);
+  static __thread size_t traversalStatsSlot = size_t(-1);
+
+  void TraversalStats::add(const TraversalCounters& counters)
+  {
+    if (unlikely(traversalStatsSlot == size_t(-1)))
+      traversalStatsSlot = traversalStatsThreads++ % NUM_SLOTS;
+
+    Slot& slot = slots[traversalStatsSlot];
+    slot.rays        += counters.rays;
+    slot.nodes       += counters.nodes;
+    slot.leaves      += counters.leaves;
+    slot.primitives  += counters.primitives;
+    slot.filterCalls += counters.filterCalls;
+    slot.earlyExits  += counters.earlyExits;
+  }
+
+  RTCTraversalStats TraversalStats::get() const
+  {
+    RTCTraversalStats stats;
+    memset(&stats,0,sizeof(stats));
+    for (const Slot& slot : slots) 
+    {
+      stats.rays        += slot.rays;
+      stats.nodes       += slot.nodes;
+      stats.leaves      += slot.leaves;
+      stats.primitives  += slot.primitives;
+      stats.filterCalls += slot.filterCalls;
+      stats.earlyExits  += slot.earlyExits;
+    }
+    return stats;
+  }
+
+  void TraversalStats::clear()
+  {
+    for (Slot& slot : slots) 
+    {
+      slot.rays = 0;
+      slot.nodes = 0;
+      slot.leaves = 0;
+      slot.primitives = 0;
+      slot.filterCalls = 0;
+      slot.earlyExits = 0;
+    }
+  }
+
+  void Scene::commitAsyncThread (Scene* scene)
+  {
+    try {
+      scene->commit(0,0,true);
+    }
+    catch (...) {
+      scene->commitException = std::current_exception();
+    }
+    scene->commitFinished = true;
+  }
+
+  void Scene::commitAsync () 
+  {
+    Lock<MutexSys> lock(commitMutex);
+
+    /* only a single asynchronous commit can be in progress */
+    joinCommitThread();
+
+    /* ray queries continue on the previously committed acceleration structures during the build */
+    enableDoubleBuffering();
+
+    commitFinished = false;
+    commitException = nullptr;
+    commitThread = createThread((thread_func)commitAsyncThread,this);
+  }
+
+  bool Scene::commitPoll ()
+  {
+    if (!commitFinished) return false;
+    commitWait();
+    return true;
+  }
+
+  void Scene::commitWait ()
+  {
+    Lock<MutexSys> lock(commitMutex);
+    joinCommitThread();
+  }
+
+  void Scene::joinCommitThread ()
+  {
+    if (commitThread == nullptr) 
+      return;
+
+    join(commitThread);
+    commitThread = nullptr;
+
+    /* report errors of the commit to the waiting thread */
+    if (commitException) {
+      std::exception_ptr e = commitException;
+      commitException = nullptr;
+      std::rethrow_exception(e);
+    }
+  }
+
+  void Scene::setBuildThreadCount (size_t numThreads)
+  {
+#if (defined(TASKING_TBB) && !USE_TASK_ARENA) || defined(TASKING_PPL)
+    if (numThreads)
+      throw_RTCError(RTC_INVALID_OPERATION,"build thread count cannot get limited with this tasking system");
+#endif
+    Lock<MutexSys> lock(buildMutex);
+    buildThreadCount = numThreads;
+#if USE_TASK_ARENA
+    if (numThreads) buildArena.reset(new tbb::task_arena((int)numThreads));
+    else            buildArena.reset();
+#endif
+  }
+
   void Scene::setProgressMonitorFunction(RTCProgressMonitorFunc func, void* ptr) 
   {
     static MutexSys mutex;
@@ -25,6 +25,7 @@
 #include "scene_geometry_instance.h"
 #include "scene_bezier_curves.h"
 #include "scene_line_segments.h"
+#include "scene_points.h"
 #include "scene_subdiv_mesh.h"
 
 #include "../subdiv/tessellation_cache.h"
@@ -34,6 +35,42 @@
 
 namespace embree
 {
+  /*! Traversal statistics of a scene. The counters are distributed
+   *  over multiple cache lines to reduce contention between threads. */
+  class TraversalStats
+  {
+    static const size_t NUM_SLOTS = 16;
+
+    struct __aligned(64) Slot
+    {
+      std::atomic<size_t> rays;
+      std::atomic<size_t> nodes;
+      std::atomic<size_t> leaves;
+      std::atomic<size_t> primitives;
+      std::atomic<size_t> filterCalls;
+      std::atomic<size_t> earlyExits;
+    };
+
+  public:
+    TraversalStats () 
+      : enabled(false) { clear(); }
+
+    /*! adds the counters of a traversal */
+    void add(const TraversalCounters& counters);
+
+    /*! returns the sum of all counters */
+    RTCTraversalStats get() const;
+
+    /*! resets all counters to zero */
+    void clear();
+
+  public:
+    bool enabled;
+
+  private:
+    Slot slots[NUM_SLOTS];
+  };
+
   /*! Base class all scenes are derived from */
   class Scene : public Accel
   {
@@ -109,18 +146,21 @@ namespace embree
     Scene& operator= (const Scene& other) DELETED; // do not implement
 
   public:
-    void createTriangleAccel();
-    void createQuadAccel();
-    void createTriangleMBAccel();
-    void createQuadMBAccel();
-    void createHairAccel();
-    void createHairMBAccel();
-    void createLineAccel();
-    void createLineMBAccel();
-    void createSubdivAccel();
-    void createSubdivMBAccel();
-    void createUserGeometryAccel();
-    void createUserGeometryMBAccel();
+    void createAccels(AccelN& accels);
+    void createTriangleAccel(AccelN& accels);
+    void createQuadAccel(AccelN& accels);
+    void createTriangleMBAccel(AccelN& accels);
+    void createQuadMBAccel(AccelN& accels);
+    void createHairAccel(AccelN& accels);
+    void createHairMBAccel(AccelN& accels);
+    void createLineAccel(AccelN& accels);
+    void createLineMBAccel(AccelN& accels);
+    void createPointAccel(AccelN& accels);
+    void createPointMBAccel(AccelN& accels);
+    void createSubdivAccel(AccelN& accels);
+    void createSubdivMBAccel(AccelN& accels);
+    void createUserGeometryAccel(AccelN& accels);
+    void createUserGeometryMBAccel(AccelN& accels);
 
     /*! Scene destruction */
     ~Scene ();
@@ -155,6 +195,9 @@ namespace embree
     /*! Creates a new collection of line segments. */
     unsigned int newLineSegments (unsigned int geomID, RTCGeometryFlags flags, size_t maxSegments, size_t maxVertices, size_t numTimeSteps);
 
+    /*! Creates a new collection of points. */
+    unsigned int newPoints (unsigned int geomID, RTCGeometryFlags flags, size_t numPoints, size_t numTimeSteps);
+
     /*! Creates a new subdivision mesh. */
     unsigned int newSubdivisionMesh (unsigned int geomID, RTCGeometryFlags flags, size_t numFaces, size_t numEdges, size_t numVertices, size_t numEdgeCreases, size_t numVertexCreases, size_t numHoles, size_t numTimeSteps);
 
@@ -166,7 +209,55 @@ namespace embree
     void commit_task ();
     void build () {}
 
-    void updateInterface();
+    /*! starts committing the scene in a separate thread */
+    void commitAsync ();
+
+    /*! returns true if no asynchronous commit is in progress anymore */
+    bool commitPoll ();
+
+    /*! waits until the asynchronous commit finished */
+    void commitWait ();
+
+    /*! limits the number of threads used to build the scene, 0 means unlimited */
+    void setBuildThreadCount (size_t numThreads);
+
+  private:
+    static void commitAsyncThread (Scene* scene);
+
+    /*! joins the thread of the asynchronous commit, requires commitMutex to be held */
+    void joinCommitThread ();
+
+    /*! creates the second set of acceleration structures, ray queries get forwarded to the committed set afterwards */
+    void enableDoubleBuffering ();
+
+    /*! returns the acceleration structures the next commit builds into */
+    AccelN& buildAccels() {
+      return secondAccels && frontAccels == &accels ? *secondAccels : accels;
+    }
+
+    /*! sets the intersectors of the scene, restricted to the algorithms enabled by the application */
+    void selectIntersectors(const Accel::Intersectors& in);
+
+    /*! releases the acceleration structures of a failed commit */
+    void abortCommit ();
+
+    /*! marks the geometries the acceleration structures of the next commit are outdated for as modified */
+    void updateBuildAccels ();
+
+  public:
+
+    void updateInterface(AccelN& committed);
+
+    /*! stores the acceleration structures of a committed scene into a file */
+    void save(const std::string& fileName);
+
+    /*! commits the scene using the acceleration structures stored in a file */
+    void load(const std::string& fileName);
+
+    /*! finds the closest point on the surface of the scene within the query radius */
+    __forceinline void pointQuery(RTCPointQuery& query) {
+      frontAccels.load()->pointQuery(query);
+    }
 
     /* return number of geometries */
     __forceinline size_t size() const { return geometries.size(); }
@@ -245,6 +336,8 @@ namespace embree
     IDPool<unsigned> id_pool;
     std::vector<Geometry*> geometries; //!< list of all user geometries
     vector<int*> vertices;
+    std::atomic<bool> compressedVertices; //!< true if some triangle or quad mesh uses a compressed vertex format
+    unsigned instanceLevels;              //!< number of nested instancing levels below this scene
     
   public:
     Device* device;
@@ -263,10 +356,38 @@ namespace embree
     bool needLineVertices;
     bool needSubdivIndices;
     bool needSubdivVertices;
+    bool needPointVertices;
     MutexSys buildMutex;
     SpinLock geometriesMutex;
     bool is_build;
     bool modified;                   //!< true if scene got modified
+
+    /*! memory mapped acceleration structure file */
+    char* bvhFilePtr;                //!< start of the mapped file
+    size_t bvhFileBytes;             //!< size of the mapped file
+    bool bvhFileLoad;                //!< true if next commit restores the acceleration structures from the mapped file
+
+    /*! traversal statistics */
+    TraversalStats traversalStats;
+
+    /*! asynchronous commit */
+    MutexSys commitMutex;               //!< guards the thread of the asynchronous commit
+    thread_t commitThread;              //!< thread performing the asynchronous commit
+    std::atomic<bool> commitFinished;   //!< true once the asynchronous commit finished
+    std::exception_ptr commitException; //!< error raised by the asynchronous commit
+
+    /*! double buffering of asynchronously committed scenes */
+    std::unique_ptr<AccelN> secondAccels; //!< second set of acceleration structures, created by the first asynchronous commit
+    std::atomic<AccelN*> frontAccels;     //!< acceleration structures of the last commit, traversed by ray queries
+    std::vector<unsigned> lastModified;   //!< IDs of the geometries modified by the last commit, only built into one set
+    bool rebuildAccels;                   //!< all geometries have to get rebuilt by the next commit
+
+    /*! thread budget of the build */
+    size_t buildThreadCount;            //!< maximal number of threads building the scene, 0 means unlimited
+#if USE_TASK_ARENA
+    std::unique_ptr<tbb::task_arena> buildArena; //!< isolated arena used when the thread count is limited
+    tbb::task_arena* arena() { return buildArena ? buildArena.get() : device->arena.get(); }
+#endif
     
     /*! global lock step task scheduler */
 #if defined(TASKING_INTERNAL) 
@@ -278,6 +399,8 @@ namespace embree
 #elif defined(TASKING_PPL)
     concurrency::task_group* group;
     BarrierActiveAutoReset group_barrier;
+#elif defined(TASKING_OPENMP)
+    BarrierActiveAutoReset group_barrier;
 #endif
     
   public:
@@ -299,10 +422,10 @@ namespace embree
     struct GeometryCounts 
     {
       __forceinline GeometryCounts()
-        : numTriangles(0), numQuads(0), numBezierCurves(0), numLineSegments(0), numSubdivPatches(0), numUserGeometries(0) {}
+        : numTriangles(0), numQuads(0), numBezierCurves(0), numLineSegments(0), numSubdivPatches(0), numUserGeometries(0), numPoints(0) {}
 
       __forceinline size_t size() const {
-        return numTriangles + numQuads + numBezierCurves + numLineSegments + numSubdivPatches + numUserGeometries;
+        return numTriangles + numQuads + numBezierCurves + numLineSegments + numSubdivPatches + numUserGeometries + numPoints;
       }
 
       std::atomic<size_t> numTriangles;             //!< number of enabled triangles
@@ -311,6 +434,7 @@ namespace embree
       std::atomic<size_t> numLineSegments;          //!< number of enabled line segments
       std::atomic<size_t> numSubdivPatches;         //!< number of enabled subdivision patches
       std::atomic<size_t> numUserGeometries;        //!< number of enabled user geometries
+      std::atomic<size_t> numPoints;                //!< number of enabled points
     };
     
     GeometryCounts world;               //!< counts for non-motion blurred geometry
@@ -355,4 +479,6 @@ namespace embree
   template<> __forceinline size_t Scene::getNumPrimitives<SubdivMesh,true>() const { return worldMB.numSubdivPatches; }
   template<> __forceinline size_t Scene::getNumPrimitives<AccelSet,false>() const { return world.numUserGeometries; }
   template<> __forceinline size_t Scene::getNumPrimitives<AccelSet,true>() const { return worldMB.numUserGeometries; }
+  template<> __forceinline size_t Scene::getNumPrimitives<Points,false>() const { return world.numPoints; }
+  template<> __forceinline size_t Scene::getNumPrimitives<Points,true>() const { return worldMB.numPoints; }
 }
@@ -29,7 +29,7 @@ namespace embree
   }
 
   Instance::Instance (Scene* scene, Scene* object, size_t numTimeSteps) 
-    : AccelSet(scene,RTC_GEOMETRY_STATIC,1,numTimeSteps), object(object)
+    : AccelSet(scene,RTC_GEOMETRY_STATIC,1,numTimeSteps), object(object), quaternionMotion(false)
   {
     world2local0 = one;
     for (size_t i=0; i<numTimeSteps; i++) local2world[i] = one;
@@ -49,6 +49,90 @@ namespace embree
 
     local2world[timeStep] = xfm;
     if (timeStep == 0) world2local0 = rcp(xfm);
+    quaternionMotion = false;
+  }
+
+  void Instance::setQuaternionDecomposition(const QuaternionDecomposition& qd, size_t timeStep)
+  {
+    if (scene->isStatic() && scene->isBuild())
+      throw_RTCError(RTC_INVALID_OPERATION,"static scenes cannot get modified");
+
+    if (timeStep >= numTimeSteps)
+      throw_RTCError(RTC_INVALID_OPERATION,"invalid timestep");
+
+    /* timesteps not specified yet use the identity transformation */
+    if (!quaternionMotion) {
+      quaternionDecompositions.resize(numTimeSteps);
+      for (size_t i=0; i<numTimeSteps; i++) {
+        quaternionDecompositions[i] = QuaternionDecomposition(one);
+        local2world[i] = one;
+      }
+      world2local0 = one;
+      quaternionMotion = true;
+    }
+    
+    quaternionDecompositions[timeStep] = qd;
+    local2world[timeStep] = qd.local2world();
+    if (timeStep == 0) world2local0 = qd.world2local();
+  }
+
+  void Instance::preCommit()
+  {
+    Geometry::preCommit();
+    if (numTimeSteps == 1) return;
+
+    /* precalculate the inverse linear part of segments that only translate, and the interpolation of the rotations */
+    segments.resize(numTimeSegments());
+    for (size_t i=0; i<segments.size(); i++)
+    {
+      MotionSegment& segment = segments[i];
+      segment.constantLinear = local2world[i].l == local2world[i+1].l;
+      segment.world2local = segment.constantLinear ? rcp(local2world[i].l) : LinearSpace3fa(one);
+      segment.quaternion1 = one;
+      segment.angle = 0.0f;
+      segment.rcpSinAngle = 0.0f;
+      if (!quaternionMotion) continue;
+
+      const Quaternion3f& q0 = quaternionDecompositions[i+0].quaternion;
+      const Quaternion3f& q1 = quaternionDecompositions[i+1].quaternion;
+      const float cosAngle = q0.r*q1.r + q0.i*q1.i + q0.j*q1.j + q0.k*q1.k;
+      segment.quaternion1 = cosAngle < 0.0f ? -q1 : q1;
+      segment.angle = acos(min(abs(cosAngle),1.0f));
+      segment.rcpSinAngle = segment.angle > 1E-3f ? 1.0f/sin(segment.angle) : 0.0f;
+    }
+  }
+
+  BBox3fa Instance::quaternionBounds(size_t itime) const
+  {
+    const QuaternionDecomposition& qd0 = quaternionDecompositions[itime+0];
+    const QuaternionDecomposition& qd1 = quaternionDecompositions[itime+1];
+    const MotionSegment& segment = segments[itime];
+
+    /* for each point of the instanced scene, the scaled, skewed, and
+     * shifted position changes linearly over the segment */
+    const float time0 = float(itime+0)/float(numTimeSegments());
+    const float time1 = float(itime+1)/float(numTimeSegments());
+    const BBox3fa obounds = merge(object->bounds.interpolate(time0),object->bounds.interpolate(time1));
+    const BBox3fa sbounds = merge(xfmBounds(AffineSpace3fa(qd0.scaleSkew(),qd0.shift),obounds),
+                                  xfmBounds(AffineSpace3fa(qd1.scaleSkew(),qd1.shift),obounds));
+    const Vec3fa center = sbounds.center();
+    const Vec3fa radius(length(sbounds.size())*0.5f);
+
+    /* the rotated center moves along a circular arc, which deviates
+     * from the line between its end points by at most the sagitta */
+    BBox3fa rbounds;
+    const float centerDist = length(center);
+    if (2.0f*segment.angle <= float(pi)) {
+      const Vec3fa sagitta(centerDist*(1.0f-cos(segment.angle)));
+      rbounds = merge(BBox3fa(LinearSpace3fa(qd0.quaternion)*center),BBox3fa(LinearSpace3fa(qd1.quaternion)*center));
+      rbounds = BBox3fa(rbounds.lower-sagitta,rbounds.upper+sagitta);
+    } else {
+      rbounds = BBox3fa(Vec3fa(-centerDist),Vec3fa(centerDist));
+    }
+
+    /* the rotated offsets to the center stay within the radius, and the translation changes linearly */
+    const BBox3fa tbounds = merge(BBox3fa(qd0.translation),BBox3fa(qd1.translation));
+    return BBox3fa(rbounds.lower+tbounds.lower-radius,rbounds.upper+tbounds.upper+radius);
   }
 
   void Instance::setMask (unsigned mask) 
@@ -29,6 +29,48 @@ namespace embree
     DEFINE_SYMBOL2(AccelSet::IntersectorN,InstanceIntersectorN);
   };
 
+  /*! Transformation of an instance decomposed into scale/skew/shift,
+   *  rotation, and translation, which get interpolated separately. */
+  struct QuaternionDecomposition
+  {
+    __forceinline QuaternionDecomposition () {}
+
+    __forceinline QuaternionDecomposition (OneTy)
+      : scale(one), skew(zero), shift(zero), translation(zero), quaternion(one) {}
+
+    /*! returns the upper triangular scale/skew matrix */
+    __forceinline LinearSpace3fa scaleSkew() const {
+      return LinearSpace3fa(Vec3fa(scale.x,0.0f,0.0f),Vec3fa(skew.x,scale.y,0.0f),Vec3fa(skew.y,skew.z,scale.z));
+    }
+
+    /*! returns the transformation from local to world space */
+    __forceinline AffineSpace3fa local2world() const 
+    {
+      const LinearSpace3fa R(quaternion);
+      return AffineSpace3fa(R*scaleSkew(),R*shift+translation);
+    }
+
+    /*! returns the transformation from world to local space, inverting
+     *  the triangular scale/skew matrix and the rotation is cheaper
+     *  than a general matrix inversion */
+    __forceinline AffineSpace3fa world2local() const 
+    {
+      const float ra = 1.0f/scale.x, rd = 1.0f/scale.y, rf = 1.0f/scale.z;
+      const LinearSpace3fa S_inv(Vec3fa(ra,0.0f,0.0f),
+                                 Vec3fa(-skew.x*ra*rd,rd,0.0f),
+                                 Vec3fa((skew.x*skew.z-skew.y*scale.y)*ra*rd*rf,-skew.z*rd*rf,rf));
+      const LinearSpace3fa l = S_inv*LinearSpace3fa(quaternion).transposed();
+      return AffineSpace3fa(l,-(l*translation)-S_inv*shift);
+    }
+
+  public:
+    Vec3fa scale;             //!< scaling along the axes
+    Vec3fa skew;              //!< skew of the axes (xy,xz,yz)
+    Vec3fa shift;             //!< shift before the rotation
+    Vec3fa translation;       //!< translation after the rotation
+    Quaternion3f quaternion;  //!< normalized rotation quaternion
+  };
+
   /*! Instanced acceleration structure */
   struct Instance : public AccelSet
   {
@@ -41,19 +83,51 @@ namespace embree
     Instance (Scene* scene, Scene* object, size_t numTimeSteps); 
   public:
     virtual void setTransform(const AffineSpace3fa& local2world, size_t timeStep);
+    virtual void setQuaternionDecomposition(const QuaternionDecomposition& qd, size_t timeStep);
     virtual void setMask (unsigned mask);
+    virtual void preCommit();
     virtual void build() {}
 
+    /*! returns conservative bounds of the instance over some time segment of quaternion motion */
+    BBox3fa quaternionBounds(size_t itime) const;
+
   public:
 
     __forceinline AffineSpace3fa getWorld2Local() const {
       return world2local0;
     }
 
+    /*! interpolates the decomposed transformation, using spherical linear interpolation of the rotation */
+    __forceinline QuaternionDecomposition interpolateQuaternionDecomposition(size_t itime, float ftime) const
+    {
+      const QuaternionDecomposition& qd0 = quaternionDecompositions[itime+0];
+      const QuaternionDecomposition& qd1 = quaternionDecompositions[itime+1];
+      const MotionSegment& segment = segments[itime];
+      QuaternionDecomposition qd;
+      qd.scale = lerp(qd0.scale,qd1.scale,ftime);
+      qd.skew  = lerp(qd0.skew ,qd1.skew ,ftime);
+      qd.shift = lerp(qd0.shift,qd1.shift,ftime);
+      qd.translation = lerp(qd0.translation,qd1.translation,ftime);
+      if (unlikely(segment.rcpSinAngle == 0.0f))
+        qd.quaternion = normalize((1.0f-ftime)*qd0.quaternion + ftime*segment.quaternion1);
+      else
+        qd.quaternion = (sin((1.0f-ftime)*segment.angle)*segment.rcpSinAngle)*qd0.quaternion + (sin(ftime*segment.angle)*segment.rcpSinAngle)*segment.quaternion1;
+      return qd;
+    }
+
     __forceinline AffineSpace3fa getWorld2Local(float t) const 
     {
       float ftime;
       const size_t itime = getTimeSegment(t, fnumTimeSegments, ftime);
+      const MotionSegment& segment = segments[itime];
+      
+      /* only the translation changes, thus the inverse linear part got precalculated */
+      if (likely(segment.constantLinear)) {
+        const Vec3fa p = lerp(local2world[itime+0].p,local2world[itime+1].p,ftime);
+        return AffineSpace3fa(segment.world2local,-(segment.world2local*p));
+      }
+      if (quaternionMotion)
+        return interpolateQuaternionDecomposition(itime,ftime).world2local();
       return rcp(lerp(local2world[itime+0],local2world[itime+1],ftime));
     }
 
@@ -66,9 +140,29 @@ namespace embree
       const size_t index = __bsf(movemask(valid));
       const int itime = itime_k[index];
       const vfloat<K> t0 = vfloat<K>(1.0f)-ftime, t1 = ftime;
-      if (likely(all(valid,itime_k == vint<K>(itime)))) {
-        return rcp(t0*AffineSpace3vf<K>(local2world[itime+0])+t1*AffineSpace3vf<K>(local2world[itime+1]));
-      } 
+      if (likely(all(valid,itime_k == vint<K>(itime))))
+      {
+        const MotionSegment& segment = segments[itime];
+        if (likely(segment.constantLinear)) {
+          const LinearSpace3vf<K> l(segment.world2local);
+          const Vec3vf<K> p = t0*Vec3vf<K>(local2world[itime+0].p)+t1*Vec3vf<K>(local2world[itime+1].p);
+          return AffineSpace3vf<K>(l,-(l*p));
+        }
+        if (!quaternionMotion)
+          return rcp(t0*AffineSpace3vf<K>(local2world[itime+0])+t1*AffineSpace3vf<K>(local2world[itime+1]));
+      }
+
+      /* the rotation of quaternion motion gets interpolated for each ray */
+      if (quaternionMotion)
+      {
+        AffineSpace3vf<K> world2local;
+        for (size_t bits=movemask(valid); bits!=0; bits=__blsr(bits)) {
+          const size_t k = __bsf(bits);
+          const vbool<K> lane = vint<K>(step) == vint<K>(int(k));
+          world2local = select(lane,AffineSpace3vf<K>(getWorld2Local(t[k])),world2local);
+        }
+        return world2local;
+      }
       else {
         AffineSpace3vf<K> space0,space1;
         foreach_unique(valid,itime_k,[&] (const vbool<K>& valid, int itime) {
@@ -79,8 +173,22 @@ namespace embree
       }
     }
     
+  public:
+    /*! data precalculated for each time segment of a motion blurred instance */
+    struct MotionSegment
+    {
+      LinearSpace3fa world2local;  //!< inverse of the linear part of the transformation, if it is constant over the segment
+      Quaternion3f quaternion1;    //!< rotation at the end of the segment, negated if required to interpolate along the shorter arc
+      float angle;                 //!< angle between the quaternions at the segment boundaries, half of the rotation angle
+      float rcpSinAngle;           //!< reciprocal sine of that angle, 0 for small angles
+      bool constantLinear;         //!< true if only the translation changes over the segment
+    };
+
   public:
     Scene* object;                 //!< pointer to instanced acceleration structure
+    bool quaternionMotion;         //!< true if the transformations are interpolated as scale/skew/shift, rotation, and translation
+    avector<QuaternionDecomposition> quaternionDecompositions; //!< decomposed transformation for each timestep
+    avector<MotionSegment> segments; //!< precalculated data of each time segment
     AffineSpace3fa world2local0;   //!< transformation from world space to local space for timestep 0
     AffineSpace3fa local2world[1]; //!< transformation from local space to world space for each timestep
   };
@@ -0,0 +1,194 @@
+// ======================================================================== //
+// Copyright 2009-2017 Intel Corporation                                    //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ======================================================================== //
+
+#pragma once
+
+#include "default.h"
+#include "geometry.h"
+#include "buffer.h"
+
+namespace embree
+{
+  /*! represents an array of points that are rendered as spheres or oriented discs */
+  struct Points : public Geometry
+  {
+    /*! type of this geometry */
+    static const Geometry::Type geom_type = Geometry::POINTS;
+
+  public:
+
+    /*! points construction */
+    Points (Scene* scene, RTCGeometryFlags flags, size_t numPoints, size_t numTimeSteps);
+
+  public:
+    void enabling();
+    void disabling();
+    void setMask (unsigned mask);
+    void setBuffer(RTCBufferType type, void* ptr, size_t offset, size_t stride, size_t size);
+    void* map(RTCBufferType type);
+    void unmap(RTCBufferType type);
+    void immutable ();
+    bool verify ();
+    void interpolate(unsigned primID, float u, float v, RTCBufferType buffer, float* P, float* dPdu, float* dPdv, float* ddPdudu, float* ddPdvdv, float* ddPdudv, size_t numFloats);
+
+  public:
+
+    /*! returns number of points */
+    __forceinline size_t size() const {
+      return numPrimitives;
+    }
+
+    /*! returns the number of vertices */
+    __forceinline size_t numVertices() const {
+      return vertices[0].size();
+    }
+
+    /*! returns true if the points are rendered as oriented discs */
+    __forceinline bool isOrientedDisc() const {
+      return orientedDiscs;
+    }
+
+    /*! returns i'th vertex of the first time step */
+    __forceinline Vec3fa vertex(size_t i) const {
+      return vertices0[i];
+    }
+
+    /*! returns i'th vertex of the first time step */
+    __forceinline const char* vertexPtr(size_t i) const {
+      return vertices0.getPtr(i);
+    }
+
+    /*! returns i'th radius of the first time step */
+    __forceinline float radius(size_t i) const {
+      return vertices0[i].w;
+    }
+
+    /*! returns i'th vertex of itime'th timestep */
+    __forceinline Vec3fa vertex(size_t i, size_t itime) const {
+      return vertices[itime][i];
+    }
+
+    /*! returns i'th vertex of itime'th timestep */
+    __forceinline const char* vertexPtr(size_t i, size_t itime) const {
+      return vertices[itime].getPtr(i);
+    }
+
+    /*! returns i'th radius of itime'th timestep */
+    __forceinline float radius(size_t i, size_t itime) const {
+      return vertices[itime][i].w;
+    }
+
+    /*! returns i'th normal of itime'th timestep */
+    __forceinline Vec3fa normal(size_t i, size_t itime) const {
+      return normals[itime][i];
+    }
+
+    /*! returns i'th normal of itime'th timestep */
+    __forceinline const char* normalPtr(size_t i, size_t itime) const {
+      return normals[itime].getPtr(i);
+    }
+
+    /*! calculates bounding box of i'th point for the itime'th time step */
+    __forceinline BBox3fa bounds(size_t i, size_t itime = 0) const
+    {
+      const Vec3fa v = vertex(i,itime);
+      const float r = v.w;
+      if (!orientedDiscs)
+        return enlarge(BBox3fa(v),Vec3fa(r));
+
+      /* a disc only extends perpendicular to its normal */
+      const Vec3fa n = normalize(normal(i,itime));
+      const Vec3fa e = r*sqrt(max(Vec3fa(zero),Vec3fa(one)-n*n));
+      return enlarge(BBox3fa(v),e);
+    }
+
+    /*! check if the i'th primitive is valid at the itime'th timestep */
+    __forceinline bool valid(size_t i, size_t itime) const {
+      return valid(i, make_range(itime, itime));
+    }
+
+    /*! check if the i'th primitive is valid between the specified time range */
+    __forceinline bool valid(size_t i, const range<size_t>& itime_range) const
+    {
+      if (i >= numVertices()) return false;
+
+      for (size_t itime = itime_range.begin(); itime <= itime_range.end(); itime++)
+      {
+        const Vec3fa v = vertex(i,itime);
+        if (unlikely(!isvalid((vfloat4)v))) return false;
+        if (v.w < 0.0f) return false;
+        if (orientedDiscs) {
+          const Vec3fa n = normal(i,itime);
+          if (unlikely(!isvalid(n))) return false;
+          if (dot(n,n) == 0.0f) return false;
+        }
+      }
+      return true;
+    }
+
+    /*! calculates the linear bounds of the i'th primitive at the itimeGlobal'th time segment */
+    __forceinline LBBox3fa linearBounds(size_t i, size_t itime) const {
+      return LBBox3fa(bounds(i,itime+0),bounds(i,itime+1));
+    }
+
+    /*! calculates the build bounds of the i'th primitive, if it's valid */
+    __forceinline bool buildBounds(size_t i, BBox3fa* bbox) const
+    {
+      if (!valid(i,0)) return false;
+      *bbox = bounds(i);
+      return true;
+    }
+
+    /*! calculates the build bounds of the i'th primitive at the itime'th time segment, if it's valid */
+    __forceinline bool buildBounds(size_t i, size_t itime, BBox3fa& bbox) const
+    {
+      if (!valid(i,itime+0) || !valid(i,itime+1)) return false;
+      bbox = bounds(i,itime);  // use bounds of first time step in builder
+      return true;
+    }
+
+    /*! calculates the linear bounds of the i'th primitive for the specified time range */
+    __forceinline LBBox3fa linearBounds(size_t primID, const BBox1f& time_range) const {
+      return LBBox3fa([&] (size_t itime) { return bounds(primID, itime); }, time_range, fnumTimeSegments);
+    }
+
+    /*! calculates the linear bounds of the i'th primitive for the specified time range */
+    __forceinline bool linearBounds(size_t i, const BBox1f& time_range, LBBox3fa& bbox) const
+    {
+      if (!valid(i, getTimeSegmentRange(time_range, fnumTimeSegments))) return false;
+      bbox = linearBounds(i, time_range);
+      return true;
+    }
+
+  public:
+    BufferRefT<Vec3fa> vertices0;                     //!< fast access to first vertex buffer
+    vector<APIBuffer<Vec3fa>> vertices;               //!< vertex array for each timestep
+    vector<APIBuffer<Vec3fa>> normals;                //!< optional normal array for each timestep
+    vector<APIBuffer<char>> userbuffers;              //!< user buffers
+    bool orientedDiscs;                               //!< true if a normal buffer turns the points into oriented discs
+  };
+
+  namespace isa
+  {
+    struct PointsISA : public Points
+    {
+      PointsISA (Scene* scene, RTCGeometryFlags flags, size_t numPoints, size_t numTimeSteps)
+        : Points(scene,flags,numPoints,numTimeSteps) {}
+    };
+  }
+
+  DECLARE_ISA_FUNCTION(Points*, createPoints, Scene* COMMA RTCGeometryFlags COMMA size_t COMMA size_t);
+}
@@ -22,7 +22,8 @@ namespace embree
 #if defined(EMBREE_LOWEST_ISA)
 
   QuadMesh::QuadMesh (Scene* scene, RTCGeometryFlags flags, size_t numQuads, size_t numVertices, size_t numTimeSteps)
-    : Geometry(scene,QUAD_MESH,numQuads,numTimeSteps,flags)
+    : Geometry(scene,QUAD_MESH,numQuads,numTimeSteps,flags),
+      vertexFormat(RTC_FORMAT_FLOAT3), indexFormat(RTC_FORMAT_UINT), quantizationLower(zero), quantizationScale(one)
   {
     quads.init(scene->device,numQuads,sizeof(Quad));
     vertices.resize(numTimeSteps);
@@ -58,11 +59,16 @@ namespace embree
     if (scene->isStatic() && scene->isBuild()) 
       throw_RTCError(RTC_INVALID_OPERATION,"static scenes cannot get modified");
 
-    /* verify that all accesses are 4 bytes aligned */
-    if (((size_t(ptr) + offset) & 0x3) || (stride & 0x3)) 
-      throw_RTCError(RTC_INVALID_OPERATION,"data must be 4 bytes aligned");
-
     unsigned bid = type & 0xFFFF;
+    const bool compressed = 
+      (type >= RTC_VERTEX_BUFFER0 && type < RTCBufferType(RTC_VERTEX_BUFFER0 + numTimeSteps) && vertexFormat != RTC_FORMAT_FLOAT3) ||
+      (type == RTC_INDEX_BUFFER && indexFormat != RTC_FORMAT_UINT);
+
+    /* verify that all accesses are 4 bytes aligned, or 2 bytes aligned for compressed formats */
+    const size_t alignMask = compressed ? 0x1 : 0x3;
+    if (((size_t(ptr) + offset) & alignMask) || (stride & alignMask)) 
+      throw_RTCError(RTC_INVALID_OPERATION,compressed ? "data must be 2 bytes aligned" : "data must be 4 bytes aligned");
+
     if (type >= RTC_VERTEX_BUFFER0 && type < RTCBufferType(RTC_VERTEX_BUFFER0 + numTimeSteps)) 
     {
       size_t t = type - RTC_VERTEX_BUFFER0;
@@ -73,7 +79,7 @@ namespace embree
        throw_RTCError(RTC_INVALID_OPERATION,"vertex buffer can be at most 16GB large");
 
       vertices[t].set(ptr,offset,stride,size); 
-      vertices[t].checkPadding16();
+      if (!compressed) vertices[t].checkPadding16();
       vertices0 = vertices[0];
     } 
     else if (type >= RTC_USER_VERTEX_BUFFER0 && type < RTC_USER_VERTEX_BUFFER0+RTC_MAX_USER_VERTEX_BUFFERS)
@@ -94,6 +100,39 @@ namespace embree
       throw_RTCError(RTC_INVALID_ARGUMENT,"unknown buffer type");
   }
 
+  void QuadMesh::setBufferFormat(RTCBufferType type, RTCFormat format)
+  {
+    if (scene->isStatic() && scene->isBuild()) 
+      throw_RTCError(RTC_INVALID_OPERATION,"static scenes cannot get modified");
+
+    if (type >= RTC_VERTEX_BUFFER0 && type < RTCBufferType(RTC_VERTEX_BUFFER0 + numTimeSteps)) 
+    {
+      if (format != RTC_FORMAT_FLOAT3 && format != RTC_FORMAT_HALF3 && format != RTC_FORMAT_QUANTIZED16x3)
+        throw_RTCError(RTC_INVALID_ARGUMENT,"invalid vertex buffer format");
+      vertexFormat = format;
+    }
+    else if (type == RTC_INDEX_BUFFER) 
+    {
+      if (format != RTC_FORMAT_UINT && format != RTC_FORMAT_USHORT)
+        throw_RTCError(RTC_INVALID_ARGUMENT,"invalid index buffer format");
+      indexFormat = format;
+    }
+    else
+      throw_RTCError(RTC_INVALID_ARGUMENT,"unknown buffer type");
+
+    Geometry::update();
+  }
+
+  void QuadMesh::setQuantizationBounds(const BBox3fa& bounds)
+  {
+    if (scene->isStatic() && scene->isBuild()) 
+      throw_RTCError(RTC_INVALID_OPERATION,"static scenes cannot get modified");
+
+    quantizationLower = bounds.lower;
+    quantizationScale = (bounds.upper-bounds.lower)*(1.0f/65535.0f);
+    Geometry::update();
+  }
+
   void* QuadMesh::map(RTCBufferType type) 
   {
     if (scene->isStatic() && scene->isBuild())
@@ -134,6 +173,10 @@ namespace embree
     for (size_t t=0; t<numTimeSteps; t++)
       if (vertices[t].getStride() != vertices[0].getStride())
         throw_RTCError(RTC_INVALID_OPERATION,"stride of vertex buffers have to be identical for each time step");
+
+    /* leaves that reference the vertex buffers have to decode compressed vertices */
+    if (vertexFormat != RTC_FORMAT_FLOAT3 && isEnabled())
+      scene->compressedVertices = true;
   }
 
   void QuadMesh::postCommit () 
@@ -162,16 +205,17 @@ namespace embree
 
     /*! verify quad indices */
     for (size_t i=0; i<quads.size(); i++) {     
-      if (quads[i].v[0] >= numVertices()) return false; 
-      if (quads[i].v[1] >= numVertices()) return false; 
-      if (quads[i].v[2] >= numVertices()) return false; 
-      if (quads[i].v[3] >= numVertices()) return false; 
+      const Quad q = quad(i);
+      if (q.v[0] >= numVertices()) return false; 
+      if (q.v[1] >= numVertices()) return false; 
+      if (q.v[2] >= numVertices()) return false; 
+      if (q.v[3] >= numVertices()) return false; 
     }
 
     /*! verify vertices */
-    for (const auto& buffer : vertices)
-      for (size_t i=0; i<buffer.size(); i++)
-	if (!isvalid(buffer[i])) 
+    for (size_t t=0; t<numTimeSteps; t++)
+      for (size_t i=0; i<vertices[t].size(); i++)
+	if (!isvalid(vertex(i,t))) 
 	  return false;
 
     return true;
@@ -196,6 +240,29 @@ namespace embree
     } else {
       src    = vertices[buffer&0xFFFF].getPtr();
       stride = vertices[buffer&0xFFFF].getStride();
+
+      /* compressed vertices get decoded, which provides at most 3 floats */
+      if (vertexFormat != RTC_FORMAT_FLOAT3)
+      {
+        const Quad q = quad(primID);
+        const bool left = u+v <= 1.0f;
+        const Vec3fa Q0 = vertex(q.v[left ? 0 : 2],buffer&0xFFFF);
+        const Vec3fa Q1 = vertex(q.v[left ? 1 : 3],buffer&0xFFFF);
+        const Vec3fa Q2 = vertex(q.v[left ? 3 : 1],buffer&0xFFFF);
+        const float U = left ? u : 1.0f-u;
+        const float V = left ? v : 1.0f-v;
+        const float W = 1.0f-U-V;
+        for (size_t i=0; i<min(numFloats,size_t(3)); i++)
+        {
+          if (P) P[i] = W*Q0[i] + U*Q1[i] + V*Q2[i];
+          if (dPdu) { 
+            dPdu[i] = left ? Q1[i]-Q0[i] : Q0[i]-Q1[i]; 
+            dPdv[i] = left ? Q2[i]-Q0[i] : Q0[i]-Q2[i]; 
+          }
+          if (ddPdudu) { ddPdudu[i] = 0.0f; ddPdvdv[i] = 0.0f; ddPdudv[i] = 0.0f; }
+        }
+        return;
+      }
     }
 
     for (size_t i=0; i<numFloats; i+=VSIZEX)
@@ -22,7 +22,8 @@ namespace embree
 #if defined(EMBREE_LOWEST_ISA)
 
   TriangleMesh::TriangleMesh (Scene* scene, RTCGeometryFlags flags, size_t numTriangles, size_t numVertices, size_t numTimeSteps)
-    : Geometry(scene,TRIANGLE_MESH,numTriangles,numTimeSteps,flags)
+    : Geometry(scene,TRIANGLE_MESH,numTriangles,numTimeSteps,flags),
+      vertexFormat(RTC_FORMAT_FLOAT3), indexFormat(RTC_FORMAT_UINT), quantizationLower(zero), quantizationScale(one)
   {
     triangles.init(scene->device,numTriangles,sizeof(Triangle));
     vertices.resize(numTimeSteps);
@@ -58,11 +59,16 @@ namespace embree
     if (scene->isStatic() && scene->isBuild()) 
       throw_RTCError(RTC_INVALID_OPERATION,"static scenes cannot get modified");
 
-    /* verify that all accesses are 4 bytes aligned */
-    if (((size_t(ptr) + offset) & 0x3) || (stride & 0x3)) 
-      throw_RTCError(RTC_INVALID_OPERATION,"data must be 4 bytes aligned");
-
     unsigned bid = type & 0xFFFF;
+    const bool compressed = 
+      (type >= RTC_VERTEX_BUFFER0 && type < RTCBufferType(RTC_VERTEX_BUFFER0 + numTimeSteps) && vertexFormat != RTC_FORMAT_FLOAT3) ||
+      (type == RTC_INDEX_BUFFER && indexFormat != RTC_FORMAT_UINT);
+
+    /* verify that all accesses are 4 bytes aligned, or 2 bytes aligned for compressed formats */
+    const size_t alignMask = compressed ? 0x1 : 0x3;
+    if (((size_t(ptr) + offset) & alignMask) || (stride & alignMask)) 
+      throw_RTCError(RTC_INVALID_OPERATION,compressed ? "data must be 2 bytes aligned" : "data must be 4 bytes aligned");
+
     if (type >= RTC_VERTEX_BUFFER0 && type < RTCBufferType(RTC_VERTEX_BUFFER0 + numTimeSteps)) 
     {
        size_t t = type - RTC_VERTEX_BUFFER0;
@@ -73,7 +79,7 @@ namespace embree
        throw_RTCError(RTC_INVALID_OPERATION,"vertex buffer can be at most 16GB large");
 
       vertices[t].set(ptr,offset,stride,size);
-      vertices[t].checkPadding16();
+      if (!compressed) vertices[t].checkPadding16();
       vertices0 = vertices[0];
     } 
     else if (type >= RTC_USER_VERTEX_BUFFER0 && type < RTC_USER_VERTEX_BUFFER0+RTC_MAX_USER_VERTEX_BUFFERS)
@@ -94,6 +100,39 @@ namespace embree
       throw_RTCError(RTC_INVALID_ARGUMENT,"unknown buffer type");
   }
 
+  void TriangleMesh::setBufferFormat(RTCBufferType type, RTCFormat format)
+  {
+    if (scene->isStatic() && scene->isBuild()) 
+      throw_RTCError(RTC_INVALID_OPERATION,"static scenes cannot get modified");
+
+    if (type >= RTC_VERTEX_BUFFER0 && type < RTCBufferType(RTC_VERTEX_BUFFER0 + numTimeSteps)) 
+    {
+      if (format != RTC_FORMAT_FLOAT3 && format != RTC_FORMAT_HALF3 && format != RTC_FORMAT_QUANTIZED16x3)
+        throw_RTCError(RTC_INVALID_ARGUMENT,"invalid vertex buffer format");
+      vertexFormat = format;
+    }
+    else if (type == RTC_INDEX_BUFFER) 
+    {
+      if (format != RTC_FORMAT_UINT && format != RTC_FORMAT_USHORT)
+        throw_RTCError(RTC_INVALID_ARGUMENT,"invalid index buffer format");
+      indexFormat = format;
+    }
+    else
+      throw_RTCError(RTC_INVALID_ARGUMENT,"unknown buffer type");
+
+    Geometry::update();
+  }
+
+  void TriangleMesh::setQuantizationBounds(const BBox3fa& bounds)
+  {
+    if (scene->isStatic() && scene->isBuild()) 
+      throw_RTCError(RTC_INVALID_OPERATION,"static scenes cannot get modified");
+
+    quantizationLower = bounds.lower;
+    quantizationScale = (bounds.upper-bounds.lower)*(1.0f/65535.0f);
+    Geometry::update();
+  }
+
   void* TriangleMesh::map(RTCBufferType type) 
   {
     if (scene->isStatic() && scene->isBuild())
@@ -134,6 +173,10 @@ namespace embree
     for (size_t t=0; t<numTimeSteps; t++)
       if (vertices[t].getStride() != vertices[0].getStride())
         throw_RTCError(RTC_INVALID_OPERATION,"stride of vertex buffers have to be identical for each time step");
+
+    /* leaves that reference the vertex buffers have to decode compressed vertices */
+    if (vertexFormat != RTC_FORMAT_FLOAT3 && isEnabled())
+      scene->compressedVertices = true;
   }
 
   void TriangleMesh::postCommit () 
@@ -167,15 +210,16 @@ namespace embree
 
     /*! verify triangle indices */
     for (size_t i=0; i<triangles.size(); i++) {     
-      if (triangles[i].v[0] >= numVertices()) return false; 
-      if (triangles[i].v[1] >= numVertices()) return false; 
-      if (triangles[i].v[2] >= numVertices()) return false; 
+      const Triangle tri = triangle(i);
+      if (tri.v[0] >= numVertices()) return false; 
+      if (tri.v[1] >= numVertices()) return false; 
+      if (tri.v[2] >= numVertices()) return false; 
     }
 
     /*! verify vertices */
-    for (const auto& buffer : vertices)
-      for (size_t i=0; i<buffer.size(); i++)
-	if (!isvalid(buffer[i])) 
+    for (size_t t=0; t<numTimeSteps; t++)
+      for (size_t i=0; i<vertices[t].size(); i++)
+	if (!isvalid(vertex(i,t))) 
 	  return false;
 
     return true;
@@ -200,6 +244,23 @@ namespace embree
     } else {
       src    = vertices[buffer&0xFFFF].getPtr();
       stride = vertices[buffer&0xFFFF].getStride();
+
+      /* compressed vertices get decoded, which provides at most 3 floats */
+      if (vertexFormat != RTC_FORMAT_FLOAT3)
+      {
+        const float w = 1.0f-u-v;
+        const Triangle tri = triangle(primID);
+        const Vec3fa p0 = vertex(tri.v[0],buffer&0xFFFF);
+        const Vec3fa p1 = vertex(tri.v[1],buffer&0xFFFF);
+        const Vec3fa p2 = vertex(tri.v[2],buffer&0xFFFF);
+        for (size_t i=0; i<min(numFloats,size_t(3)); i++)
+        {
+          if (P) P[i] = w*p0[i] + u*p1[i] + v*p2[i];
+          if (dPdu) { dPdu[i] = p1[i]-p0[i]; dPdv[i] = p2[i]-p0[i]; }
+          if (ddPdudu) { ddPdudu[i] = 0.0f; ddPdvdv[i] = 0.0f; ddPdudv[i] = 0.0f; }
+        }
+        return;
+      }
     }
     
     for (size_t i=0; i<numFloats; i+=VSIZEX)
@@ -49,6 +49,8 @@ namespace embree
     void disabling();
     void setMask (unsigned mask);
     void setBuffer(RTCBufferType type, void* ptr, size_t offset, size_t stride, size_t size);
+    void setBufferFormat(RTCBufferType type, RTCFormat format);
+    void setQuantizationBounds(const BBox3fa& bounds);
     void* map(RTCBufferType type);
     void unmap(RTCBufferType type);
     void preCommit();
@@ -71,13 +73,22 @@ namespace embree
     }
     
     /*! returns i'th triangle*/
-    __forceinline const Triangle& triangle(size_t i) const {
-      return triangles[i];
+    __forceinline const Triangle triangle(size_t i) const 
+    {
+      if (likely(indexFormat == RTC_FORMAT_UINT)) 
+        return triangles[i];
+
+      const uint16_t* idx = (const uint16_t*) triangles.getPtr(i);
+      Triangle tri; tri.v[0] = idx[0]; tri.v[1] = idx[1]; tri.v[2] = idx[2];
+      return tri;
     }
 
     /*! returns i'th vertex of the first time step  */
-    __forceinline const Vec3fa vertex(size_t i) const {
-      return vertices0[i];
+    __forceinline const Vec3fa vertex(size_t i) const 
+    {
+      if (likely(vertexFormat == RTC_FORMAT_FLOAT3)) 
+        return vertices0[i];
+      return decodeVertex(vertices0.getPtr(i),vertexFormat,quantizationLower,quantizationScale);
     }
 
     /*! returns i'th vertex of the first time step */
@@ -86,8 +97,11 @@ namespace embree
     }
 
     /*! returns i'th vertex of itime'th timestep */
-    __forceinline const Vec3fa vertex(size_t i, size_t itime) const {
-      return vertices[itime][i];
+    __forceinline const Vec3fa vertex(size_t i, size_t itime) const 
+    {
+      if (likely(vertexFormat == RTC_FORMAT_FLOAT3)) 
+        return vertices[itime][i];
+      return decodeVertex(vertices[itime].getPtr(i),vertexFormat,quantizationLower,quantizationScale);
     }
 
     /*! returns i'th vertex of itime'th timestep */
@@ -95,6 +109,20 @@ namespace embree
       return vertices[itime].getPtr(i);
     }
 
+    /*! returns the factor leaves referencing vertices multiply the vertex index with, 
+     *  float vertices are referenced by their 4 byte offset, compressed vertices by their index */
+    __forceinline unsigned leafVertexScale() const {
+      return vertexFormat == RTC_FORMAT_FLOAT3 ? vertices0.getStride()/4 : 1;
+    }
+
+    /*! returns the vertex referenced by a leaf at the itime'th timestep */
+    __forceinline const Vec3fa leafVertex(int ofs, size_t itime) const 
+    {
+      if (likely(vertexFormat == RTC_FORMAT_FLOAT3))
+        return Vec3fa::loadu((const int*)vertices[itime].getPtr()+ofs);
+      return decodeVertex(vertices[itime].getPtr(ofs),vertexFormat,quantizationLower,quantizationScale);
+    }
+
     /*! calculates the bounds of the i'th triangle */
     __forceinline BBox3fa bounds(size_t i) const 
     {
@@ -213,6 +241,10 @@ namespace embree
     BufferRefT<Vec3fa> vertices0;                     //!< fast access to first vertex buffer
     vector<APIBuffer<Vec3fa>> vertices;               //!< vertex array for each timestep
     vector<APIBuffer<char>> userbuffers;         //!< user buffers
+    RTCFormat vertexFormat;                      //!< format of the vertex buffers
+    RTCFormat indexFormat;                       //!< format of the index buffer
+    Vec3fa quantizationLower;                    //!< lower bounds of quantized vertices
+    Vec3fa quantizationScale;                    //!< scale of quantized vertices
   };
 
   namespace isa
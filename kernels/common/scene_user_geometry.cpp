@@ -177,4 +177,12 @@ namespace embree
 
     intersectors.intersectorN.occluded = occluded;
   }
+
+  void UserGeometry::setPointQueryFunction (RTCPointQueryFunc pointQuery) 
+  {
+    if (scene->isStatic() && scene->isBuild())
+      throw_RTCError(RTC_INVALID_OPERATION,"static scenes cannot get modified");
+
+    this->pointQueryFunc = pointQuery;
+  }
 }
@@ -40,6 +40,7 @@ namespace embree
     virtual void setOccludedFunction8 (RTCOccludedFunc8 occluded8, bool ispc);
     virtual void setOccludedFunction16 (RTCOccludedFunc16 occluded16, bool ispc);
     virtual void setOccludedFunctionN (RTCOccludedFuncN occluded);
+    virtual void setPointQueryFunction (RTCPointQueryFunc pointQuery);
     virtual void build() {}
   };
 }
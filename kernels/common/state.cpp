@@ -74,6 +74,14 @@ namespace embree
     line_accel_mb = "default";
     line_builder_mb = "default";
     line_traverser_mb = "default";
+
+    point_accel = "default";
+    point_builder = "default";
+    point_traverser = "default";
+
+    point_accel_mb = "default";
+    point_builder_mb = "default";
+    point_traverser_mb = "default";
     
     hair_accel = "default";
     hair_builder = "default";
@@ -104,6 +112,8 @@ namespace embree
       if (singledevice) tessellation_cache_size = 128*1024*1024;
 #endif
 
+    tessellation_cache_max_size = 0;
+
     subdiv_accel = "default";
     subdiv_accel_mb = "default";
 
@@ -127,8 +137,12 @@ namespace embree
 #endif
     /* per default enable affinity on KNL */
     if (hasISA(AVX512KNL)) set_affinity = true;
+    numa = false;
+    relayout = false;
+    restructure = false;
 
     start_threads = false;
+    spin_count = 32;
     enable_selockmemoryprivilege = false;
 #if defined(__LINUX__)
     hugepages = true;
@@ -254,9 +268,21 @@ namespace embree
 
       else if (tok == Token::Id("affinity")&& cin->trySymbol("=")) 
         set_affinity = cin->get().Int();
+
+      else if (tok == Token::Id("numa")&& cin->trySymbol("=")) 
+        numa = cin->get().Int();
+
+      else if (tok == Token::Id("relayout")&& cin->trySymbol("=")) 
+        relayout = cin->get().Int();
+
+      else if (tok == Token::Id("restructure")&& cin->trySymbol("=")) 
+        restructure = cin->get().Int();
       
       else if (tok == Token::Id("start_threads")&& cin->trySymbol("=")) 
         start_threads = cin->get().Int();
+
+      else if (tok == Token::Id("spin_count")&& cin->trySymbol("=")) 
+        spin_count = cin->get().Int();
       
       else if (tok == Token::Id("isa") && cin->trySymbol("=")) {
         std::string isa = toLowerCase(cin->get().Identifier());
@@ -328,6 +354,20 @@ namespace embree
         line_builder_mb = cin->get().Identifier();
       else if ((tok == Token::Id("line_traverser_mb")) && cin->trySymbol("="))
         line_traverser_mb = cin->get().Identifier();
+
+      else if ((tok == Token::Id("point_accel")) && cin->trySymbol("="))
+        point_accel = cin->get().Identifier();
+      else if ((tok == Token::Id("point_builder")) && cin->trySymbol("="))
+        point_builder = cin->get().Identifier();
+      else if ((tok == Token::Id("point_traverser")) && cin->trySymbol("="))
+        point_traverser = cin->get().Identifier();
+
+      else if ((tok == Token::Id("point_accel_mb")) && cin->trySymbol("="))
+        point_accel_mb = cin->get().Identifier();
+      else if ((tok == Token::Id("point_builder_mb")) && cin->trySymbol("="))
+        point_builder_mb = cin->get().Identifier();
+      else if ((tok == Token::Id("point_traverser_mb")) && cin->trySymbol("="))
+        point_traverser_mb = cin->get().Identifier();
       
       else if (tok == Token::Id("hair_accel") && cin->trySymbol("="))
         hair_accel = cin->get().Identifier();
@@ -409,6 +449,10 @@ namespace embree
         tessellation_cache_size = size_t(cin->get().Float()*1024.0f*1024.0f);
       else if (tok == Token::Id("cache_size") && cin->trySymbol("="))
         tessellation_cache_size = size_t(cin->get().Float()*1024.0f*1024.0f);
+      else if (tok == Token::Id("tessellation_cache_max_size") && cin->trySymbol("="))
+        tessellation_cache_max_size = size_t(cin->get().Float()*1024.0f*1024.0f);
+      else if (tok == Token::Id("cache_max_size") && cin->trySymbol("="))
+        tessellation_cache_max_size = size_t(cin->get().Float()*1024.0f*1024.0f);
 
       else if (tok == Token::Id("alloc_main_block_size") && cin->trySymbol("="))
         alloc_main_block_size = cin->get().Int();
@@ -433,6 +477,10 @@ namespace embree
     std::cout << "  build threads = " << numThreads   << std::endl;
     std::cout << "  start_threads = " << start_threads << std::endl;
     std::cout << "  affinity      = " << set_affinity << std::endl;
+    std::cout << "  spin_count    = " << spin_count << std::endl;
+    std::cout << "  numa          = " << numa << " (" << getNumberOfNumaNodes() << " nodes)" << std::endl;
+    std::cout << "  relayout      = " << relayout << std::endl;
+    std::cout << "  restructure   = " << restructure << std::endl;
     
     std::cout << "  hugepages     = ";
     if (!hugepages) std::cout << "disabled" << std::endl;
@@ -441,6 +489,7 @@ namespace embree
 
     std::cout << "  verbosity     = " << verbose << std::endl;
     std::cout << "  cache_size    = " << float(tessellation_cache_size)*1E-6 << " MB" << std::endl;
+    std::cout << "  cache_max_size = " << float(tessellation_cache_max_size)*1E-6 << " MB" << std::endl;
     std::cout << "  max_spatial_split_replications = " << max_spatial_split_replications << std::endl;
     
     std::cout << "triangles:" << std::endl;
@@ -472,6 +521,16 @@ namespace embree
     std::cout << "  accel         = " << line_accel_mb << std::endl;
     std::cout << "  builder       = " << line_builder_mb << std::endl;
     std::cout << "  traverser     = " << line_traverser_mb << std::endl;
+
+    std::cout << "points:" << std::endl;
+    std::cout << "  accel         = " << point_accel << std::endl;
+    std::cout << "  builder       = " << point_builder << std::endl;
+    std::cout << "  traverser     = " << point_traverser << std::endl;
+
+    std::cout << "motion blur points:" << std::endl;
+    std::cout << "  accel         = " << point_accel_mb << std::endl;
+    std::cout << "  builder       = " << point_builder_mb << std::endl;
+    std::cout << "  traverser     = " << point_traverser_mb << std::endl;
     
     std::cout << "hair:" << std::endl;
     std::cout << "  accel         = " << hair_accel << std::endl;
@@ -83,6 +83,16 @@ namespace embree
     std::string line_builder_mb;           //!< builder to use for motion blur line segments
     std::string line_traverser_mb;         //!< traverser to use for motion blur line segments
 
+  public:
+    std::string point_accel;               //!< acceleration structure to use for points
+    std::string point_builder;             //!< builder to use for points
+    std::string point_traverser;           //!< traverser to use for points
+
+  public:
+    std::string point_accel_mb;            //!< acceleration structure to use for motion blur points
+    std::string point_builder_mb;          //!< builder to use for motion blur points
+    std::string point_traverser_mb;        //!< traverser to use for motion blur points
+
   public:
     std::string hair_accel;                //!< hair acceleration structure to use
     std::string hair_builder;              //!< builder to use for hair
@@ -112,6 +122,7 @@ namespace embree
   public:
     float max_spatial_split_replications;  //!< maximally replications*N many primitives in accel for spatial splits
     size_t tessellation_cache_size;        //!< size of the shared tessellation cache 
+    size_t tessellation_cache_max_size;    //!< maximal size of the adaptive tessellation cache (0 disables adaptation)
 
   public:
     size_t instancing_open_min;            //!< instancing opens tree to minimally that number of subtrees
@@ -130,7 +141,11 @@ namespace embree
   public:
     size_t numThreads;                     //!< number of threads to use in builders
     bool set_affinity;                     //!< sets affinity for worker threads
+    bool numa;                             //!< NUMA aware thread placement and BVH memory allocation
+    bool relayout;                         //!< stores BVH nodes and leaves in traversal order after the build
+    bool restructure;                      //!< restructures small treelets of high quality BVHs after the build
     bool start_threads;                    //!< true when threads should be started at device creation time
+    size_t spin_count;                     //!< number of yield rounds idle worker threads spin before they block
     int enabled_cpu_features;              //!< CPU ISA features to use
     int enabled_builder_cpu_features;      //!< CPU ISA features to use for builders only
     bool enable_selockmemoryprivilege;     //!< configures the SeLockMemoryPrivilege under Windows to enable huge pages
@@ -0,0 +1,105 @@
+// ======================================================================== //
+// Copyright 2009-2017 Intel Corporation                                    //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ======================================================================== //
+
+#pragma once
+
+#include "../common/default.h"
+#include "../common/rtcore.h"
+
+namespace embree
+{
+  namespace isa
+  {
+    /*! Computes the closest points to p on the M triangles (a,b,c). The
+     *  Voronoi regions of the triangle features are tested from the
+     *  interior to the vertices, thus vertex regions take precedence
+     *  over edge regions, which take precedence over the interior. */
+    template<int M>
+      __forceinline Vec3vf<M> closestPointTriangle(const Vec3vf<M>& p, const Vec3vf<M>& a, const Vec3vf<M>& b, const Vec3vf<M>& c)
+    {
+      const Vec3vf<M> ab = b-a;
+      const Vec3vf<M> ac = c-a;
+      const Vec3vf<M> ap = p-a;
+      const Vec3vf<M> bp = p-b;
+      const Vec3vf<M> cp = p-c;
+      const vfloat<M> d1 = dot(ab,ap), d2 = dot(ac,ap);
+      const vfloat<M> d3 = dot(ab,bp), d4 = dot(ac,bp);
+      const vfloat<M> d5 = dot(ab,cp), d6 = dot(ac,cp);
+      const vfloat<M> va = d3*d6 - d5*d4;
+      const vfloat<M> vb = d5*d2 - d1*d6;
+      const vfloat<M> vc = d1*d4 - d3*d2;
+
+      /* interior of the triangle */
+      const vfloat<M> rcpDen = rcp(va+vb+vc);
+      Vec3vf<M> q = a + (vb*rcpDen)*ab + (vc*rcpDen)*ac;
+
+      /* edge BC */
+      const vfloat<M> d43 = d4-d3, d56 = d5-d6;
+      const vbool<M> inBC = (va <= 0.0f) & (d43 >= 0.0f) & (d56 >= 0.0f);
+      q = select(inBC, b + (d43/(d43+d56))*(c-b), q);
+
+      /* edge AC */
+      const vbool<M> inAC = (vb <= 0.0f) & (d2 >= 0.0f) & (d6 <= 0.0f);
+      q = select(inAC, a + (d2/(d2-d6))*ac, q);
+
+      /* vertex C */
+      const vbool<M> inC = (d6 >= 0.0f) & (d5 <= d6);
+      q = select(inC, c, q);
+
+      /* edge AB */
+      const vbool<M> inAB = (vc <= 0.0f) & (d1 >= 0.0f) & (d3 <= 0.0f);
+      q = select(inAB, a + (d1/(d1-d3))*ab, q);
+
+      /* vertex B */
+      const vbool<M> inB = (d3 >= 0.0f) & (d4 <= d3);
+      q = select(inB, b, q);
+
+      /* vertex A */
+      const vbool<M> inA = (d1 <= 0.0f) & (d2 <= 0.0f);
+      q = select(inA, a, q);
+      return q;
+    }
+
+    /*! Computes the closest points to p on the M line segments (a,b). */
+    template<int M>
+      __forceinline Vec3vf<M> closestPointLine(const Vec3vf<M>& p, const Vec3vf<M>& a, const Vec3vf<M>& b)
+    {
+      const Vec3vf<M> ab = b-a;
+      const vfloat<M> len2 = dot(ab,ab);
+      const vfloat<M> t = select(len2 > 0.0f, dot(p-a,ab)/len2, vfloat<M>(zero));
+      return a + min(max(t,vfloat<M>(zero)),vfloat<M>(one))*ab;
+    }
+
+    /*! Updates the point query with the closest of the valid points
+     *  q, returns true if the query radius got reduced. */
+    template<int M>
+      __forceinline bool updatePointQuery(RTCPointQuery& query, const Vec3vf<M>& p, const vbool<M>& valid, const Vec3vf<M>& q,
+                                          const vint<M>& geomID, const vint<M>& primID)
+    {
+      const vfloat<M> dist2 = dot(q-p,q-p);
+      const vbool<M> closer = valid & (dist2 < vfloat<M>(sqr(query.radius)));
+      if (none(closer)) return false;
+      const size_t i = select_min(closer,dist2);
+      query.closest[0] = q.x[i];
+      query.closest[1] = q.y[i];
+      query.closest[2] = q.z[i];
+      query.radius = sqrt(dist2[i]);
+      query.geomID = geomID[i];
+      query.primID = primID[i];
+      return true;
+    }
+  }
+}
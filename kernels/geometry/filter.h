@@ -40,6 +40,7 @@ namespace embree
     __forceinline bool runIntersectionFilter1(const Geometry* const geometry, Ray& ray, IntersectContext* context,
                                               const float& u, const float& v, const float& t, const Vec3fa& Ng, const int geomID, const int primID)
     {
+      context->addFilterCall();
       if (likely(geometry->intersectionFilter1)) // old code for compatibility
       {
         /* temporarily update hit information */
@@ -82,6 +83,7 @@ namespace embree
     __forceinline bool runOcclusionFilter1(const Geometry* const geometry, Ray& ray, IntersectContext* context,
                                            const float& u, const float& v, const float& t, const Vec3fa& Ng, const int geomID, const int primID)
     {
+      context->addFilterCall();
       if (likely(geometry->occlusionFilter1)) // old code for compatibility
       {
         /* temporarily update hit information */
@@ -122,6 +124,7 @@ namespace embree
     __forceinline vbool4 runIntersectionFilter(const vbool4& valid, const Geometry* const geometry, Ray4& ray, IntersectContext* context,
                                                const vfloat4& u, const vfloat4& v, const vfloat4& t, const Vec3vf4& Ng, const int geomID, const int primID)
     {
+      context->addFilterCall();
       RTCFilterFunc4  filter4 = geometry->intersectionFilter4;
       if (likely(filter4)) // old code for compatibility
       {
@@ -171,6 +174,7 @@ namespace embree
     __forceinline vbool4 runOcclusionFilter(const vbool4& valid, const Geometry* const geometry, Ray4& ray, IntersectContext* context,
                                             const vfloat4& u, const vfloat4& v, const vfloat4& t, const Vec3vf4& Ng, const int geomID, const int primID)
     {
+      context->addFilterCall();
       RTCFilterFunc4 filter4 = geometry->occlusionFilter4;
       if (likely(filter4)) // old code for compatibility
       {
@@ -215,6 +219,7 @@ namespace embree
     __forceinline bool runIntersectionFilter(const Geometry* const geometry, Ray4& ray, const size_t k, IntersectContext* context,
                                              const float& u, const float& v, const float& t, const Vec3fa& Ng, const int geomID, const int primID)
     {
+      context->addFilterCall();
       const vbool4 valid(1 << k);
       RTCFilterFunc4  filter4 = geometry->intersectionFilter4;
       if (likely(filter4)) // old code for compatibility
@@ -262,6 +267,7 @@ namespace embree
     __forceinline bool runOcclusionFilter(const Geometry* const geometry, Ray4& ray, const size_t k, IntersectContext* context,
                                           const float& u, const float& v, const float& t, const Vec3fa& Ng, const int geomID, const int primID)
     {
+      context->addFilterCall();
       const vbool4 valid(1 << k);
       RTCFilterFunc4  filter4 = geometry->occlusionFilter4;
       if (likely(filter4)) // old code for compatibility
@@ -306,6 +312,7 @@ namespace embree
     __forceinline vbool8 runIntersectionFilter(const vbool8& valid, const Geometry* const geometry, Ray8& ray, IntersectContext* context,
                                                const vfloat8& u, const vfloat8& v, const vfloat8& t, const Vec3vf8& Ng, const int geomID, const int primID)
     {
+      context->addFilterCall();
       RTCFilterFunc8  filter8 = geometry->intersectionFilter8;    
       if (likely(filter8)) // old code for compatibility
       {
@@ -354,6 +361,7 @@ namespace embree
     __forceinline vbool8 runOcclusionFilter(const vbool8& valid, const Geometry* const geometry, Ray8& ray, IntersectContext* context,
                                             const vfloat8& u, const vfloat8& v, const vfloat8& t, const Vec3vf8& Ng, const int geomID, const int primID)
     {
+      context->addFilterCall();
       RTCFilterFunc8 filter8 = geometry->occlusionFilter8;
       if (likely(filter8)) // old code for compatibility
       {
@@ -397,6 +405,7 @@ namespace embree
     __forceinline bool runIntersectionFilter(const Geometry* const geometry, Ray8& ray, const size_t k, IntersectContext* context,
                                              const float& u, const float& v, const float& t, const Vec3fa& Ng, const int geomID, const int primID)
     {
+      context->addFilterCall();
       const vbool8 valid(1 << k);
       RTCFilterFunc8  filter8 = geometry->intersectionFilter8;
       if (likely(filter8)) // old code for compatibility
@@ -443,6 +452,7 @@ namespace embree
     __forceinline bool runOcclusionFilter(const Geometry* const geometry, Ray8& ray, const size_t k, IntersectContext* context,
                                           const float& u, const float& v, const float& t, const Vec3fa& Ng, const int geomID, const int primID)
     {
+      context->addFilterCall();
       const vbool8 valid(1 << k);
       RTCFilterFunc8 filter8 = geometry->occlusionFilter8;
       if (likely(filter8)) // old code for compatibility
@@ -491,6 +501,7 @@ namespace embree
     __forceinline vbool16 runIntersectionFilter(const vbool16& valid, const Geometry* const geometry, Ray16& ray, IntersectContext* context,
                                                 const vfloat16& u, const vfloat16& v, const vfloat16& t, const Vec3vf16& Ng, const int geomID, const int primID)
     {
+      context->addFilterCall();
       RTCFilterFunc16  filter16 = geometry->intersectionFilter16;
       if (likely(filter16)) // old code for compatibility
       {
@@ -539,6 +550,7 @@ namespace embree
     __forceinline vbool16 runOcclusionFilter(const vbool16& valid, const Geometry* const geometry, Ray16& ray, IntersectContext* context,
                                              const vfloat16& u, const vfloat16& v, const vfloat16& t, const Vec3vf16& Ng, const int geomID, const int primID)
     {
+      context->addFilterCall();
       RTCFilterFunc16 filter16 = geometry->occlusionFilter16;
       if (likely(filter16)) // old code for compatibility
       {
@@ -582,6 +594,7 @@ namespace embree
     __forceinline bool runIntersectionFilter(const Geometry* const geometry, Ray16& ray, const size_t k, IntersectContext* context,
                                              const float& u, const float& v, const float& t, const Vec3fa& Ng, const int geomID, const int primID)
     {
+      context->addFilterCall();
       const vbool16 valid(1 << k);
       RTCFilterFunc16  filter16 = geometry->intersectionFilter16;
       if (likely(filter16)) // old code for compatibility
@@ -628,6 +641,7 @@ namespace embree
     __forceinline bool runOcclusionFilter(const Geometry* const geometry, Ray16& ray, const size_t k, IntersectContext* context,
                                           const float& u, const float& v, const float& t, const Vec3fa& Ng, const int geomID, const int primID)
     {
+      context->addFilterCall();
       const vbool16 valid(1 << k);
       RTCFilterFunc16 filter16 = geometry->occlusionFilter16;
       if (likely(filter16)) // old code for compatibility
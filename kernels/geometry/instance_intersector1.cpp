@@ -28,6 +28,12 @@ namespace embree
       if (num_time_segments == 0) {
         bounds_o = xfmBounds(instance->local2world[itime],instance->object->bounds.bounds());
       }
+      /* linear interpolation between the bounds of the adjacent segments contains the rotating instance */
+      else if (instance->quaternionMotion) {
+        bounds_o = empty;
+        if (itime > 0)                 bounds_o.extend(instance->quaternionBounds(itime-1));
+        if (itime < num_time_segments) bounds_o.extend(instance->quaternionBounds(itime));
+      }
       else {
         const float ftime = float(itime) / float(num_time_segments);
         const BBox3fa obounds = instance->object->bounds.interpolate(ftime);
@@ -39,6 +45,39 @@ namespace embree
       return (RTCBoundsFunc3) InstanceBoundsFunction;
     }
 
+    /*! returns the instance stack context of nested instancing queries, all levels get traversed with an InstanceStackContext */
+    __forceinline const InstanceStackContext* getInstanceStack(const RTCIntersectContext* user_context) {
+      return user_context && !isMultiHit(user_context->flags) && isInstanceStack(user_context->flags) ? (const InstanceStackContext*) user_context : nullptr;
+    }
+
+    /*! The instance stack of a ray gets updated when returning from the
+     *  instanced scene. The instance ID of the next level is terminated
+     *  before entering the instanced scene and only set again by a hit
+     *  of a nested instance that is still the closest hit when the
+     *  traversal of the instanced scene ends. */
+    __forceinline void enterInstanceStack(const InstanceStackContext* stack, size_t k, unsigned& next_instID)
+    {
+      const unsigned level = stack->instLevel;
+      if (level+1 >= RTC_MAX_INSTANCE_LEVEL_COUNT) return;
+      unsigned* instIDs = stack->instIDs + k*RTC_MAX_INSTANCE_LEVEL_COUNT;
+      next_instID = instIDs[level+1];
+      instIDs[level+1] = RTC_INVALID_GEOMETRY_ID;
+    }
+
+    template<typename InstID>
+    __forceinline void leaveInstanceStack(const InstanceStackContext* stack, const InstanceStackContext& nested, size_t k, unsigned next_instID, bool hit, unsigned instID,
+                                          float t, unsigned geomID, unsigned primID, InstID& ray_instID)
+    {
+      const unsigned level = stack->instLevel;
+      unsigned* instIDs = stack->instIDs + k*RTC_MAX_INSTANCE_LEVEL_COUNT;
+      if (hit) {
+        if (nested.resolveHit(k,t,geomID,primID)) ray_instID = instID;
+        if (level < RTC_MAX_INSTANCE_LEVEL_COUNT) instIDs[level] = instID;
+        stack->setHit(k,t,geomID,primID);
+      }
+      else if (level+1 < RTC_MAX_INSTANCE_LEVEL_COUNT) instIDs[level+1] = next_instID;
+    }
+
     __forceinline void FastInstanceIntersectorN::intersect1(const Instance* instance, const RTCIntersectContext* user_context, Ray& ray, size_t item)
     {
       const AffineSpace3fa world2local = 
@@ -51,10 +90,24 @@ namespace embree
       ray.dir = xfmVector(world2local,ray_dir);
       ray.geomID = RTC_INVALID_GEOMETRY_ID;
       ray.instID = instance->geomID;
+
+      /* nested instances get traversed with the next instancing level */
+      const InstanceStackContext* stack = getInstanceStack(user_context);
+      InstanceStackContext nested_context;
+      unsigned next_instID = RTC_INVALID_GEOMETRY_ID;
+      if (unlikely(stack)) {
+        enterInstanceStack(stack,0,next_instID);
+        nested_context = InstanceStackContext(*stack);
+        nested_context.instLevel++;
+        user_context = &nested_context.context;
+      }
+
       IntersectContext context(instance->object,user_context);
       instance->object->intersectors.intersect((RTCRay&)ray,&context);
       ray.org = ray_org;
       ray.dir = ray_dir;
+      if (unlikely(stack))
+        leaveInstanceStack(stack,nested_context,0,next_instID,ray.geomID != RTC_INVALID_GEOMETRY_ID,instance->geomID,ray.tfar,ray.geomID,ray.primID,ray.instID);
       if (ray.geomID == RTC_INVALID_GEOMETRY_ID) {
         ray.geomID = ray_geomID;
         ray.instID = ray_instID;
@@ -110,11 +163,30 @@ namespace embree
       ray.dir = xfmVector(world2local,ray_dir);
       ray.geomID = RTC_INVALID_GEOMETRY_ID;
       ray.instID = instance->geomID;
+
+      /* nested instances get traversed with the next instancing level */
+      const InstanceStackContext* stack = getInstanceStack(user_context);
+      InstanceStackContext nested_context;
+      unsigned next_instID[N];
+      const size_t valid_mask = movemask(valid);
+      if (unlikely(stack)) {
+        for (size_t k=0; k<N; k++)
+          if ((valid_mask >> k) & 1) enterInstanceStack(stack,k,next_instID[k]);
+        nested_context = InstanceStackContext(*stack);
+        nested_context.instLevel++;
+        user_context = &nested_context.context;
+      }
+
       IntersectContext context(instance->object,user_context); 
       intersectObject((vint<N>*)validi,instance->object,&context,ray);
       ray.org = ray_org;
       ray.dir = ray_dir;
       vbool<N> nohit = ray.geomID == vint<N>(RTC_INVALID_GEOMETRY_ID);
+      if (unlikely(stack)) {
+        const size_t hit_mask = movemask(!nohit);
+        for (size_t k=0; k<N; k++)
+          if ((valid_mask >> k) & 1) leaveInstanceStack(stack,nested_context,k,next_instID[k],(hit_mask >> k) & 1,instance->geomID,ray.tfar[k],ray.geomID[k],ray.primID[k],ray.instID[k]);
+      }
       ray.geomID = select(nohit,ray_geomID,ray.geomID);
       ray.instID = select(nohit,ray_instID,ray.instID);
     }
@@ -29,6 +29,52 @@ namespace embree
         __forceinline void operator() (vfloat<M>& u, vfloat<M>& v) const {}
       };
 
+    /*! Inserts a hit into the sorted multi-hit buffer of the ray with
+     *  the specified index and returns the new far distance of the ray,
+     *  which is the distance of the last hit once the buffer is full. A
+     *  primitive referenced from multiple leaves reports the same hit
+     *  again, which is stored only once, while hits of one primitive at
+     *  different distances (e.g. a curve crossed twice) are all kept. */
+    __forceinline float multiHitInsert(const RTCMultiHitContext* multiHit, size_t index, float tfar, const RTCHitRecord& hit)
+    {
+      const unsigned maxHits = multiHit->maxHits;
+      RTCHitRecord* hits = multiHit->hits + index*maxHits;
+      unsigned n = multiHit->numHits[index];
+
+      /* ignore a hit of the same primitive at the same distance */
+      for (unsigned j=0; j<n; j++)
+      {
+        if (hits[j].geomID != hit.geomID || hits[j].primID != hit.primID || hits[j].instID != hit.instID) continue;
+        if (abs(hits[j].tfar-hit.tfar) <= 16.0f*float(ulp)*max(abs(hits[j].tfar),abs(hit.tfar))) return tfar;
+      }
+
+      /* drop the last hit if the buffer is full */
+      if (n == maxHits) {
+        if (n == 0 || hit.tfar >= hits[n-1].tfar) return tfar;
+        n--;
+      }
+
+      /* insertion sort by distance */
+      unsigned j = n;
+      for (; j>0 && hits[j-1].tfar > hit.tfar; j--) hits[j] = hits[j-1];
+      hits[j] = hit;
+      multiHit->numHits[index] = ++n;
+      return n == maxHits ? hits[n-1].tfar : tfar;
+    }
+
+    __forceinline void multiHitInsert(IntersectContext* context, Ray& ray, float u, float v, float t, const Vec3fa& Ng, unsigned geomID, unsigned primID)
+    {
+      const RTCHitRecord hit = { t, u, v, { Ng.x, Ng.y, Ng.z }, geomID, primID, ray.instID };
+      ray.tfar = multiHitInsert(context->multiHit,0,ray.tfar,hit);
+    }
+
+    template<int K>
+      __forceinline void multiHitInsert(IntersectContext* context, RayK<K>& ray, size_t k, float u, float v, float t, const Vec3fa& Ng, unsigned geomID, unsigned primID)
+    {
+      const RTCHitRecord hit = { t, u, v, { Ng.x, Ng.y, Ng.z }, geomID, primID, (unsigned) ray.instID[k] };
+      ray.tfar[k] = multiHitInsert(context->multiHit,k,ray.tfar[k],hit);
+    }
+
     template<bool filter>
       struct Intersect1Epilog1
       {
@@ -54,6 +100,12 @@ namespace embree
 #endif
           hit.finalize();
           int instID = context->geomID_to_instID ? context->geomID_to_instID[0] : geomID;
+
+          /* multi-hit queries collect the hit instead of updating the ray */
+          if (unlikely(context->multiHit)) {
+            multiHitInsert(context,ray,hit.u,hit.v,hit.t,hit.Ng,instID,primID);
+            return true;
+          }
           
           /* intersection filter test */
 #if defined(EMBREE_INTERSECTION_FILTER)
@@ -133,6 +185,12 @@ namespace embree
             return false;
 #endif
           hit.finalize();
+
+          /* multi-hit queries collect the hit instead of updating the ray */
+          if (unlikely(context->multiHit)) {
+            multiHitInsert(context,ray,k,hit.u,hit.v,hit.t,hit.Ng,geomID,primID);
+            return true;
+          }
           
           /* intersection filter test */
 #if defined(EMBREE_INTERSECTION_FILTER)
@@ -211,6 +269,26 @@ namespace embree
           vbool<Mx> valid = valid_i;          
           if (Mx > M) valid &= (1<<M)-1;
           hit.finalize();          
+
+          /* multi-hit queries collect all hits instead of the closest one */
+          if (unlikely(context->multiHit))
+          {
+            bool foundhit = false;
+            for (size_t mask=movemask(valid); mask!=0; )
+            {
+              const size_t i = __bscf(mask);
+              const int geomID = geomIDs[i];
+#if defined(EMBREE_RAY_MASK)
+              if ((scene->get(geomID)->mask & ray.mask) == 0) continue;
+#endif
+              const int instID = context->geomID_to_instID ? context->geomID_to_instID[0] : geomID;
+              const Vec2f uv = hit.uv(i);
+              multiHitInsert(context,ray,uv.x,uv.y,hit.vt[i],hit.Ng(i),instID,primIDs[i]);
+              foundhit = true;
+            }
+            return foundhit;
+          }
+
           size_t i = select_min(valid,hit.vt);
           int geomID = geomIDs[i];
           int instID = context->geomID_to_instID ? context->geomID_to_instID[0] : geomID;
@@ -290,6 +368,26 @@ namespace embree
           vbool<Mx> valid = valid_i;
           if (Mx > M) valid &= (1<<M)-1;
           hit.finalize();          
+
+          /* multi-hit queries collect all hits instead of the closest one */
+          if (unlikely(context->multiHit))
+          {
+            bool foundhit = false;
+            for (size_t mask=movemask(valid); mask!=0; )
+            {
+              const size_t i = __bscf(mask);
+              const int geomID = geomIDs[i];
+#if defined(EMBREE_RAY_MASK)
+              if ((scene->get(geomID)->mask & ray.mask) == 0) continue;
+#endif
+              const int instID = context->geomID_to_instID ? context->geomID_to_instID[0] : geomID;
+              const Vec2f uv = hit.uv(i);
+              multiHitInsert(context,ray,uv.x,uv.y,hit.vt[i],hit.Ng(i),instID,primIDs[i]);
+              foundhit = true;
+            }
+            return foundhit;
+          }
+
           size_t i = select_min(valid,hit.vt);
           int geomID = geomIDs[i];
           int instID = context->geomID_to_instID ? context->geomID_to_instID[0] : geomID;
@@ -434,6 +532,17 @@ namespace embree
           
           vbool<M> valid = valid_i;
           hit.finalize();
+
+          /* multi-hit queries collect all hits instead of the closest one */
+          if (unlikely(context->multiHit))
+          {
+            for (size_t mask=movemask(valid); mask!=0; ) {
+              const size_t i = __bscf(mask);
+              const Vec2f uv = hit.uv(i);
+              multiHitInsert(context,ray,uv.x,uv.y,hit.vt[i],hit.Ng(i),geomID,primID);
+            }
+            return true;
+          }
           
           size_t i = select_min(valid,hit.vt);
           
@@ -549,6 +658,16 @@ namespace embree
           if (unlikely(none(valid))) return false;
 #endif
           
+          /* multi-hit queries collect the hits instead of updating the rays */
+          if (unlikely(context->multiHit))
+          {
+            for (size_t mask=movemask(valid); mask!=0; ) {
+              const size_t k = __bscf(mask);
+              multiHitInsert(context,ray,k,u[k],v[k],t[k],Vec3fa(Ng.x[k],Ng.y[k],Ng.z[k]),geomID,primID);
+            }
+            return valid;
+          }
+          
           /* occlusion filter test */
 #if defined(EMBREE_INTERSECTION_FILTER)
           if (filter) {
@@ -654,6 +773,16 @@ namespace embree
           if (unlikely(none(valid))) return false;
 #endif
           
+          /* multi-hit queries collect the hits instead of updating the rays */
+          if (unlikely(context->multiHit))
+          {
+            for (size_t mask=movemask(valid); mask!=0; ) {
+              const size_t k = __bscf(mask);
+              multiHitInsert(context,ray,k,u[k],v[k],t[k],Vec3fa(Ng.x[k],Ng.y[k],Ng.z[k]),geomID,primID);
+            }
+            return valid;
+          }
+          
           /* intersection filter test */
 #if defined(EMBREE_INTERSECTION_FILTER)
           if (filter) {
@@ -747,6 +876,25 @@ namespace embree
           vbool<Mx> valid = valid_i;
           hit.finalize();
           if (Mx > M) valid &= (1<<M)-1;
+
+          /* multi-hit queries collect all hits instead of the closest one */
+          if (unlikely(context->multiHit))
+          {
+            bool foundhit = false;
+            for (size_t mask=movemask(valid); mask!=0; )
+            {
+              const size_t i = __bscf(mask);
+              const int geomID = geomIDs[i];
+#if defined(EMBREE_RAY_MASK)
+              if ((scene->get(geomID)->mask & ray.mask[k]) == 0) continue;
+#endif
+              const Vec2f uv = hit.uv(i);
+              multiHitInsert(context,ray,k,uv.x,uv.y,hit.vt[i],hit.Ng(i),geomID,primIDs[i]);
+              foundhit = true;
+            }
+            return foundhit;
+          }
+
           size_t i = select_min(valid,hit.vt);
           assert(i<M);
           int geomID = geomIDs[i];
@@ -902,6 +1050,18 @@ namespace embree
           /* finalize hit calculation */
           vbool<M> valid = valid_i;
           hit.finalize();
+
+          /* multi-hit queries collect all hits instead of the closest one */
+          if (unlikely(context->multiHit))
+          {
+            for (size_t mask=movemask(valid); mask!=0; ) {
+              const size_t i = __bscf(mask);
+              const Vec2f uv = hit.uv(i);
+              multiHitInsert(context,ray,k,uv.x,uv.y,hit.vt[i],hit.Ng(i),geomID,primID);
+            }
+            return true;
+          }
+
           size_t i = select_min(valid,hit.vt);
           
           /* intersection filter test */
@@ -0,0 +1,169 @@
+// ======================================================================== //
+// Copyright 2009-2017 Intel Corporation                                    //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ======================================================================== //
+
+#pragma once
+
+#include "../common/ray.h"
+#include "filter.h"
+
+namespace embree
+{
+  namespace isa
+  {
+    /*! Intersects W rays with W points in parallel. Points with a
+     *  zero normal are spheres, all other points are discs oriented
+     *  along their normal. */
+    template<int W>
+      __forceinline vbool<W> intersectPoints(const vbool<W>& valid_i,
+                                             const Vec3vf<W>& ray_org, const Vec3vf<W>& ray_dir,
+                                             const vfloat<W>& ray_tnear, const vfloat<W>& ray_tfar,
+                                             const Vec3vf<W>& center, const vfloat<W>& radius, const Vec3vf<W>& normal,
+                                             vfloat<W>& t_o, Vec3vf<W>& Ng_o)
+    {
+      const Vec3vf<W> oc = ray_org-center;
+      const vfloat<W> r2 = radius*radius;
+      const vbool<W> disc = (normal.x != vfloat<W>(zero)) | (normal.y != vfloat<W>(zero)) | (normal.z != vfloat<W>(zero));
+
+      /* sphere intersection, the far hit is taken when the ray starts inside the sphere */
+      const vfloat<W> A = dot(ray_dir,ray_dir);
+      const vfloat<W> B = dot(oc,ray_dir);
+      const vfloat<W> C = dot(oc,oc)-r2;
+      const vfloat<W> D = B*B-A*C;
+      const vfloat<W> rcpA = rcp(A);
+      const vfloat<W> Q = sqrt(max(D,vfloat<W>(zero)));
+      const vfloat<W> t0 = (-B-Q)*rcpA;
+      const vfloat<W> t1 = (-B+Q)*rcpA;
+      const vfloat<W> tsphere = select(ray_tnear < t0,t0,t1);
+
+      /* oriented disc intersection */
+      const vfloat<W> dn = dot(ray_dir,normal);
+      const vfloat<W> tdisc = -dot(oc,normal)*rcp(dn);
+      const Vec3vf<W> pdisc = madd(tdisc,ray_dir,oc);
+      const vbool<W> valid_disc = (dn != vfloat<W>(zero)) & (dot(pdisc,pdisc) <= r2);
+
+      const vfloat<W> t = select(disc,tdisc,tsphere);
+      vbool<W> valid = valid_i & select(disc,valid_disc,D >= vfloat<W>(zero));
+      valid &= (ray_tnear < t) & (t <= ray_tfar);
+
+      t_o = t;
+      const Vec3vf<W> Nsphere = madd(t,ray_dir,oc);
+      Ng_o = Vec3vf<W>(select(disc,normal.x,Nsphere.x),select(disc,normal.y,Nsphere.y),select(disc,normal.z,Nsphere.z));
+      return valid;
+    }
+
+    template<int M>
+      struct PointIntersectorHitM
+      {
+        __forceinline PointIntersectorHitM() {}
+
+        __forceinline PointIntersectorHitM(const vfloat<M>& u, const vfloat<M>& v, const vfloat<M>& t, const Vec3vf<M>& Ng)
+          : vu(u), vv(v), vt(t), vNg(Ng) {}
+
+        __forceinline void finalize() {}
+
+        __forceinline Vec2f uv (const size_t i) const { return Vec2f(vu[i],vv[i]); }
+        __forceinline float t  (const size_t i) const { return vt[i]; }
+        __forceinline Vec3fa Ng(const size_t i) const { return Vec3fa(vNg.x[i],vNg.y[i],vNg.z[i]); }
+
+      public:
+        vfloat<M> vu;
+        vfloat<M> vv;
+        vfloat<M> vt;
+        Vec3vf<M> vNg;
+      };
+
+    template<int K>
+      struct PointIntersectorHitK
+      {
+        __forceinline PointIntersectorHitK(const vfloat<K>& t, const Vec3vf<K>& Ng)
+          : t(t), Ng(Ng) {}
+
+        __forceinline std::tuple<vfloat<K>,vfloat<K>,vfloat<K>,Vec3vf<K>> operator() () const {
+          return std::make_tuple(vfloat<K>(zero),vfloat<K>(zero),t,Ng);
+        }
+
+      private:
+        const vfloat<K> t;
+        const Vec3vf<K> Ng;
+      };
+
+    template<int M>
+      struct PointIntersector1
+      {
+        struct Precalculations
+        {
+          __forceinline Precalculations() {}
+          __forceinline Precalculations(const Ray& ray, const void* ptr) {}
+        };
+
+        template<typename Epilog>
+        static __forceinline bool intersect(const vbool<M>& valid_i,
+                                            Ray& ray, const Precalculations& pre,
+                                            const Vec4vf<M>& v, const Vec3vf<M>& n,
+                                            const Epilog& epilog)
+        {
+          vfloat<M> t; Vec3vf<M> Ng;
+          const vbool<M> valid = intersectPoints<M>(valid_i,Vec3vf<M>(ray.org),Vec3vf<M>(ray.dir),vfloat<M>(ray.tnear),vfloat<M>(ray.tfar),
+                                                    v.xyz(),v.w,n,t,Ng);
+          if (unlikely(none(valid))) return false;
+
+          PointIntersectorHitM<M> hit(zero,zero,t,Ng);
+          return epilog(valid,hit);
+        }
+      };
+
+    template<int M, int K>
+      struct PointIntersectorK
+      {
+        struct Precalculations
+        {
+          __forceinline Precalculations (const vbool<K>& valid, const RayK<K>& ray) {}
+        };
+
+        /*! intersects the k'th ray of the packet with M points */
+        template<typename Epilog>
+        static __forceinline bool intersect(const vbool<M>& valid_i,
+                                            RayK<K>& ray, size_t k, const Precalculations& pre,
+                                            const Vec4vf<M>& v, const Vec3vf<M>& n,
+                                            const Epilog& epilog)
+        {
+          const Vec3vf<M> ray_org(ray.org.x[k],ray.org.y[k],ray.org.z[k]);
+          const Vec3vf<M> ray_dir(ray.dir.x[k],ray.dir.y[k],ray.dir.z[k]);
+          vfloat<M> t; Vec3vf<M> Ng;
+          const vbool<M> valid = intersectPoints<M>(valid_i,ray_org,ray_dir,vfloat<M>(ray.tnear[k]),vfloat<M>(ray.tfar[k]),
+                                                    v.xyz(),v.w,n,t,Ng);
+          if (unlikely(none(valid))) return false;
+
+          PointIntersectorHitM<M> hit(zero,zero,t,Ng);
+          return epilog(valid,hit);
+        }
+
+        /*! intersects all rays of the packet with a single point */
+        template<typename Epilog>
+        static __forceinline vbool<K> intersectK(const vbool<K>& valid_i,
+                                                 RayK<K>& ray,
+                                                 const Vec4vf<K>& v, const Vec3vf<K>& n,
+                                                 const Epilog& epilog)
+        {
+          vfloat<K> t; Vec3vf<K> Ng;
+          const vbool<K> valid = intersectPoints<K>(valid_i,ray.org,ray.dir,ray.tnear,ray.tfar,v.xyz(),v.w,n,t,Ng);
+          if (unlikely(none(valid))) return false;
+
+          return epilog(valid,PointIntersectorHitK<K>(t,Ng));
+        }
+      };
+  }
+}
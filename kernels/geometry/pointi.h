@@ -0,0 +1,253 @@
+// ======================================================================== //
+// Copyright 2009-2017 Intel Corporation                                    //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ======================================================================== //
+
+#pragma once
+
+#include "primitive.h"
+
+namespace embree
+{
+  /* Stores M points by reference. The IDs are kept in plain arrays
+   * as leaves are only 16 byte aligned, which is not sufficient for
+   * aligned 8-wide loads. */
+  template<int M>
+  struct PointMi
+  {
+    /* Virtual interface to query information about the point type */
+    struct Type : public PrimitiveType
+    {
+      Type();
+      size_t size(const char* This) const;
+    };
+    static Type type;
+
+  public:
+
+    /* primitive supports multiple time segments */
+    static const bool singleTimeSegment = false;
+
+    /* Returns maximal number of stored points */
+    static __forceinline size_t max_size() { return M; }
+
+    /* Returns required number of primitive blocks for N points */
+    static __forceinline size_t blocks(size_t N) { return (N+max_size()-1)/max_size(); }
+
+  public:
+
+    /* Default constructor */
+    __forceinline PointMi() {  }
+
+    /* Returns a mask that tells which points are valid */
+    __forceinline vbool<M> valid() const { return vint<M>::loadu(primIDs) != vint<M>(-1); }
+
+    /* Returns if the specified point is valid */
+    __forceinline bool valid(const size_t i) const { assert(i<M); return primIDs[i] != -1; }
+
+    /* Returns the number of stored points */
+    __forceinline size_t size() const {
+      size_t n = 0; while (n<M && valid(n)) n++; return n;
+    }
+
+    /* Returns the geometry IDs */
+    __forceinline vint<M> geomID() const { return vint<M>::loadu(geomIDs); }
+    __forceinline int geomID(const size_t i) const { assert(i<M); return geomIDs[i]; }
+
+    /* Returns the primitive IDs */
+    __forceinline vint<M> primID() const { return vint<M>::loadu(primIDs); }
+    __forceinline int primID(const size_t i) const { assert(i<M); return primIDs[i]; }
+
+    /* Returns the index of the vertex to gather, unused lanes gather the first point of the block */
+    __forceinline int vertexID(const size_t i) const { assert(i<M); return valid(i) ? primIDs[i] : primIDs[0]; }
+
+    /* gather the points, the normal is zero for spheres */
+    __forceinline void gather(Vec4vf<M>& p,
+                              Vec3vf<M>& n,
+                              const Scene* scene) const;
+
+    __forceinline void gather(Vec4vf<M>& p,
+                              Vec3vf<M>& n,
+                              const Points* const* geom,
+                              const int* itime) const;
+
+    __forceinline void gather(Vec4vf<M>& p,
+                              Vec3vf<M>& n,
+                              const Scene* scene,
+                              float time) const;
+
+    /* Calculate the bounds of the points */
+    __forceinline const BBox3fa bounds(const Scene* scene, size_t itime = 0) const
+    {
+      BBox3fa bounds = empty;
+      for (size_t i=0; i<M && valid(i); i++)
+      {
+        const Points* geom = scene->get<Points>(geomID(i));
+        bounds.extend(geom->bounds(primID(i),itime));
+      }
+      return bounds;
+    }
+
+    /* Calculate the linear bounds of the primitive */
+    __forceinline LBBox3fa linearBounds(const Scene* scene, size_t itime) {
+      return LBBox3fa(bounds(scene,itime+0), bounds(scene,itime+1));
+    }
+
+    __forceinline LBBox3fa linearBounds(const Scene *const scene, const BBox1f time_range)
+    {
+      LBBox3fa allBounds = empty;
+      for (size_t i=0; i<M && valid(i); i++)
+      {
+        const Points* geom = scene->get<Points>(geomID(i));
+        allBounds.extend(geom->linearBounds(primID(i), time_range));
+      }
+      return allBounds;
+    }
+
+    /* Fill point block from point list */
+    template<typename PrimRefT>
+    __forceinline void fill(const PrimRefT* prims, size_t& begin, size_t end, Scene* scene)
+    {
+      const PrimRefT* prim = &prims[begin];
+
+      for (size_t i=0; i<M; i++)
+      {
+        if (begin<end) {
+          geomIDs[i] = prim->geomID();
+          primIDs[i] = prim->primID();
+          begin++;
+        } else {
+          assert(i);
+          if (i>0) {
+            geomIDs[i] = geomIDs[i-1];
+            primIDs[i] = -1;
+          }
+        }
+        if (begin<end) prim = &prims[begin];
+      }
+    }
+
+    __forceinline LBBox3fa fillMB(const PrimRef* prims, size_t& begin, size_t end, Scene* scene, size_t itime)
+    {
+      fill(prims,begin,end,scene);
+      return linearBounds(scene,itime);
+    }
+
+    __forceinline LBBox3fa fillMB(const PrimRefMB* prims, size_t& begin, size_t end, Scene* scene, const BBox1f time_range)
+    {
+      fill(prims,begin,end,scene);
+      return linearBounds(scene,time_range);
+    }
+
+    /* Updates the primitive */
+    __forceinline BBox3fa update(Points* geom)
+    {
+      BBox3fa bounds = empty;
+      for (size_t i=0; i<M && valid(i); i++)
+        bounds.extend(geom->bounds(primID(i)));
+      return bounds;
+    }
+
+    /*! output operator */
+    friend __forceinline std::ostream& operator<<(std::ostream& cout, const PointMi& point) {
+      return cout << "Point" << M << "i {" << point.geomID() << ", " << point.primID() << "}";
+    }
+
+  private:
+    int geomIDs[M]; // geometry ID
+    int primIDs[M]; // primitive ID, which is also the index of the vertex
+  };
+
+  template<int M>
+    __forceinline void PointMi<M>::gather(Vec4vf<M>& p,
+                                          Vec3vf<M>& n,
+                                          const Scene* scene) const
+  {
+    const Points* geom[M];
+    int itime[M];
+    for (size_t i=0; i<M; i++) {
+      geom[i] = scene->get<Points>(geomID(i));
+      itime[i] = 0;
+    }
+    gather(p,n,geom,itime);
+  }
+
+  template<>
+    __forceinline void PointMi<4>::gather(Vec4vf4& p,
+                                          Vec3vf4& n,
+                                          const Points* const* geom,
+                                          const int* itime) const
+  {
+    const vfloat4 a0 = vfloat4::loadu(geom[0]->vertexPtr(vertexID(0),itime[0]));
+    const vfloat4 a1 = vfloat4::loadu(geom[1]->vertexPtr(vertexID(1),itime[1]));
+    const vfloat4 a2 = vfloat4::loadu(geom[2]->vertexPtr(vertexID(2),itime[2]));
+    const vfloat4 a3 = vfloat4::loadu(geom[3]->vertexPtr(vertexID(3),itime[3]));
+    transpose(a0,a1,a2,a3,p.x,p.y,p.z,p.w);
+
+    /* points of sphere geometries get a zero normal */
+    vfloat4 b[4];
+    for (size_t i=0; i<4; i++)
+      b[i] = geom[i]->isOrientedDisc() ? vfloat4::loadu(geom[i]->normalPtr(vertexID(i),itime[i])) : vfloat4(zero);
+    transpose(b[0],b[1],b[2],b[3],n.x,n.y,n.z);
+  }
+
+#if defined(__AVX__)
+  template<>
+    __forceinline void PointMi<8>::gather(Vec4vf8& p,
+                                          Vec3vf8& n,
+                                          const Points* const* geom,
+                                          const int* itime) const
+  {
+    vfloat4 a[8], b[8];
+    for (size_t i=0; i<8; i++) {
+      a[i] = vfloat4::loadu(geom[i]->vertexPtr(vertexID(i),itime[i]));
+      b[i] = geom[i]->isOrientedDisc() ? vfloat4::loadu(geom[i]->normalPtr(vertexID(i),itime[i])) : vfloat4(zero);
+    }
+    transpose(a[0],a[1],a[2],a[3],a[4],a[5],a[6],a[7],p.x,p.y,p.z,p.w);
+    transpose(b[0],b[1],b[2],b[3],b[4],b[5],b[6],b[7],n.x,n.y,n.z);
+  }
+#endif
+
+  template<int M>
+    __forceinline void PointMi<M>::gather(Vec4vf<M>& p,
+                                          Vec3vf<M>& n,
+                                          const Scene* scene,
+                                          float time) const
+  {
+    const Points* geom[M];
+    __aligned(64) float fnumTimeSegments[M];
+    for (size_t i=0; i<M; i++) {
+      geom[i] = scene->get<Points>(geomID(i));
+      fnumTimeSegments[i] = geom[i]->fnumTimeSegments;
+    }
+
+    vfloat<M> ftime;
+    const vint<M> itime = getTimeSegment(vfloat<M>(time), vfloat<M>::load(fnumTimeSegments), ftime);
+    __aligned(64) int itime0[M], itime1[M];
+    vint<M>::store(itime0,itime);
+    vint<M>::store(itime1,itime+1);
+
+    Vec4vf<M> p0, p1; Vec3vf<M> n0, n1;
+    gather(p0,n0,geom,itime0);
+    gather(p1,n1,geom,itime1);
+    p = lerp(p0,p1,ftime);
+    n = lerp(n0,n1,ftime);
+  }
+
+  template<int M>
+  typename PointMi<M>::Type PointMi<M>::type;
+
+  typedef PointMi<4> Point4i;
+  typedef PointMi<8> Point8i;
+}
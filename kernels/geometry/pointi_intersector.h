@@ -0,0 +1,168 @@
+// ======================================================================== //
+// Copyright 2009-2017 Intel Corporation                                    //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ======================================================================== //
+
+#pragma once
+
+#include "pointi.h"
+#include "point_intersector.h"
+#include "intersector_epilog.h"
+
+namespace embree
+{
+  namespace isa
+  {
+    template<int M, bool filter>
+    struct PointMiIntersector1
+    {
+      typedef PointMi<M> Primitive;
+      typedef typename PointIntersector1<M>::Precalculations Precalculations;
+
+      static __forceinline void intersect(Precalculations& pre, Ray& ray, IntersectContext* context, const Primitive& point)
+      {
+        STAT3(normal.trav_prims,1,1,1);
+        Vec4vf<M> v; Vec3vf<M> n; point.gather(v,n,context->scene);
+        const vint<M> geomIDs = point.geomID(), primIDs = point.primID();
+        PointIntersector1<M>::intersect(point.valid(),ray,pre,v,n,Intersect1EpilogM<M,M,filter>(ray,context,geomIDs,primIDs));
+      }
+
+      static __forceinline bool occluded(Precalculations& pre, Ray& ray, IntersectContext* context, const Primitive& point)
+      {
+        STAT3(shadow.trav_prims,1,1,1);
+        Vec4vf<M> v; Vec3vf<M> n; point.gather(v,n,context->scene);
+        const vint<M> geomIDs = point.geomID(), primIDs = point.primID();
+        return PointIntersector1<M>::intersect(point.valid(),ray,pre,v,n,Occluded1EpilogM<M,M,filter>(ray,context,geomIDs,primIDs));
+      }
+    };
+
+    template<int M, bool filter>
+    struct PointMiMBIntersector1
+    {
+      typedef PointMi<M> Primitive;
+      typedef typename PointIntersector1<M>::Precalculations Precalculations;
+
+      static __forceinline void intersect(Precalculations& pre, Ray& ray, IntersectContext* context, const Primitive& point)
+      {
+        STAT3(normal.trav_prims,1,1,1);
+        Vec4vf<M> v; Vec3vf<M> n; point.gather(v,n,context->scene,ray.time);
+        const vint<M> geomIDs = point.geomID(), primIDs = point.primID();
+        PointIntersector1<M>::intersect(point.valid(),ray,pre,v,n,Intersect1EpilogM<M,M,filter>(ray,context,geomIDs,primIDs));
+      }
+
+      static __forceinline bool occluded(Precalculations& pre, Ray& ray, IntersectContext* context, const Primitive& point)
+      {
+        STAT3(shadow.trav_prims,1,1,1);
+        Vec4vf<M> v; Vec3vf<M> n; point.gather(v,n,context->scene,ray.time);
+        const vint<M> geomIDs = point.geomID(), primIDs = point.primID();
+        return PointIntersector1<M>::intersect(point.valid(),ray,pre,v,n,Occluded1EpilogM<M,M,filter>(ray,context,geomIDs,primIDs));
+      }
+    };
+
+    /*! Packets and streams test all rays against one point at a
+     *  time, single rays of a packet test all points of the block. */
+    template<int M, int K, bool filter>
+    struct PointMiIntersectorK
+    {
+      typedef PointMi<M> Primitive;
+      typedef typename PointIntersectorK<M,K>::Precalculations Precalculations;
+
+      static __forceinline void intersect(const vbool<K>& valid_i, Precalculations& pre, RayK<K>& ray, IntersectContext* context, const Primitive& point)
+      {
+        Vec4vf<M> v; Vec3vf<M> n; point.gather(v,n,context->scene);
+        const vint<M> geomIDs = point.geomID(), primIDs = point.primID();
+        for (size_t i=0; i<M && point.valid(i); i++)
+        {
+          STAT3(normal.trav_prims,1,popcnt(valid_i),K);
+          const Vec4vf<K> vi(v.x[i],v.y[i],v.z[i],v.w[i]);
+          const Vec3vf<K> ni(n.x[i],n.y[i],n.z[i]);
+          PointIntersectorK<M,K>::intersectK(valid_i,ray,vi,ni,IntersectKEpilogM<M,K,filter>(ray,context,geomIDs,primIDs,i));
+        }
+      }
+
+      static __forceinline vbool<K> occluded(const vbool<K>& valid_i, Precalculations& pre, RayK<K>& ray, IntersectContext* context, const Primitive& point)
+      {
+        Vec4vf<M> v; Vec3vf<M> n; point.gather(v,n,context->scene);
+        const vint<M> geomIDs = point.geomID(), primIDs = point.primID();
+        vbool<K> valid0 = valid_i;
+        for (size_t i=0; i<M && point.valid(i); i++)
+        {
+          STAT3(shadow.trav_prims,1,popcnt(valid0),K);
+          const Vec4vf<K> vi(v.x[i],v.y[i],v.z[i],v.w[i]);
+          const Vec3vf<K> ni(n.x[i],n.y[i],n.z[i]);
+          PointIntersectorK<M,K>::intersectK(valid0,ray,vi,ni,OccludedKEpilogM<M,K,filter>(valid0,ray,context,geomIDs,primIDs,i));
+          if (none(valid0)) break;
+        }
+        return valid_i & !valid0;
+      }
+
+      static __forceinline void intersect(Precalculations& pre, RayK<K>& ray, size_t k, IntersectContext* context, const Primitive& point)
+      {
+        STAT3(normal.trav_prims,1,1,1);
+        Vec4vf<M> v; Vec3vf<M> n; point.gather(v,n,context->scene);
+        const vint<M> geomIDs = point.geomID(), primIDs = point.primID();
+        PointIntersectorK<M,K>::intersect(point.valid(),ray,k,pre,v,n,Intersect1KEpilogM<M,M,K,filter>(ray,k,context,geomIDs,primIDs));
+      }
+
+      static __forceinline bool occluded(Precalculations& pre, RayK<K>& ray, size_t k, IntersectContext* context, const Primitive& point)
+      {
+        STAT3(shadow.trav_prims,1,1,1);
+        Vec4vf<M> v; Vec3vf<M> n; point.gather(v,n,context->scene);
+        const vint<M> geomIDs = point.geomID(), primIDs = point.primID();
+        return PointIntersectorK<M,K>::intersect(point.valid(),ray,k,pre,v,n,Occluded1KEpilogM<M,M,K,filter>(ray,k,context,geomIDs,primIDs));
+      }
+    };
+
+    template<int M, int K, bool filter>
+    struct PointMiMBIntersectorK
+    {
+      typedef PointMi<M> Primitive;
+      typedef typename PointIntersectorK<M,K>::Precalculations Precalculations;
+
+      static __forceinline void intersect(Precalculations& pre, RayK<K>& ray, size_t k, IntersectContext* context, const Primitive& point)
+      {
+        STAT3(normal.trav_prims,1,1,1);
+        Vec4vf<M> v; Vec3vf<M> n; point.gather(v,n,context->scene,ray.time[k]);
+        const vint<M> geomIDs = point.geomID(), primIDs = point.primID();
+        PointIntersectorK<M,K>::intersect(point.valid(),ray,k,pre,v,n,Intersect1KEpilogM<M,M,K,filter>(ray,k,context,geomIDs,primIDs));
+      }
+
+      static __forceinline void intersect(const vbool<K>& valid_i, Precalculations& pre, RayK<K>& ray, IntersectContext* context, const Primitive& point)
+      {
+        size_t mask = movemask(valid_i);
+        while (mask) intersect(pre,ray,__bscf(mask),context,point);
+      }
+
+      static __forceinline bool occluded(Precalculations& pre, RayK<K>& ray, size_t k, IntersectContext* context, const Primitive& point)
+      {
+        STAT3(shadow.trav_prims,1,1,1);
+        Vec4vf<M> v; Vec3vf<M> n; point.gather(v,n,context->scene,ray.time[k]);
+        const vint<M> geomIDs = point.geomID(), primIDs = point.primID();
+        return PointIntersectorK<M,K>::intersect(point.valid(),ray,k,pre,v,n,Occluded1KEpilogM<M,M,K,filter>(ray,k,context,geomIDs,primIDs));
+      }
+
+      static __forceinline vbool<K> occluded(const vbool<K>& valid_i, Precalculations& pre, RayK<K>& ray, IntersectContext* context, const Primitive& point)
+      {
+        vbool<K> valid_o = false;
+        size_t mask = movemask(valid_i);
+        while (mask) {
+          size_t k = __bscf(mask);
+          if (occluded(pre,ray,k,context,point))
+            set(valid_o, k);
+        }
+        return valid_o;
+      }
+    };
+  }
+}
@@ -18,6 +18,7 @@
 #include "bezier1v.h"
 #include "bezier1i.h"
 #include "linei.h"
+#include "pointi.h"
 #include "triangle.h"
 #include "trianglev.h"
 #include "trianglev_mb.h"
@@ -62,6 +63,28 @@ namespace embree
     return ((Line4i*)This)->size();
   }
 
+  /********************** Point4i **************************/
+
+  template<>
+  Point4i::Type::Type ()
+    : PrimitiveType("point4i",sizeof(Point4i),4) {}
+
+  template<>
+  size_t Point4i::Type::size(const char* This) const {
+    return ((Point4i*)This)->size();
+  }
+
+  /********************** Point8i **************************/
+
+  template<>
+  Point8i::Type::Type ()
+    : PrimitiveType("point8i",sizeof(Point8i),8) {}
+
+  template<>
+  size_t Point8i::Type::size(const char* This) const {
+    return ((Point8i*)This)->size();
+  }
+
   /********************** Triangle4 **************************/
 
   template<>
@@ -73,6 +96,31 @@ namespace embree
     return ((Triangle4*)This)->size();
   }
 
+  /********************** Triangle8 **************************/
+
+  /* the 8- and 16-wide leaves are counted without SIMD, as this file
+   * is compiled for the lowest ISA */
+
+  template<>
+  Triangle8::Type::Type ()
+    : PrimitiveType("triangle8",sizeof(Triangle8),8) {}
+
+  template<>
+  size_t Triangle8::Type::size(const char* This) const {
+    size_t n = 0; while (n<8 && ((Triangle8*)This)->valid(n)) n++; return n;
+  }
+
+  /********************** Triangle16 **************************/
+
+  template<>
+  Triangle16::Type::Type ()
+    : PrimitiveType("triangle16",sizeof(Triangle16),16) {}
+
+  template<>
+  size_t Triangle16::Type::size(const char* This) const {
+    size_t n = 0; while (n<16 && ((Triangle16*)This)->valid(n)) n++; return n;
+  }
+
   /********************** Triangle4v **************************/
 
   template<>
@@ -84,6 +132,17 @@ namespace embree
     return ((Triangle4v*)This)->size();
   }
 
+  /********************** Triangle8v **************************/
+
+  template<>
+  Triangle8v::Type::Type ()
+  : PrimitiveType("triangle8v",sizeof(Triangle8v),8) {}
+
+  template<>
+  size_t Triangle8v::Type::size(const char* This) const {
+    size_t n = 0; while (n<8 && ((Triangle8v*)This)->valid(n)) n++; return n;
+  }
+
   /********************** Triangle4i **************************/
 
   template<>
@@ -117,6 +176,17 @@ namespace embree
     return ((Quad4v*)This)->size();
   }
 
+  /********************** Quad8v **************************/
+
+  template<>
+  Quad8v::Type::Type ()
+    : PrimitiveType("quad8v",sizeof(Quad8v),8) {}
+
+  template<>
+  size_t Quad8v::Type::size(const char* This) const {
+    size_t n = 0; while (n<8 && ((Quad8v*)This)->valid(n)) n++; return n;
+  }
+
   /********************** Quad4i **************************/
 
   template<>
@@ -244,6 +244,63 @@ namespace embree
       }
     };
 
+    /*! Intersects 8 quads with 1 ray using AVX512, the first triangles
+     *  of the quads go to the lower and the second triangles to the
+     *  upper 8 lanes */
+    template<bool filter>
+      struct QuadMIntersector1MoellerTrumbore<8,filter>
+    {
+      __forceinline QuadMIntersector1MoellerTrumbore() {}
+
+      __forceinline QuadMIntersector1MoellerTrumbore(const Ray& ray, const void* ptr) {}
+
+      template<typename Epilog>
+        __forceinline bool intersect(Ray& ray, const Vec3vf8& v0, const Vec3vf8& v1, const Vec3vf8& v2, const Vec3vf8& v3, const Epilog& epilog) const
+      {
+        const Vec3vf16 vtx0(vfloat16(v0.x,v2.x),vfloat16(v0.y,v2.y),vfloat16(v0.z,v2.z));
+#if !defined(EMBREE_BACKFACE_CULLING)
+        const Vec3vf16 vtx1(vfloat16(v1.x),vfloat16(v1.y),vfloat16(v1.z));
+        const Vec3vf16 vtx2(vfloat16(v3.x),vfloat16(v3.y),vfloat16(v3.z));
+#else
+        const Vec3vf16 vtx1(vfloat16(v1.x,v3.x),vfloat16(v1.y,v3.y),vfloat16(v1.z,v3.z));
+        const Vec3vf16 vtx2(vfloat16(v3.x,v1.x),vfloat16(v3.y,v1.y),vfloat16(v3.z,v1.z));
+#endif
+        const vbool16 flags(0xff00);
+
+        MoellerTrumboreHitM<16> hit;
+        MoellerTrumboreIntersector1<16> intersector(ray,nullptr);
+        if (unlikely(intersector.intersect(ray,vtx0,vtx1,vtx2,hit))) 
+        {
+          vfloat16 U = hit.U, V = hit.V, absDen = hit.absDen;
+#if !defined(EMBREE_BACKFACE_CULLING)
+          hit.U = select(flags,absDen-V,U);
+          hit.V = select(flags,absDen-U,V);
+          hit.vNg *= select(flags,vfloat16(-1.0f),vfloat16(1.0f)); // FIXME: use XOR
+#else
+          hit.U = select(flags,absDen-U,U);
+          hit.V = select(flags,absDen-V,V);
+#endif
+          if (likely(epilog(hit.valid,hit)))
+            return true;
+        }
+        return false;
+      }
+      
+      __forceinline bool intersect(Ray& ray, IntersectContext* context,
+                                   const Vec3vf8& v0, const Vec3vf8& v1, const Vec3vf8& v2, const Vec3vf8& v3, 
+                                   const vint8& geomID, const vint8& primID) const
+      {
+        return intersect(ray,v0,v1,v2,v3,Intersect1EpilogM<16,16,filter>(ray,context,vint16(geomID,geomID),vint16(primID,primID)));
+      }
+      
+      __forceinline bool occluded(Ray& ray, IntersectContext* context,
+                                  const Vec3vf8& v0, const Vec3vf8& v1, const Vec3vf8& v2, const Vec3vf8& v3, 
+                                  const vint8& geomID, const vint8& primID) const
+      {
+        return intersect(ray,v0,v1,v2,v3,Occluded1EpilogM<16,16,filter>(ray,context,vint16(geomID,geomID),vint16(primID,primID)));
+      }
+    };
+
 #elif defined (__AVX__)
 
     /*! Intersects 4 quads with 1 ray using AVX */
@@ -471,7 +528,11 @@ namespace embree
       {
         Intersect1KEpilogM<M,M,K,filter> epilog(ray,k,context,geomID,primID);
         MoellerTrumboreIntersector1KTriangleM::intersect1(ray,k,v0,v1,v3,vbool<M>(false),epilog);
+#if defined(__AVX__) && !defined(EMBREE_BACKFACE_CULLING)
+        MoellerTrumboreIntersector1KTriangleM::intersect1(ray,k,v2,v1,v3,vbool<M>(true ),epilog); // QuadHitM expects the second triangle in AVX layout
+#else
         MoellerTrumboreIntersector1KTriangleM::intersect1(ray,k,v2,v3,v1,vbool<M>(true ),epilog);
+#endif
       }
       
       __forceinline bool occluded1(RayK<K>& ray, size_t k, IntersectContext* context,
@@ -480,7 +541,11 @@ namespace embree
       {
         Occluded1KEpilogM<M,M,K,filter> epilog(ray,k,context,geomID,primID);
         if (MoellerTrumboreIntersector1KTriangleM::intersect1(ray,k,v0,v1,v3,vbool<M>(false),epilog)) return true;
+#if defined(__AVX__) && !defined(EMBREE_BACKFACE_CULLING)
+        if (MoellerTrumboreIntersector1KTriangleM::intersect1(ray,k,v2,v1,v3,vbool<M>(true ),epilog)) return true;
+#else
         if (MoellerTrumboreIntersector1KTriangleM::intersect1(ray,k,v2,v3,v1,vbool<M>(true ),epilog)) return true;
+#endif
         return false;
       }
     };
@@ -532,6 +597,44 @@ namespace embree
       }
     };
 
+    /*! Intersects 8 quads with 1 ray using AVX512 */
+    template<int K, bool filter>
+      struct QuadMIntersectorKMoellerTrumbore<8,K,filter> : public QuadMIntersectorKMoellerTrumboreBase<8,K,filter>
+    {
+      __forceinline QuadMIntersectorKMoellerTrumbore(const vbool<K>& valid, const RayK<K>& ray)
+        : QuadMIntersectorKMoellerTrumboreBase<8,K,filter>(valid,ray) {}
+
+      template<typename Epilog>
+        __forceinline bool intersect1(RayK<K>& ray, size_t k,
+                                      const Vec3vf8& v0, const Vec3vf8& v1, const Vec3vf8& v2, const Vec3vf8& v3, const Epilog& epilog) const
+      {
+        const Vec3vf16 vtx0(vfloat16(v0.x,v2.x),vfloat16(v0.y,v2.y),vfloat16(v0.z,v2.z));
+#if !defined(EMBREE_BACKFACE_CULLING)
+        const Vec3vf16 vtx1(vfloat16(v1.x),vfloat16(v1.y),vfloat16(v1.z));
+        const Vec3vf16 vtx2(vfloat16(v3.x),vfloat16(v3.y),vfloat16(v3.z));
+#else
+        const Vec3vf16 vtx1(vfloat16(v1.x,v3.x),vfloat16(v1.y,v3.y),vfloat16(v1.z,v3.z));
+        const Vec3vf16 vtx2(vfloat16(v3.x,v1.x),vfloat16(v3.y,v1.y),vfloat16(v3.z,v1.z));
+#endif
+        const vbool16 flags(0xff00);
+        return MoellerTrumboreIntersector1KTriangleM::intersect1(ray,k,vtx0,vtx1,vtx2,flags,epilog);
+      }
+      
+      __forceinline bool intersect1(RayK<K>& ray, size_t k, IntersectContext* context,
+                                    const Vec3vf8& v0, const Vec3vf8& v1, const Vec3vf8& v2, const Vec3vf8& v3, 
+                                    const vint8& geomID, const vint8& primID) const
+      {
+        return intersect1(ray,k,v0,v1,v2,v3,Intersect1KEpilogM<16,16,K,filter>(ray,k,context,vint16(geomID,geomID),vint16(primID,primID)));
+      }
+      
+      __forceinline bool occluded1(RayK<K>& ray, size_t k, IntersectContext* context,
+                                   const Vec3vf8& v0, const Vec3vf8& v1, const Vec3vf8& v2, const Vec3vf8& v3, 
+                                   const vint8& geomID, const vint8& primID) const
+      {
+        return intersect1(ray,k,v0,v1,v2,v3,Occluded1KEpilogM<16,16,K,filter>(ray,k,context,vint16(geomID,geomID),vint16(primID,primID)));
+      }
+    };
+
 #elif defined (__AVX__)
 
     /*! Intersects 4 quads with 1 ray using AVX */
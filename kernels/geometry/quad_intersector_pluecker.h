@@ -201,7 +201,11 @@ namespace embree
       {
         Intersect1EpilogM<M,M,filter> epilog(ray,context,geomID,primID);
         PlueckerIntersectorTriangle1::intersect(ray,v0,v1,v3,vbool<M>(false),epilog);
+#if defined(__AVX__) && !defined(EMBREE_BACKFACE_CULLING)
+        PlueckerIntersectorTriangle1::intersect(ray,v2,v1,v3,vbool<M>(true),epilog); // QuadHitPlueckerM expects the second triangle in AVX layout
+#else
         PlueckerIntersectorTriangle1::intersect(ray,v2,v3,v1,vbool<M>(true),epilog);
+#endif
       }
       
       __forceinline bool occluded(Ray& ray, IntersectContext* context,
@@ -210,7 +214,11 @@ namespace embree
       {
         Occluded1EpilogM<M,M,filter> epilog(ray,context,geomID,primID);
         if (PlueckerIntersectorTriangle1::intersect(ray,v0,v1,v3,vbool<M>(false),epilog)) return true;
+#if defined(__AVX__) && !defined(EMBREE_BACKFACE_CULLING)
+        if (PlueckerIntersectorTriangle1::intersect(ray,v2,v1,v3,vbool<M>(true ),epilog)) return true;
+#else
         if (PlueckerIntersectorTriangle1::intersect(ray,v2,v3,v1,vbool<M>(true ),epilog)) return true;
+#endif
         return false;
       }
     };
@@ -261,6 +269,46 @@ namespace embree
       }
     };
 
+    /*! Intersects 8 quads with 1 ray using AVX512, the first triangles
+     *  of the quads go to the lower and the second triangles to the
+     *  upper 8 lanes */
+    template<bool filter>
+      struct QuadMIntersector1Pluecker<8,filter>
+    {
+      __forceinline QuadMIntersector1Pluecker() {}
+
+      __forceinline QuadMIntersector1Pluecker(const Ray& ray, const void* ptr) {}
+
+      template<typename Epilog>
+        __forceinline bool intersect(Ray& ray, const Vec3vf8& v0, const Vec3vf8& v1, const Vec3vf8& v2, const Vec3vf8& v3, const Epilog& epilog) const
+      {
+        const Vec3vf16 vtx0(vfloat16(v0.x,v2.x),vfloat16(v0.y,v2.y),vfloat16(v0.z,v2.z));
+#if !defined(EMBREE_BACKFACE_CULLING)
+        const Vec3vf16 vtx1(vfloat16(v1.x),vfloat16(v1.y),vfloat16(v1.z));
+        const Vec3vf16 vtx2(vfloat16(v3.x),vfloat16(v3.y),vfloat16(v3.z));
+#else
+        const Vec3vf16 vtx1(vfloat16(v1.x,v3.x),vfloat16(v1.y,v3.y),vfloat16(v1.z,v3.z));
+        const Vec3vf16 vtx2(vfloat16(v3.x,v1.x),vfloat16(v3.y,v1.y),vfloat16(v3.z,v1.z));
+#endif
+        const vbool16 flags(0xff00);
+        return PlueckerIntersectorTriangle1::intersect(ray,vtx0,vtx1,vtx2,flags,epilog);
+      }
+      
+      __forceinline bool intersect(Ray& ray, IntersectContext* context,
+                                   const Vec3vf8& v0, const Vec3vf8& v1, const Vec3vf8& v2, const Vec3vf8& v3, 
+                                   const vint8& geomID, const vint8& primID) const
+      {
+        return intersect(ray,v0,v1,v2,v3,Intersect1EpilogM<16,16,filter>(ray,context,vint16(geomID,geomID),vint16(primID,primID)));
+      }
+      
+      __forceinline bool occluded(Ray& ray, IntersectContext* context,
+                                  const Vec3vf8& v0, const Vec3vf8& v1, const Vec3vf8& v2, const Vec3vf8& v3, 
+                                  const vint8& geomID, const vint8& primID) const
+      {
+        return intersect(ray,v0,v1,v2,v3,Occluded1EpilogM<16,16,filter>(ray,context,vint16(geomID,geomID),vint16(primID,primID)));
+      }
+    };
+
 #elif defined (__AVX__)
 
     /*! Intersects 4 quads with 1 ray using AVX */
@@ -458,7 +506,11 @@ namespace embree
       {
         Intersect1KEpilogM<M,M,K,filter> epilog(ray,k,context,geomID,primID);
         PlueckerIntersector1KTriangleM::intersect1(ray,k,v0,v1,v3,vbool<M>(false),epilog);
+#if defined(__AVX__) && !defined(EMBREE_BACKFACE_CULLING)
+        PlueckerIntersector1KTriangleM::intersect1(ray,k,v2,v1,v3,vbool<M>(true ),epilog); // QuadHitPlueckerM expects the second triangle in AVX layout
+#else
         PlueckerIntersector1KTriangleM::intersect1(ray,k,v2,v3,v1,vbool<M>(true ),epilog);
+#endif
       }
       
       __forceinline bool occluded1(RayK<K>& ray, size_t k, IntersectContext* context,
@@ -467,7 +519,11 @@ namespace embree
       {
         Occluded1KEpilogM<M,M,K,filter> epilog(ray,k,context,geomID,primID);
         if (PlueckerIntersector1KTriangleM::intersect1(ray,k,v0,v1,v3,vbool<M>(false),epilog)) return true;
+#if defined(__AVX__) && !defined(EMBREE_BACKFACE_CULLING)
+        if (PlueckerIntersector1KTriangleM::intersect1(ray,k,v2,v1,v3,vbool<M>(true ),epilog)) return true;
+#else
         if (PlueckerIntersector1KTriangleM::intersect1(ray,k,v2,v3,v1,vbool<M>(true ),epilog)) return true;
+#endif
         return false;
       }
     };
@@ -518,6 +574,43 @@ namespace embree
       }
     };
 
+    /*! Intersects 8 quads with 1 ray using AVX512 */
+    template<int K, bool filter>
+      struct QuadMIntersectorKPluecker<8,K,filter> : public QuadMIntersectorKPlueckerBase<8,K,filter>
+    {
+      __forceinline QuadMIntersectorKPluecker(const vbool<K>& valid, const RayK<K>& ray)
+        : QuadMIntersectorKPlueckerBase<8,K,filter>(valid,ray) {}
+
+      template<typename Epilog>
+        __forceinline bool intersect1(RayK<K>& ray, size_t k, const Vec3vf8& v0, const Vec3vf8& v1, const Vec3vf8& v2, const Vec3vf8& v3, const Epilog& epilog) const
+      {
+        const Vec3vf16 vtx0(vfloat16(v0.x,v2.x),vfloat16(v0.y,v2.y),vfloat16(v0.z,v2.z));
+#if !defined(EMBREE_BACKFACE_CULLING)
+        const Vec3vf16 vtx1(vfloat16(v1.x),vfloat16(v1.y),vfloat16(v1.z));
+        const Vec3vf16 vtx2(vfloat16(v3.x),vfloat16(v3.y),vfloat16(v3.z));
+#else
+        const Vec3vf16 vtx1(vfloat16(v1.x,v3.x),vfloat16(v1.y,v3.y),vfloat16(v1.z,v3.z));
+        const Vec3vf16 vtx2(vfloat16(v3.x,v1.x),vfloat16(v3.y,v1.y),vfloat16(v3.z,v1.z));
+#endif
+        const vbool16 flags(0xff00);
+        return PlueckerIntersector1KTriangleM::intersect1(ray,k,vtx0,vtx1,vtx2,flags,epilog);
+      }
+      
+      __forceinline bool intersect1(RayK<K>& ray, size_t k, IntersectContext* context, 
+                                    const Vec3vf8& v0, const Vec3vf8& v1, const Vec3vf8& v2, const Vec3vf8& v3, 
+                                    const vint8& geomID, const vint8& primID) const
+      {
+        return intersect1(ray,k,v0,v1,v2,v3,Intersect1KEpilogM<16,16,K,filter>(ray,k,context,vint16(geomID,geomID),vint16(primID,primID)));
+      }
+      
+      __forceinline bool occluded1(RayK<K>& ray, size_t k, IntersectContext* context,
+                                   const Vec3vf8& v0, const Vec3vf8& v1, const Vec3vf8& v2, const Vec3vf8& v3, 
+                                   const vint8& geomID, const vint8& primID) const
+      {
+        return intersect1(ray,k,v0,v1,v2,v3,Occluded1KEpilogM<16,16,K,filter>(ray,k,context,vint16(geomID,geomID),vint16(primID,primID)));
+      }
+    };
+
 #elif defined (__AVX__)
 
     /*! Intersects 4 quads with 1 ray using AVX */
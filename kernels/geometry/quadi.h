@@ -77,8 +77,12 @@ namespace embree
     __forceinline const vint<M>& primID() const { return primIDs; }
     __forceinline int primID(const size_t i) const { assert(i<M); return primIDs[i]; }
 
-    __forceinline Vec3f& getVertex(const vint<M>& v, const size_t index, const Scene *const scene) const
+    __forceinline Vec3f getVertex(const vint<M>& v, const size_t index, const Scene *const scene) const
     {
+      if (unlikely(scene->compressedVertices)) {
+        const Vec3fa p = scene->get<QuadMesh>(geomID(index))->leafVertex(v[index],0);
+        return Vec3f(p.x,p.y,p.z);
+      }
       const int* vertices = scene->vertices[geomID(index)];
       return (Vec3f&) vertices[v[index]];
     }
@@ -87,10 +91,8 @@ namespace embree
     __forceinline Vec3<T> getVertex(const vint<M> &v, const size_t index, const Scene *const scene, const size_t itime, const T& ftime) const
     {
       const QuadMesh* mesh = scene->get<QuadMesh>(geomID(index));
-      const int* vertices0 = (const int*) mesh->vertexPtr(0,itime+0);
-      const int* vertices1 = (const int*) mesh->vertexPtr(0,itime+1);
-      const Vec3fa v0 = Vec3fa::loadu(vertices0+v[index]);
-      const Vec3fa v1 = Vec3fa::loadu(vertices1+v[index]);
+      const Vec3fa v0 = mesh->leafVertex(v[index],itime+0);
+      const Vec3fa v1 = mesh->leafVertex(v[index],itime+1);
       const Vec3<T> p0(v0.x,v0.y,v0.z);
       const Vec3<T> p1(v1.x,v1.y,v1.z);
       return lerp(p0,p1,ftime);
@@ -104,10 +106,8 @@ namespace embree
 
       for (size_t mask=movemask(valid), i=__bsf(mask); mask; mask=__btc(mask,i), i=__bsf(mask))
       {
-        const int* vertices0 = (const int*) mesh->vertexPtr(0,itime[i]+0);
-        const int* vertices1 = (const int*) mesh->vertexPtr(0,itime[i]+1);
-        const Vec3fa v0 = Vec3fa::loadu(vertices0+v[index]);
-        const Vec3fa v1 = Vec3fa::loadu(vertices1+v[index]);
+        const Vec3fa v0 = mesh->leafVertex(v[index],itime[i]+0);
+        const Vec3fa v1 = mesh->leafVertex(v[index],itime[i]+1);
         p0.x[i] = v0.x; p0.y[i] = v0.y; p0.z[i] = v0.z;
         p1.x[i] = v1.x; p1.y[i] = v1.y; p1.z[i] = v1.z;
       }
@@ -121,6 +121,28 @@ namespace embree
                               Vec3vf<M>& p3,
                               const Scene *const scene) const;
 
+    /* Gather the quads from compressed vertex buffers */
+    __forceinline void gatherCompressed(Vec3vf<M>& p0,
+                                        Vec3vf<M>& p1,
+                                        Vec3vf<M>& p2,
+                                        Vec3vf<M>& p3,
+                                        const Scene *const scene,
+                                        const vint<M>& itime) const
+    {
+      for (size_t i=0; i<M; i++)
+      {
+        const QuadMesh* mesh = scene->get<QuadMesh>(geomID(i));
+        const Vec3fa a = mesh->leafVertex(v0[i],itime[i]);
+        const Vec3fa b = mesh->leafVertex(v1[i],itime[i]);
+        const Vec3fa c = mesh->leafVertex(v2[i],itime[i]);
+        const Vec3fa d = mesh->leafVertex(v3[i],itime[i]);
+        p0.x[i] = a.x; p0.y[i] = a.y; p0.z[i] = a.z;
+        p1.x[i] = b.x; p1.y[i] = b.y; p1.z[i] = b.z;
+        p2.x[i] = c.x; p2.y[i] = c.y; p2.z[i] = c.z;
+        p3.x[i] = d.x; p3.y[i] = d.y; p3.z[i] = d.z;
+      }
+    }
+
 #if defined(__AVX512F__)
     __forceinline void gather(Vec3vf16& p0,
                               Vec3vf16& p1,
@@ -184,11 +206,11 @@ namespace embree
       BBox3fa bounds = empty;
       for (size_t i=0; i<M && valid(i); i++)
       {
-        const int* vertices = (const int*) scene->get<QuadMesh>(geomID(i))->vertexPtr(0,itime);
-        bounds.extend(Vec3fa::loadu(vertices+v0[i]));
-        bounds.extend(Vec3fa::loadu(vertices+v1[i]));
-        bounds.extend(Vec3fa::loadu(vertices+v2[i]));
-        bounds.extend(Vec3fa::loadu(vertices+v3[i]));
+        const QuadMesh* mesh = scene->get<QuadMesh>(geomID(i));
+        bounds.extend(mesh->leafVertex(v0[i],itime));
+        bounds.extend(mesh->leafVertex(v1[i],itime));
+        bounds.extend(mesh->leafVertex(v2[i],itime));
+        bounds.extend(mesh->leafVertex(v3[i],itime));
       }
       return bounds;
     }
@@ -236,7 +258,7 @@ namespace embree
         if (begin<end) {
           geomID[i] = prim->geomID();
           primID[i] = prim->primID();
-          unsigned int_stride = mesh->vertices0.getStride()/4;
+          const unsigned int_stride = mesh->leafVertexScale();
           v0[i] = q.v[0] * int_stride;
           v1[i] = q.v[1] * int_stride;
           v2[i] = q.v[2] * int_stride;
@@ -313,6 +335,11 @@ namespace embree
   {
     prefetchL1(((char*)this)+0*64);
     prefetchL1(((char*)this)+1*64);
+    if (unlikely(scene->compressedVertices)) {
+      gatherCompressed(p0,p1,p2,p3,scene,vint4(zero));
+      return;
+    }
+
     const int* vertices0 = scene->vertices[geomID(0)];
     const int* vertices1 = scene->vertices[geomID(1)];
     const int* vertices2 = scene->vertices[geomID(2)];
@@ -347,6 +374,15 @@ namespace embree
                                        Vec3vf16& p3,
                                        const Scene *const scene) const // FIXME: why do we have this special path here and not for triangles?
   {
+    if (unlikely(scene->compressedVertices)) {
+      Vec3vf4 q0,q1,q2,q3; gatherCompressed(q0,q1,q2,q3,scene,vint4(zero));
+      p0 = Vec3vf16(vfloat16(q0.x),vfloat16(q0.y),vfloat16(q0.z));
+      p1 = Vec3vf16(vfloat16(q1.x),vfloat16(q1.y),vfloat16(q1.z));
+      p2 = Vec3vf16(vfloat16(q2.x),vfloat16(q2.y),vfloat16(q2.z));
+      p3 = Vec3vf16(vfloat16(q3.x),vfloat16(q3.y),vfloat16(q3.z));
+      return;
+    }
+
     const vint16 perm(0,4,8,12,1,5,9,13,2,6,10,14,3,7,11,15);
     const int* vertices0 = scene->vertices[geomID(0)];
     const int* vertices1 = scene->vertices[geomID(1)];
@@ -449,8 +485,14 @@ namespace embree
     vfloat4 ftime;
     const vint4 itime = getTimeSegment(vfloat4(time), numTimeSegments, ftime);
 
-    Vec3vf4 a0,a1,a2,a3; gather(a0,a1,a2,a3,mesh0,mesh1,mesh2,mesh3,itime);
-    Vec3vf4 b0,b1,b2,b3; gather(b0,b1,b2,b3,mesh0,mesh1,mesh2,mesh3,itime+1);
+    Vec3vf4 a0,a1,a2,a3, b0,b1,b2,b3;
+    if (unlikely(scene->compressedVertices)) {
+      gatherCompressed(a0,a1,a2,a3,scene,itime);
+      gatherCompressed(b0,b1,b2,b3,scene,itime+1);
+    } else {
+      gather(a0,a1,a2,a3,mesh0,mesh1,mesh2,mesh3,itime);
+      gather(b0,b1,b2,b3,mesh0,mesh1,mesh2,mesh3,itime+1);
+    }
     p0 = lerp(a0,b0,ftime);
     p1 = lerp(a1,b1,ftime);
     p2 = lerp(a2,b2,ftime);
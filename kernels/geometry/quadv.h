@@ -173,4 +173,5 @@ namespace embree
   typename QuadMv<M>::Type QuadMv<M>::type;
 
   typedef QuadMv<4> Quad4v;
+  typedef QuadMv<8> Quad8v;
 }
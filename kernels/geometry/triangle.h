@@ -170,4 +170,6 @@ namespace embree
   typename TriangleM<M>::Type TriangleM<M>::type;
 
   typedef TriangleM<4> Triangle4;
+  typedef TriangleM<8> Triangle8;
+  typedef TriangleM<16> Triangle16;
 }
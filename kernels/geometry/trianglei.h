@@ -75,8 +75,12 @@ namespace embree
     __forceinline int primID(const size_t i) const { assert(i<M); return primIDs[i]; }
 
     /* loads a single vertex */
-    __forceinline Vec3f& getVertex(const vint<M>& v, const size_t index, const Scene *const scene) const
+    __forceinline Vec3f getVertex(const vint<M>& v, const size_t index, const Scene *const scene) const
     {
+      if (unlikely(scene->compressedVertices)) {
+        const Vec3fa p = scene->get<TriangleMesh>(geomID(index))->leafVertex(v[index],0);
+        return Vec3f(p.x,p.y,p.z);
+      }
       const int* vertices = scene->vertices[geomID(index)];
       return (Vec3f&) vertices[v[index]];
     }
@@ -85,10 +89,8 @@ namespace embree
     __forceinline Vec3<T> getVertex(const vint<M>& v, const size_t index, const Scene *const scene, const size_t itime, const T& ftime) const
     {
       const TriangleMesh* mesh = scene->get<TriangleMesh>(geomID(index));
-      const int* vertices0 = (const int*) mesh->vertexPtr(0,itime+0);
-      const int* vertices1 = (const int*) mesh->vertexPtr(0,itime+1);
-      const Vec3fa v0 = Vec3fa::loadu(vertices0+v[index]);
-      const Vec3fa v1 = Vec3fa::loadu(vertices1+v[index]);
+      const Vec3fa v0 = mesh->leafVertex(v[index],itime+0);
+      const Vec3fa v1 = mesh->leafVertex(v[index],itime+1);
       const Vec3<T> p0(v0.x,v0.y,v0.z);
       const Vec3<T> p1(v1.x,v1.y,v1.z);
       return lerp(p0,p1,ftime);
@@ -102,10 +104,8 @@ namespace embree
 
       for (size_t mask=movemask(valid), i=__bsf(mask); mask; mask=__btc(mask,i), i=__bsf(mask))
       {
-        const int* vertices0 = (const int*) mesh->vertexPtr(0,itime[i]+0);
-        const int* vertices1 = (const int*) mesh->vertexPtr(0,itime[i]+1);
-        const Vec3fa v0 = Vec3fa::loadu(vertices0+v[index]);
-        const Vec3fa v1 = Vec3fa::loadu(vertices1+v[index]);
+        const Vec3fa v0 = mesh->leafVertex(v[index],itime[i]+0);
+        const Vec3fa v1 = mesh->leafVertex(v[index],itime[i]+1);
         p0.x[i] = v0.x; p0.y[i] = v0.y; p0.z[i] = v0.z;
         p1.x[i] = v1.x; p1.y[i] = v1.y; p1.z[i] = v1.z;
       }
@@ -115,6 +115,21 @@ namespace embree
     /* Gather the triangles */
     __forceinline void gather(Vec3vf<M>& p0, Vec3vf<M>& p1, Vec3vf<M>& p2, const Scene* const scene) const;
 
+    /* Gather the triangles from compressed vertex buffers */
+    __forceinline void gatherCompressed(Vec3vf<M>& p0, Vec3vf<M>& p1, Vec3vf<M>& p2, const Scene* const scene, const vint<M>& itime) const
+    {
+      for (size_t i=0; i<M; i++)
+      {
+        const TriangleMesh* mesh = scene->get<TriangleMesh>(geomID(i));
+        const Vec3fa a = mesh->leafVertex(v0[i],itime[i]);
+        const Vec3fa b = mesh->leafVertex(v1[i],itime[i]);
+        const Vec3fa c = mesh->leafVertex(v2[i],itime[i]);
+        p0.x[i] = a.x; p0.y[i] = a.y; p0.z[i] = a.z;
+        p1.x[i] = b.x; p1.y[i] = b.y; p1.z[i] = b.z;
+        p2.x[i] = c.x; p2.y[i] = c.y; p2.z[i] = c.z;
+      }
+    }
+
     template<int K>
     __forceinline void gather(const vbool<K>& valid,
                               Vec3vf<K>& p0,
@@ -163,10 +178,10 @@ namespace embree
       BBox3fa bounds = empty;
       for (size_t i=0; i<M && valid(i); i++)
       {
-        const int* vertices = (const int*) scene->get<TriangleMesh>(geomID(i))->vertexPtr(0,itime);
-        bounds.extend(Vec3fa::loadu(vertices+v0[i]));
-        bounds.extend(Vec3fa::loadu(vertices+v1[i]));
-        bounds.extend(Vec3fa::loadu(vertices+v2[i]));
+        const TriangleMesh* mesh = scene->get<TriangleMesh>(geomID(i));
+        bounds.extend(mesh->leafVertex(v0[i],itime));
+        bounds.extend(mesh->leafVertex(v1[i],itime));
+        bounds.extend(mesh->leafVertex(v2[i],itime));
       }
       return bounds;
     }
@@ -223,7 +238,7 @@ namespace embree
         if (begin<end) {
           geomID[i] = prim->geomID();
           primID[i] = prim->primID();
-          unsigned int_stride = mesh->vertices0.getStride()/4;
+          const unsigned int_stride = mesh->leafVertexScale();
           v0[i] = tri.v[0] * int_stride;
           v1[i] = tri.v[1] * int_stride;
           v2[i] = tri.v[2] * int_stride;
@@ -288,6 +303,11 @@ namespace embree
                                            Vec3vf4& p2,
                                            const Scene* const scene) const
   {
+    if (unlikely(scene->compressedVertices)) {
+      gatherCompressed(p0,p1,p2,scene,vint4(zero));
+      return;
+    }
+
     const int* vertices0 = scene->vertices[geomID(0)];
     const int* vertices1 = scene->vertices[geomID(1)];
     const int* vertices2 = scene->vertices[geomID(2)];
@@ -356,8 +376,14 @@ namespace embree
     vfloat4 ftime;
     const vint4 itime = getTimeSegment(vfloat4(time), numTimeSegments, ftime);
 
-    Vec3vf4 a0,a1,a2; gather(a0,a1,a2,mesh0,mesh1,mesh2,mesh3,itime);
-    Vec3vf4 b0,b1,b2; gather(b0,b1,b2,mesh0,mesh1,mesh2,mesh3,itime+1);
+    Vec3vf4 a0,a1,a2, b0,b1,b2;
+    if (unlikely(scene->compressedVertices)) {
+      gatherCompressed(a0,a1,a2,scene,itime);
+      gatherCompressed(b0,b1,b2,scene,itime+1);
+    } else {
+      gather(a0,a1,a2,mesh0,mesh1,mesh2,mesh3,itime);
+      gather(b0,b1,b2,mesh0,mesh1,mesh2,mesh3,itime+1);
+    }
     p0 = lerp(a0,b0,ftime);
     p1 = lerp(a1,b1,ftime);
     p2 = lerp(a2,b2,ftime);
@@ -165,4 +165,5 @@ namespace embree
   typename TriangleMv<M>::Type TriangleMv<M>::type;
 
   typedef TriangleMv<4> Triangle4v;
+  typedef TriangleMv<8> Triangle8v;
 }
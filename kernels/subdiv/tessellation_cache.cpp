@@ -36,6 +36,27 @@ namespace embree
     //SharedLazyTessellationCache::sharedLazyTessellationCache.addCurrentIndex(SharedLazyTessellationCache::NUM_CACHE_SEGMENTS);
     SharedLazyTessellationCache::sharedLazyTessellationCache.reset();
   }
+
+  TessellationCacheStats getTessellationCacheStats() {
+    return SharedLazyTessellationCache::sharedLazyTessellationCache.getStats();
+  }
+
+  size_t adaptTessellationCacheSize(const TessellationCacheStats& stats, size_t size, size_t minSize, size_t maxSize)
+  {
+    /* keep the size if the cache was not used since the last adaptation */
+    const size_t accesses = stats.hits+stats.misses;
+    if (accesses == 0) return size;
+
+    /* grow if every segment got recycled and many lookups missed */
+    if (stats.flushes >= SharedLazyTessellationCache::NUM_CACHE_SEGMENTS && 8*stats.misses > accesses)
+      return max(min(2*size,maxSize),minSize);
+
+    /* shrink if the allocated data fits a quarter of the cache without any flushes */
+    if (stats.flushes == 0 && 4*stats.bytes < size)
+      return min(max(size/2,minSize),maxSize);
+
+    return min(max(size,minSize),maxSize);
+  }
   
   SharedLazyTessellationCache::SharedLazyTessellationCache()
   {
@@ -46,6 +67,7 @@ namespace embree
     localTime              = NUM_CACHE_SEGMENTS;
     next_block             = 0;
     numRenderThreads       = 0;
+    numFlushes             = 0;
 #if FORCE_SIMPLE_FLUSH == 1
     switch_block_threshold = maxBlocks;
 #else
@@ -124,6 +146,7 @@ namespace embree
 #endif
         
         CACHE_STATS(SharedTessellationCacheStats::cache_flushes++);
+        numFlushes++;
         
         /* release all blocked threads */
         
@@ -224,6 +247,20 @@ namespace embree
   }
 
 
+  TessellationCacheStats SharedLazyTessellationCache::getStats()
+  {
+    TessellationCacheStats stats;
+    linkedlist_mtx.lock();
+    for (ThreadWorkState *t=current_t_state;t!=nullptr;t=t->next) {
+      stats.hits   += t->hits;
+      stats.misses += t->misses;
+      stats.bytes  += t->blocks*BLOCK_SIZE;
+    }
+    linkedlist_mtx.unlock();
+    stats.flushes = numFlushes;
+    return stats;
+  }
+
   ////////////////////////////////////////////////////////////////////////////////////////////////////////////
   ////////////////////////////////////////////////////////////////////////////////////////////////////////////
   ////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -329,6 +366,40 @@ namespace embree
   };
 
   cache_regression_test cache_regression;
+
+  struct cache_adapt_regression_test : public RegressionTest
+  {
+    cache_adapt_regression_test() 
+      : RegressionTest("cache_adapt_regression_test")
+    {
+      registerRegressionTest(this);
+    }
+
+    bool run ()
+    {
+      const size_t MB = 1024*1024;
+      const size_t N = SharedLazyTessellationCache::NUM_CACHE_SEGMENTS;
+      bool passed = true;
+
+      /* unused cache keeps its size */
+      passed &= adaptTessellationCacheSize(TessellationCacheStats(0,0,0,0),64*MB,16*MB,256*MB) == 64*MB;
+
+      /* thrashing cache grows up to the maximal size */
+      passed &= adaptTessellationCacheSize(TessellationCacheStats(100,900,N,512*MB),64*MB,16*MB,256*MB) == 128*MB;
+      passed &= adaptTessellationCacheSize(TessellationCacheStats(100,900,N,512*MB),192*MB,16*MB,256*MB) == 256*MB;
+
+      /* few misses or flushes keep the size */
+      passed &= adaptTessellationCacheSize(TessellationCacheStats(990,10,2*N,512*MB),64*MB,16*MB,256*MB) == 64*MB;
+      passed &= adaptTessellationCacheSize(TessellationCacheStats(100,900,N-1,60*MB),64*MB,16*MB,256*MB) == 64*MB;
+
+      /* underused cache shrinks down to the minimal size */
+      passed &= adaptTessellationCacheSize(TessellationCacheStats(900,100,0,8*MB),64*MB,16*MB,256*MB) == 32*MB;
+      passed &= adaptTessellationCacheSize(TessellationCacheStats(900,100,0,1*MB),24*MB,16*MB,256*MB) == 16*MB;
+      return passed;
+    }
+  };
+
+  cache_adapt_regression_test cache_adapt_regression;
 };
 
 extern "C" void printTessCacheStats()
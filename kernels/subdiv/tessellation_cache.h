@@ -47,8 +47,35 @@ namespace embree
     static void clearStats();
   };
   
+  /*! statistics of the shared tessellation cache */
+  struct TessellationCacheStats
+  {
+    __forceinline TessellationCacheStats ()
+      : hits(0), misses(0), flushes(0), bytes(0) {}
+
+    __forceinline TessellationCacheStats (size_t hits, size_t misses, size_t flushes, size_t bytes)
+      : hits(hits), misses(misses), flushes(flushes), bytes(bytes) {}
+
+    __forceinline friend TessellationCacheStats operator- (const TessellationCacheStats& a, const TessellationCacheStats& b) {
+      return TessellationCacheStats(a.hits-b.hits,a.misses-b.misses,a.flushes-b.flushes,a.bytes-b.bytes);
+    }
+
+  public:
+    size_t hits;     //!< number of lookups that found a valid cache entry
+    size_t misses;   //!< number of lookups that had to (re)build the cache entry
+    size_t flushes;  //!< number of cache segments invalidated to make space for new entries
+    size_t bytes;    //!< number of bytes allocated from the cache
+  };
+
   void resizeTessellationCache(size_t new_size);
   void resetTessellationCache();
+
+  /*! returns the statistics accumulated by the shared tessellation cache */
+  TessellationCacheStats getTessellationCacheStats();
+
+  /*! calculates a new cache size in the range [minSize,maxSize] from
+   *  the statistics gathered since the last adaptation */
+  size_t adaptTessellationCacheSize(const TessellationCacheStats& stats, size_t size, size_t minSize, size_t maxSize);
   
  ////////////////////////////////////////////////////////////////////////////////
  ////////////////////////////////////////////////////////////////////////////////
@@ -62,11 +89,21 @@ namespace embree
    ThreadWorkState* next;
    bool allocated;
 
+   /* statistics, only written by the owning thread */
+   std::atomic<size_t> hits;
+   std::atomic<size_t> misses;
+   std::atomic<size_t> blocks;
+
    __forceinline ThreadWorkState(bool allocated = false) 
-     : counter(0), next(nullptr), allocated(allocated) 
+     : counter(0), next(nullptr), allocated(allocated), hits(0), misses(0), blocks(0)
    {
      assert( ((size_t)this % 64) == 0 ); 
    }   
+
+   /* increments a statistics counter without a locked instruction */
+   static __forceinline void count(std::atomic<size_t>& c, const size_t n = 1) {
+     c.store(c.load(std::memory_order_relaxed)+n,std::memory_order_relaxed);
+   }
  };
 
  class __aligned(64) SharedLazyTessellationCache 
@@ -152,6 +189,7 @@ namespace embree
    __aligned(64) SpinLock   linkedlist_mtx;
    __aligned(64) std::atomic<size_t> switch_block_threshold;
    __aligned(64) std::atomic<size_t> numRenderThreads;
+   std::atomic<size_t> numFlushes;
 
 
  public:
@@ -235,12 +273,16 @@ namespace embree
      {
        sharedLazyTessellationCache.lockThreadLoop(t_state);
        void* patch = SharedLazyTessellationCache::lookup(entry,globalTime);
-       if (patch) return (decltype(constructor())) patch;
+       if (patch) {
+         ThreadWorkState::count(t_state->hits);
+         return (decltype(constructor())) patch;
+       }
        
        if (entry.mutex.try_lock())
        {
          if (!validTag(entry.tag,globalTime)) 
          {
+           ThreadWorkState::count(t_state->misses);
            auto timeBefore = sharedLazyTessellationCache.getTime(globalTime);
            auto ret = constructor(); // thread is locked here!
            assert(ret);
@@ -312,6 +354,7 @@ namespace embree
        }
        break;
      }
+     ThreadWorkState::count(t_state->blocks,(bytes+BLOCK_SIZE-1)/BLOCK_SIZE);
      return sharedLazyTessellationCache.getBlockPtr(block_index);
    }
 
@@ -331,6 +374,9 @@ namespace embree
    void allocNextSegment();
    void realloc(const size_t newSize);
 
+   /*! sums up the statistics of all render threads */
+   TessellationCacheStats getStats();
+
    void reset();
 
    static SharedLazyTessellationCache sharedLazyTessellationCache;
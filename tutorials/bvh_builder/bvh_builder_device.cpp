@@ -99,6 +99,14 @@ namespace embree
       void* ptr = rtcThreadLocalAlloc(alloc,sizeof(LeafNode),16);
       return (void*) new (ptr) LeafNode(prims->primID,*(BBox3fa*)prims);
     }
+
+    static void  refit (void* leafPtr, RTCBounds& bounds, void* userPtr)
+    {
+      LeafNode* leaf = (LeafNode*) leafPtr;
+      const RTCBuildPrimitive* prims = (const RTCBuildPrimitive*) userPtr;
+      leaf->bounds = *(const BBox3fa*) &prims[leaf->id];
+      (BBox3fa&) bounds = leaf->bounds;
+    }
   };
 
   void build(RTCBuildQuality quality, avector<RTCBuildPrimitive>& prims_i, char* cfg, size_t extraSpace = 0)
@@ -139,6 +147,25 @@ namespace embree
       std::cout << 1000.0f*(t1-t0) << "ms, " << 1E-6*double(prims.size())/(t1-t0) << " Mprims/s, sah = " << sah << " [DONE]" << std::endl;
     }
 
+    /* move all primitives and refit the last built BVH */
+    avector<RTCBuildPrimitive> moved(prims_i.size());
+    for (size_t i=0; i<10; i++)
+    {
+      const float d = float(i+1);
+      for (size_t j=0; j<moved.size(); j++) {
+        moved[j] = prims_i[j];
+        moved[j].lower_x += d; moved[j].lower_y += d; moved[j].lower_z += d;
+        moved[j].upper_x += d; moved[j].upper_y += d; moved[j].upper_z += d;
+      }
+
+      std::cout << "iteration " << i << ": refitting BVH over " << moved.size() << " primitives, " << std::flush;
+      double t0 = getSeconds();
+      Node* root = (Node*) rtcRefitBVH(bvh,LeafNode::refit,InnerNode::setBounds,nullptr,moved.data());
+      double t1 = getSeconds();
+      const float sah = root ? root->sah() : 0.0f;
+      std::cout << 1000.0f*(t1-t0) << "ms, " << 1E-6*double(moved.size())/(t1-t0) << " Mprims/s, sah = " << sah << " [DONE]" << std::endl;
+    }
+
     rtcMakeStaticBVH(bvh);
     rtcDeleteBVH(bvh);
   }
@@ -184,6 +211,9 @@ namespace embree
     std::cout << "Low quality BVH build:" << std::endl;
     build(RTC_BUILD_QUALITY_LOW,prims,cfg);
 
+    std::cout << "Medium quality BVH build:" << std::endl;
+    build(RTC_BUILD_QUALITY_MEDIUM,prims,cfg);
+
     std::cout << "Normal quality BVH build:" << std::endl;
     build(RTC_BUILD_QUALITY_NORMAL,prims,cfg);
 
@@ -16,6 +16,9 @@
 
 #include "obj_loader.h"
 #include "texture.h"
+#include "parallel_tasks.h"
+
+#include <unordered_map>
 
 namespace embree
 {
@@ -34,13 +37,16 @@ namespace embree
     Crease(float w, int a, int b) : w(w), a(a), b(b) {};
   };
 
-  static inline bool operator < ( const Vertex& a, const Vertex& b ) {
-    if (a.v  != b.v)  return a.v  < b.v;
-    if (a.vn != b.vn) return a.vn < b.vn;
-    if (a.vt != b.vt) return a.vt < b.vt;
-    return false;
+  static inline bool operator == ( const Vertex& a, const Vertex& b ) {
+    return a.v == b.v && a.vt == b.vt && a.vn == b.vn;
   }
 
+  struct VertexHash {
+    __forceinline size_t operator() (const Vertex& v) const {
+      return size_t(v.v)*0x9E3779B1 ^ size_t(v.vt)*0x85EBCA77 ^ size_t(v.vn)*0xC2B2AE3D;
+    }
+  };
+
   /*! Fill space at the end of the token with 0s. */
   static inline const char* trimEnd(const char* token) 
   {
@@ -69,10 +75,74 @@ namespace embree
     return token+=strspn(token, " \t");
   }
 
+  /*! Parses a decimal float. Numbers with at most 19 significant
+   *  digits and a power of ten up to 22 are converted exactly with a
+   *  single rounding, which gives the same result as atof. All other
+   *  numbers fall back to atof. */
+  static inline float parseFloat(const char* token)
+  {
+    static const double pow10[] = {
+      1E0, 1E1, 1E2, 1E3, 1E4, 1E5, 1E6, 1E7, 1E8, 1E9, 1E10, 1E11,
+      1E12, 1E13, 1E14, 1E15, 1E16, 1E17, 1E18, 1E19, 1E20, 1E21, 1E22
+    };
+
+    const char* p = token;
+    const bool neg = *p == '-';
+    if (*p == '-' || *p == '+') p++;
+
+    /* parse mantissa */
+    uint64_t m = 0; int digits = 0, exp = 0; bool valid = false;
+    for (; *p >= '0' && *p <= '9'; p++) {
+      valid = true;
+      if (digits < 19) { m = 10*m + (*p-'0'); if (m) digits++; }
+      else { exp++; if (*p != '0') return (float)atof(token); }
+    }
+    if (*p == '.') {
+      for (p++; *p >= '0' && *p <= '9'; p++) {
+        valid = true;
+        if (digits < 19) { m = 10*m + (*p-'0'); if (m) digits++; exp--; }
+        else if (*p != '0') return (float)atof(token);
+      }
+    }
+
+    /* parse exponent */
+    if (valid && (*p == 'e' || *p == 'E')) 
+    {
+      p++;
+      const bool eneg = *p == '-';
+      if (*p == '-' || *p == '+') p++;
+      if (!(*p >= '0' && *p <= '9')) return (float)atof(token);
+      int e = 0;
+      for (; *p >= '0' && *p <= '9'; p++)
+        if (e < 10000) e = 10*e + (*p-'0');
+      exp += eneg ? -e : e;
+    }
+
+    /* hex numbers, inf, nan, and numbers that need more precision are handled by atof */
+    if (!valid || (*p != 0 && !isSep(*p) && *p != '\r') || m >= (uint64_t(1) << 53) || exp < -22 || exp > 22)
+      return (float)atof(token);
+
+    double d = (double) m;
+    d = exp < 0 ? d/pow10[-exp] : d*pow10[exp];
+    return (float)(neg ? -d : d);
+  }
+
+  /*! Parses a decimal int like atoi. */
+  static inline int parseInt(const char* token)
+  {
+    token += strspn(token, " \t");
+    const bool neg = *token == '-';
+    if (*token == '-' || *token == '+') token++;
+    int n = 0;
+    for (; *token >= '0' && *token <= '9'; token++)
+      n = 10*n + (*token-'0');
+    return neg ? -n : n;
+  }
+
   /*! Read float from a string. */
   static inline float getFloat(const char*& token) {
     token += strspn(token, " \t");
-    float n = (float)atof(token);
+    float n = parseFloat(token);
     token += strcspn(token, " \t\r");
     return n;
   }
@@ -80,7 +150,7 @@ namespace embree
   /*! Read int from a string. */
   static inline int getInt(const char*& token) {
     token += strspn(token, " \t");
-    int n = atoi(token);
+    int n = parseInt(token);
     token += strcspn(token, " \t\r");
     return n;
   }
@@ -112,6 +182,35 @@ namespace embree
     return Vec3fa(x,y,z);
   }
 
+  /*! handles relative indices and starts indexing from 0 */
+  static inline int fix_index(int index, size_t count) {
+    return (index > 0 ? index - 1 : (index == 0 ? 0 : (int) count + index));
+  }
+
+  /*! Reads the next line of [cur,end) into line. Lines ending with a
+   *  backslash get joined with the following line. */
+  static inline bool getLine(const char*& cur, const char* end, std::string& line)
+  {
+    if (cur >= end) return false;
+    const char* eol = (const char*) memchr(cur,'\n',end-cur);
+    if (!eol) eol = end;
+    line.assign(cur,eol);
+    cur = eol < end ? eol+1 : end;
+
+    while (!line.empty() && line[line.size()-1] == '\\') 
+    {
+      line[line.size()-1] = ' ';
+      if (cur >= end) break;
+      eol = (const char*) memchr(cur,'\n',end-cur);
+      if (!eol) eol = end;
+      const char* next = cur;
+      cur = eol < end ? eol+1 : end;
+      if (next == eol) break;
+      line.append(next,eol);
+    }
+    return true;
+  }
+
   class OBJLoader
   {
   public:
@@ -124,6 +223,47 @@ namespace embree
   
   private:
 
+    /*! Statement that depends on the statements before it, thus gets executed in file order. */
+    struct Command
+    {
+      enum Type { USEMTL, MTLLIB, HAIR, CREASE };
+
+      Command (Type type, size_t numFaces, size_t numV, size_t numVN, size_t numVT) 
+        : type(type), numFaces(numFaces), numV(numV), numVN(numVN), numVT(numVT) {}
+
+      Type type;
+      size_t numFaces;            //!< number of faces of the chunk before this statement
+      size_t numV, numVN, numVT;  //!< number of vertices, normals, and texcoords before this statement
+      std::string name;      //!< material name or material library
+      avector<Vec3fa> hair;  //!< control points of a hair
+      Crease crease;         //!< edge crease
+    };
+
+    /*! Part of the file that starts and ends at line boundaries. */
+    struct Chunk
+    {
+      Chunk (const char* begin, const char* end)
+        : begin(begin), end(end), numV(0), numVN(0), numVT(0), baseV(0), baseVN(0), baseVT(0) {}
+
+      const char* begin;
+      const char* end;
+      size_t numV, numVN, numVT;    //!< number of vertices, normals, and texcoords in this chunk
+      size_t baseV, baseVN, baseVT; //!< number of vertices, normals, and texcoords in all previous chunks
+      std::vector<Vertex> faceVertices;
+      std::vector<unsigned> faceSizes;
+      std::vector<Command> commands;
+    };
+
+    /*! Faces of one mesh that get converted in parallel after parsing. */
+    struct FaceGroup
+    {
+      Ref<SceneGraph::Node> mesh;
+      std::vector<Vertex> faceVertices;
+      std::vector<unsigned> faceSizes;
+      std::vector<Crease> ec;
+      size_t numV, numVN, numVT; //!< vertices, normals, and texcoords that were defined before the group got flushed
+    };
+
     /*! file to load */
     FileName path;
   
@@ -136,8 +276,14 @@ namespace embree
     std::vector<Vec2f> vt;
     std::vector<Crease> ec;
 
-    std::vector<std::vector<Vertex> > curGroup;
+    /*! Current face group and the number of vertices, normals, and texcoords defined so far. */
+    std::vector<Vertex> curGroupVertices;
+    std::vector<unsigned> curGroupFaces;
     std::vector<avector<Vec3fa> > curGroupHair;
+    size_t curV, curVN, curVT;
+
+    /*! Face groups to convert into meshes. */
+    std::vector<FaceGroup> faceGroups;
 
     /*! Material handling. */
     std::string curMaterialName;
@@ -147,26 +293,31 @@ namespace embree
 
   private:
     void loadMTL(const FileName& fileName);
-    int fix_v (int index);
-    int fix_vt(int index);
-    int fix_vn(int index);
+    void countChunk(Chunk& chunk);
+    void parseChunk(Chunk& chunk);
     void flushFaceGroup();
     void flushTriGroup();
     void flushHairGroup();
-    Vertex getInt3(const char*& token);
-    uint32_t getVertex(std::map<Vertex,uint32_t>& vertexMap, Ref<SceneGraph::TriangleMeshNode> mesh, const Vertex& i);
+    void buildMesh(FaceGroup& faces);
+    Vertex getInt3(const char*& token, const size_t numV, const size_t numVT, const size_t numVN);
+    uint32_t getVertex(std::unordered_map<Vertex,uint32_t,VertexHash>& vertexMap, Ref<SceneGraph::TriangleMeshNode> mesh, const Vertex& i);
     std::shared_ptr<Texture> loadTexture(const FileName& fname);
   };
 
   OBJLoader::OBJLoader(const FileName &fileName, const bool subdivMode, const bool combineIntoSingleObject) 
-    : group(new SceneGraph::GroupNode), path(fileName.path()), subdivMode(subdivMode)
+    : group(new SceneGraph::GroupNode), path(fileName.path()), subdivMode(subdivMode), curV(0), curVN(0), curVT(0)
   {
-    /* open file */
-    std::ifstream cin;
-    cin.open(fileName.c_str());
-    if (!cin.is_open()) {
-      THROW_RUNTIME_ERROR("cannot open " + fileName.str());
-      return;
+    /* map file, empty files cannot get mapped */
+    size_t bytes = 0;
+    char* file = (char*) os_map_file(fileName.c_str(),bytes);
+    if (!file) {
+      std::ifstream cin;
+      cin.open(fileName.c_str());
+      if (!cin.is_open()) {
+        THROW_RUNTIME_ERROR("cannot open " + fileName.str());
+        return;
+      }
+      bytes = 0;
     }
 
     /* generate default material */
@@ -174,45 +325,156 @@ namespace embree
     curMaterialName = "default";
     curMaterial = defaultMaterial;
 
-    while (cin.peek() != -1)
+    try 
     {
-      /* load next multiline */
-      std::string line; std::getline(cin,line);
-      while (!line.empty() && line[line.size()-1] == '\\') {
-	line[line.size()-1] = ' ';
-	std::string next_line; std::getline(cin,next_line);
-	if (next_line.empty()) break;
-	line += next_line;
+      /* split file into chunks that start at a new line, which is no continuation of the previous line */
+      std::vector<Chunk> chunks;
+      const size_t chunkSize = 4*1024*1024;
+      const char* end = file+bytes;
+      for (const char* begin = file; begin < end; )
+      {
+        const char* cur = begin + min(chunkSize,size_t(end-begin));
+        while (cur < end) {
+          const char* eol = (const char*) memchr(cur,'\n',end-cur);
+          if (!eol) { cur = end; break; }
+          cur = eol+1;
+          if (eol[-1] != '\\') break;
+        }
+        chunks.push_back(Chunk(begin,cur));
+        begin = cur;
+      }
+
+      /* count vertices, normals, and texcoords of each chunk */
+      parallel_tasks(chunks.size(), [&] (size_t i) { countChunk(chunks[i]); });
+
+      /* prefix sums give the location of each chunk in the vertex arrays */
+      size_t numV = 0, numVN = 0, numVT = 0;
+      for (size_t i=0; i<chunks.size(); i++) {
+        chunks[i].baseV  = numV;  numV  += chunks[i].numV;
+        chunks[i].baseVN = numVN; numVN += chunks[i].numVN;
+        chunks[i].baseVT = numVT; numVT += chunks[i].numVT;
+      }
+      v.resize(numV);
+      vn.resize(numVN);
+      vt.resize(numVT);
+
+      /* parse all chunks in parallel */
+      parallel_tasks(chunks.size(), [&] (size_t i) { parseChunk(chunks[i]); });
+
+      /* process faces and order dependent statements in file order */
+      for (size_t c=0; c<chunks.size(); c++)
+      {
+        Chunk& chunk = chunks[c];
+        size_t face = 0, vertex = 0;
+        for (size_t k=0; k<=chunk.commands.size(); k++)
+        {
+          /* append all faces before the next command to the current group */
+          const size_t numFaces = k < chunk.commands.size() ? chunk.commands[k].numFaces : chunk.faceSizes.size();
+          const size_t vertexBegin = vertex;
+          for (; face<numFaces; face++) {
+            curGroupFaces.push_back(chunk.faceSizes[face]);
+            vertex += chunk.faceSizes[face];
+          }
+          curGroupVertices.insert(curGroupVertices.end(),chunk.faceVertices.begin()+vertexBegin,chunk.faceVertices.begin()+vertex);
+          if (k == chunk.commands.size()) break;
+
+          Command& cmd = chunk.commands[k];
+          curV = cmd.numV; curVN = cmd.numVN; curVT = cmd.numVT;
+          switch (cmd.type)
+          {
+          case Command::USEMTL:
+            if (!combineIntoSingleObject) flushFaceGroup();
+            if (material.find(cmd.name) == material.end()) {
+              curMaterial = defaultMaterial;
+              curMaterialName = "default";
+            }
+            else {
+              curMaterial = material[cmd.name];
+              curMaterialName = cmd.name;
+            }
+            break;
+
+          case Command::MTLLIB:
+            loadMTL(path + cmd.name);
+            break;
+
+          case Command::HAIR:
+            curGroupHair.push_back(std::move(cmd.hair));
+            break;
+
+          case Command::CREASE:
+            ec.push_back(cmd.crease);
+            break;
+          }
+        }
+        curV  = chunk.baseV +chunk.numV;
+        curVN = chunk.baseVN+chunk.numVN;
+        curVT = chunk.baseVT+chunk.numVT;
+        chunk = Chunk(nullptr,nullptr);
       }
+      flushFaceGroup();
+
+      /* convert face groups into meshes in parallel */
+      parallel_tasks(faceGroups.size(), [&] (size_t i) { buildMesh(faceGroups[i]); });
+    }
+    catch (...) {
+      os_unmap_file(file,bytes);
+      throw;
+    }
+    os_unmap_file(file,bytes);
+  }
+
+  /*! counts the vertex, normal, and texcoord statements of a chunk */
+  void OBJLoader::countChunk(Chunk& chunk)
+  {
+    std::string line;
+    for (const char* cur = chunk.begin; getLine(cur,chunk.end,line); )
+    {
+      const char* token = trimEnd(line.c_str() + strspn(line.c_str(), " \t"));
+      if (token[0] != 'v') continue;
+      if (isSep(token[1])) chunk.numV++;
+      else if (token[1] == 'n' && isSep(token[2])) chunk.numVN++;
+      else if (token[1] == 't' && isSep(token[2])) chunk.numVT++;
+    }
+  }
+
+  /*! parses a chunk, vertices, normals, and texcoords are written to
+   *  their final location, all other statements get recorded */
+  void OBJLoader::parseChunk(Chunk& chunk)
+  {
+    size_t numV = chunk.baseV, numVN = chunk.baseVN, numVT = chunk.baseVT;
+    std::string line;
+    for (const char* cur = chunk.begin; getLine(cur,chunk.end,line); )
+    {
       const char* token = trimEnd(line.c_str() + strspn(line.c_str(), " \t"));
       if (token[0] == 0) continue;
 
       /*! parse position */
       if (token[0] == 'v' && isSep(token[1])) { 
-        v.push_back(getVec3f(token += 2)); continue;
+        v[numV++] = getVec3f(token += 2); continue;
       }
 
       /* parse normal */
       if (token[0] == 'v' && token[1] == 'n' && isSep(token[2])) { 
-        vn.push_back(getVec3f(token += 3)); 
+        vn[numVN++] = getVec3f(token += 3); 
         continue; 
       }
 
       /* parse texcoord */
-      if (token[0] == 'v' && token[1] == 't' && isSep(token[2])) { vt.push_back(getVec2f(token += 3)); continue; }
+      if (token[0] == 'v' && token[1] == 't' && isSep(token[2])) { vt[numVT++] = getVec2f(token += 3); continue; }
 
       /*! parse face */
       if (token[0] == 'f' && isSep(token[1]))
       {
         parseSep(token += 1);
 
-        std::vector<Vertex> face;
+        unsigned size = 0;
         while (token[0]) {
-	  Vertex vtx = getInt3(token);
-          face.push_back(vtx);
+          chunk.faceVertices.push_back(getInt3(token,numV,numVT,numVN));
           parseSepOpt(token);
+          size++;
         }
-        curGroup.push_back(face);
+        chunk.faceSizes.push_back(size);
         continue;
       }
 
@@ -230,7 +492,8 @@ namespace embree
         else continue;
 
         int N = getInt(token);
-        avector<Vec3fa> hair;
+        Command cmd(Command::HAIR,chunk.faceSizes.size(),numV,numVN,numVT);
+        avector<Vec3fa>& hair = cmd.hair;
         for (int i=0; i<3*N+1; i++) {
           hair.push_back(getVec3fa(token));
         }
@@ -243,7 +506,8 @@ namespace embree
           hair[3*i+0].w = r;
           if (i != N) hair[3*i+1].w = r;
         }
-        curGroupHair.push_back(hair);
+        chunk.commands.push_back(std::move(cmd));
+        continue;
       }
       
       /*! parse edge crease */
@@ -252,41 +516,35 @@ namespace embree
 	parseSep(token += 2);
 	float w = getFloat(token);
 	parseSepOpt(token);
-	int a = fix_v(getInt(token));
+	int a = fix_index(getInt(token),numV);
 	parseSepOpt(token);
-	int b = fix_v(getInt(token));
+	int b = fix_index(getInt(token),numV);
 	parseSepOpt(token);
-	ec.push_back(Crease(w, a, b));
+        Command cmd(Command::CREASE,chunk.faceSizes.size(),numV,numVN,numVT);
+        cmd.crease = Crease(w, a, b);
+	chunk.commands.push_back(std::move(cmd));
 	continue;
       }
 
       /*! use material */
       if (!strncmp(token, "usemtl", 6) && isSep(token[6]))
       {
-        if (!combineIntoSingleObject) flushFaceGroup();
-        std::string name(parseSep(token += 6));
-        if (material.find(name) == material.end()) {
-          curMaterial = defaultMaterial;
-          curMaterialName = "default";
-        }
-        else {
-          curMaterial = material[name];
-          curMaterialName = name;
-        }
+        Command cmd(Command::USEMTL,chunk.faceSizes.size(),numV,numVN,numVT);
+        cmd.name = parseSep(token += 6);
+        chunk.commands.push_back(std::move(cmd));
         continue;
       }
 
       /* load material library */
       if (!strncmp(token, "mtllib", 6) && isSep(token[6])) {
-        loadMTL(path + std::string(parseSep(token += 6)));
+        Command cmd(Command::MTLLIB,chunk.faceSizes.size(),numV,numVN,numVT);
+        cmd.name = parseSep(token += 6);
+        chunk.commands.push_back(std::move(cmd));
         continue;
       }
 
       // ignore unknown stuff
     }
-    flushFaceGroup();
-
-    cin.close();
   }
 
   struct ExtObjMaterial
@@ -463,17 +721,12 @@ namespace embree
     cin.close();
   }
 
-  /*! handles relative indices and starts indexing from 0 */
-  int OBJLoader::fix_v (int index) { return (index > 0 ? index - 1 : (index == 0 ? 0 : (int) v .size() + index)); }
-  int OBJLoader::fix_vt(int index) { return (index > 0 ? index - 1 : (index == 0 ? 0 : (int) vt.size() + index)); }
-  int OBJLoader::fix_vn(int index) { return (index > 0 ? index - 1 : (index == 0 ? 0 : (int) vn.size() + index)); }
-
   /*! Parse differently formated triplets like: n0, n0/n1/n2, n0//n2, n0/n1.          */
   /*! All indices are converted to C-style (from 0). Missing entries are assigned -1. */
-  Vertex OBJLoader::getInt3(const char*& token)
+  Vertex OBJLoader::getInt3(const char*& token, const size_t numV, const size_t numVT, const size_t numVN)
   {
     Vertex v(-1);
-    v.v = fix_v(atoi(token));
+    v.v = fix_index(parseInt(token),numV);
     token += strcspn(token, "/ \t\r");
     if (token[0] != '/') return(v);
     token++;
@@ -481,26 +734,26 @@ namespace embree
     // it is i//n
     if (token[0] == '/') {
       token++;
-      v.vn = fix_vn(atoi(token));
+      v.vn = fix_index(parseInt(token),numVN);
       token += strcspn(token, " \t\r");
       return(v);
     }
 
     // it is i/t/n or i/t
-    v.vt = fix_vt(atoi(token));
+    v.vt = fix_index(parseInt(token),numVT);
     token += strcspn(token, "/ \t\r");
     if (token[0] != '/') return(v);
     token++;
 
     // it is i/t/n
-    v.vn = fix_vn(atoi(token));
+    v.vn = fix_index(parseInt(token),numVN);
     token += strcspn(token, " \t\r");
     return(v);
   }
 
-  uint32_t OBJLoader::getVertex(std::map<Vertex,uint32_t>& vertexMap, Ref<SceneGraph::TriangleMeshNode> mesh, const Vertex& i)
+  uint32_t OBJLoader::getVertex(std::unordered_map<Vertex,uint32_t,VertexHash>& vertexMap, Ref<SceneGraph::TriangleMeshNode> mesh, const Vertex& i)
   {
-    const std::map<Vertex, uint32_t>::iterator& entry = vertexMap.find(i);
+    const std::unordered_map<Vertex,uint32_t,VertexHash>::iterator& entry = vertexMap.find(i);
     if (entry != vertexMap.end()) return(entry->second);
     mesh->positions[0].push_back(Vec3fa(v[i.v].x,v[i.v].y,v[i.v].z));
     if (i.vn >= 0) {
@@ -520,31 +773,48 @@ namespace embree
     flushHairGroup();
   }
 
-  /*! end current facegroup and append to mesh */
+  /*! end current facegroup and append to mesh, the mesh gets filled after parsing */
   void OBJLoader::flushTriGroup()
   {
-    if (curGroup.empty()) return;
+    if (curGroupFaces.empty()) return;
+
+    FaceGroup faces;
+    if (subdivMode) faces.mesh = new SceneGraph::SubdivMeshNode(curMaterial,1);
+    else            faces.mesh = new SceneGraph::TriangleMeshNode(curMaterial,1);
+    group->add(faces.mesh);
 
+    faces.faceVertices = std::move(curGroupVertices);
+    faces.faceSizes = std::move(curGroupFaces);
+    faces.ec = std::move(ec);
+    faces.numV = curV; faces.numVN = curVN; faces.numVT = curVT;
+    faceGroups.push_back(std::move(faces));
+
+    curGroupVertices.clear();
+    curGroupFaces.clear();
+    ec.clear();
+  }
+
+  void OBJLoader::buildMesh(FaceGroup& faces)
+  {
     if (subdivMode)
     {
-      Ref<SceneGraph::SubdivMeshNode> mesh = new SceneGraph::SubdivMeshNode(curMaterial,1);
-      group->add(mesh.cast<SceneGraph::Node>());
+      Ref<SceneGraph::SubdivMeshNode> mesh = faces.mesh.dynamicCast<SceneGraph::SubdivMeshNode>();
 
-      for (size_t i=0; i<v.size();  i++) mesh->positions[0].push_back(v[i]);
-      for (size_t i=0; i<vn.size(); i++) mesh->normals[0].push_back(vn[i]);
-      for (size_t i=0; i<vt.size(); i++) mesh->texcoords.push_back(vt[i]);
+      for (size_t i=0; i<faces.numV;  i++) mesh->positions[0].push_back(v[i]);
+      for (size_t i=0; i<faces.numVN; i++) mesh->normals[0].push_back(vn[i]);
+      for (size_t i=0; i<faces.numVT; i++) mesh->texcoords.push_back(vt[i]);
       
-      for (size_t i=0; i<ec.size(); ++i) {
-        assert(((size_t)ec[i].a < v.size()) && ((size_t)ec[i].b < v.size()));
-        mesh->edge_creases.push_back(Vec2i(ec[i].a, ec[i].b));
-        mesh->edge_crease_weights.push_back(ec[i].w);
+      for (size_t i=0; i<faces.ec.size(); ++i) {
+        assert(((size_t)faces.ec[i].a < faces.numV) && ((size_t)faces.ec[i].b < faces.numV));
+        mesh->edge_creases.push_back(Vec2i(faces.ec[i].a, faces.ec[i].b));
+        mesh->edge_crease_weights.push_back(faces.ec[i].w);
       }
       
-      for (size_t j=0; j<curGroup.size(); j++)
+      for (size_t j=0, ofs=0; j<faces.faceSizes.size(); ofs+=faces.faceSizes[j++])
       {
-        const std::vector<Vertex>& face = curGroup[j];
-        mesh->verticesPerFace.push_back(int(face.size()));
-        for (size_t i=0; i<face.size(); i++)
+        const Vertex* face = &faces.faceVertices[ofs];
+        mesh->verticesPerFace.push_back(int(faces.faceSizes[j]));
+        for (size_t i=0; i<faces.faceSizes[j]; i++)
           mesh->position_indices.push_back(face[i].v);
       }
       if (mesh->normals[0].size() == 0)
@@ -553,18 +823,17 @@ namespace embree
     }
     else
     {
-      Ref<SceneGraph::TriangleMeshNode> mesh = new SceneGraph::TriangleMeshNode(curMaterial,1);
-      group->add(mesh.cast<SceneGraph::Node>());
+      Ref<SceneGraph::TriangleMeshNode> mesh = faces.mesh.dynamicCast<SceneGraph::TriangleMeshNode>();
       // merge three indices into one
-      std::map<Vertex, uint32_t> vertexMap;
-      for (size_t j=0; j<curGroup.size(); j++)
+      std::unordered_map<Vertex,uint32_t,VertexHash> vertexMap;
+      for (size_t j=0, ofs=0; j<faces.faceSizes.size(); ofs+=faces.faceSizes[j++])
       {
         /* iterate over all faces */
-        const std::vector<Vertex>& face = curGroup[j];
+        const Vertex* face = &faces.faceVertices[ofs];
         
         /* triangulate the face with a triangle fan */
         Vertex i0 = face[0], i1 = Vertex(-1), i2 = face[1];
-        for (size_t k=2; k < face.size(); k++) 
+        for (size_t k=2; k < faces.faceSizes[j]; k++) 
         {
           i1 = i2; i2 = face[k];
           uint32_t v0,v1,v2;
@@ -585,9 +854,9 @@ namespace embree
         mesh->normals.clear();
       mesh->verify();
     }
-    
-    curGroup.clear();
-    ec.clear();
+
+    /* free face data early */
+    faces = FaceGroup();
   }
 
    void OBJLoader::flushHairGroup()
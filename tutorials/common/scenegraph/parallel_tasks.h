@@ -0,0 +1,79 @@
+// ======================================================================== //
+// Copyright 2009-2017 Intel Corporation                                    //
+//                                                                          //
+// Licensed under the Apache License, Version 2.0 (the "License");          //
+// you may not use this file except in compliance with the License.         //
+// You may obtain a copy of the License at                                  //
+//                                                                          //
+//     http://www.apache.org/licenses/LICENSE-2.0                           //
+//                                                                          //
+// Unless required by applicable law or agreed to in writing, software      //
+// distributed under the License is distributed on an "AS IS" BASIS,        //
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. //
+// See the License for the specific language governing permissions and      //
+// limitations under the License.                                           //
+// ======================================================================== //
+
+#pragma once
+
+#include "../../../common/sys/thread.h"
+#include "../../../common/sys/sysinfo.h"
+
+#include <atomic>
+#include <exception>
+
+namespace embree
+{
+  /*! Executes func(taskIndex) for all tasks in [0,taskCount) using
+   *  one thread per logical core. The scene loaders run before any
+   *  Embree device exists, thus they cannot use the tasking system of
+   *  Embree and start their own threads instead. The first exception
+   *  thrown by some task gets rethrown once all threads finished. */
+  template<typename Func>
+    void parallel_tasks(size_t taskCount, const Func& func)
+  {
+    if (taskCount == 0) return;
+    
+    struct Tasks
+    {
+      Tasks (size_t taskCount, const Func& func)
+        : taskCount(taskCount), func(func), next(0) {}
+
+      static void thread_func(Tasks* tasks) {
+        tasks->run();
+      }
+
+      void run()
+      {
+        try {
+          for (size_t i=next++; i<taskCount; i=next++)
+            func(i);
+        } 
+        catch (...) {
+          Lock<MutexSys> lock(mutex);
+          if (exception == nullptr) exception = std::current_exception();
+          next = taskCount;
+        }
+      }
+
+      const size_t taskCount;
+      const Func& func;
+      std::atomic<size_t> next;
+      MutexSys mutex;
+      std::exception_ptr exception;
+    };
+    Tasks tasks(taskCount,func);
+
+    /* the calling thread executes tasks too */
+    const size_t numThreads = min(taskCount,(size_t)getNumberOfLogicalThreads());
+    std::vector<thread_t> threads;
+    for (size_t i=1; i<numThreads; i++)
+      threads.push_back(createThread((thread_func)Tasks::thread_func,&tasks));
+    tasks.run();
+    for (size_t i=0; i<threads.size(); i++)
+      join(threads[i]);
+
+    if (tasks.exception != nullptr)
+      std::rethrow_exception(tasks.exception);
+  }
+}
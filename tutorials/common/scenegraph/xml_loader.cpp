@@ -17,6 +17,7 @@
 #include "xml_loader.h"
 #include "xml_parser.h"
 #include "obj_loader.h"
+#include "parallel_tasks.h"
 #include "config.h"
 
 namespace embree
@@ -265,6 +266,8 @@ namespace embree
   private:
     template<typename T> T load(const Ref<XML>& xml) { assert(false); return T(zero); }
     template<typename T> T load(const Ref<XML>& xml, const T& opt) { assert(false); return T(zero); }
+    template<typename T> const T* mapBinary(const Ref<XML>& xml, size_t& size);
+    const char* mapBinary(size_t ofs, size_t bytes);
     template<typename Vector> Vector loadBinary(const Ref<XML>& xml);
 
     std::vector<float> loadFloatArray(const Ref<XML>& xml);
@@ -280,9 +283,10 @@ namespace embree
 
   private:
     FileName path;         //!< path to XML file
-    FILE* binFile;         //!< .bin file for reading binary data
+    char* binFile;         //!< .bin file mapped into memory for reading binary data
     FileName binFileName;  //!< name of the .bin file
-    size_t binFileSize;
+    size_t binFileSize;    //!< size of the .bin file in bytes
+    size_t binFileOfs;     //!< end of the last array read from the .bin file
 
   private:
     std::map<std::string,Ref<SceneGraph::MaterialNode> > materialMap;     //!< named materials
@@ -406,28 +410,61 @@ namespace embree
     }
   }
 
-  template<typename Vector>
-  Vector XMLLoader::loadBinary(const Ref<XML>& xml)
+  /*! copies large arrays in blocks using multiple threads, which lets
+   *  the OS serve the page faults of the mapped .bin file in parallel */
+  static void copyBinary(void* dst, const char* src, size_t bytes)
   {
-    if (!binFile) 
-      THROW_RUNTIME_ERROR("cannot open file "+binFileName.str()+" for reading");
+    const size_t blockSize = 4*1024*1024;
+    if (bytes <= blockSize) {
+      if (bytes) memcpy(dst,src,bytes);
+      return;
+    }
 
-    size_t ofs = atol(xml->parm("ofs").c_str());
-    fseek(binFile,long(ofs),SEEK_SET);
+    const size_t numBlocks = (bytes+blockSize-1)/blockSize;
+    parallel_tasks(numBlocks, [&] (size_t i) {
+        const size_t begin = i*blockSize;
+        const size_t end = min(begin+blockSize,bytes);
+        memcpy((char*)dst+begin,src+begin,end-begin);
+      });
+  }
 
-    /* read size of array */
-    size_t size = atol(xml->parm("size").c_str());
-    if (size == 0) size = atol(xml->parm("num").c_str()); // version for BGF format
+  const char* XMLLoader::mapBinary(size_t ofs, size_t bytes)
+  {
+    if (bytes == 0) 
+      return nullptr;
+
+    if (!binFile) 
+      THROW_RUNTIME_ERROR("cannot open file "+binFileName.str()+" for reading");
 
     /* perform security check that we stay in the file */
-    if (ofs + size*sizeof(typename Vector::value_type) > binFileSize)
+    if (ofs > binFileSize || bytes > binFileSize-ofs)
       THROW_RUNTIME_ERROR("error reading from binary file: "+binFileName.str());
 
-    /* read data from file */
-    Vector data(size);
-    if (size != fread(data.data(), sizeof(typename Vector::value_type), data.size(), binFile)) 
+    binFileOfs = ofs+bytes;
+    return binFile+ofs;
+  }
+
+  template<typename T>
+  const T* XMLLoader::mapBinary(const Ref<XML>& xml, size_t& size)
+  {
+    const size_t ofs = strtoull(xml->parm("ofs").c_str(),nullptr,10);
+
+    /* read size of array */
+    size = strtoull(xml->parm("size").c_str(),nullptr,10);
+    if (size == 0) size = strtoull(xml->parm("num").c_str(),nullptr,10); // version for BGF format
+    if (size > binFileSize/sizeof(T))
       THROW_RUNTIME_ERROR("error reading from binary file: "+binFileName.str());
 
+    return (const T*) mapBinary(ofs,size*sizeof(T));
+  }
+
+  template<typename Vector>
+  Vector XMLLoader::loadBinary(const Ref<XML>& xml)
+  {
+    size_t size = 0;
+    const char* src = (const char*) mapBinary<typename Vector::value_type>(xml,size);
+    Vector data(size);
+    copyBinary(data.data(),src,size*sizeof(typename Vector::value_type));
     return data;
   }
 
@@ -489,9 +526,10 @@ namespace embree
     if (!xml) return avector<Vec3fa>();
 
     if (xml->parm("ofs") != "") {
-      std::vector<Vec3f> temp = loadBinary<std::vector<Vec3f>>(xml);
-      avector<Vec3fa> data; data.resize(temp.size());
-      for (size_t i=0; i<temp.size(); i++) data[i] = Vec3fa(temp[i]);
+      size_t size = 0;
+      const Vec3f* src = mapBinary<Vec3f>(xml,size);
+      avector<Vec3fa> data; data.resize(size);
+      for (size_t i=0; i<size; i++) data[i] = Vec3fa(src[i]);
       return data;
     } 
     else 
@@ -530,9 +568,10 @@ namespace embree
     if (xml->parm("ofs") == "") 
       THROW_RUNTIME_ERROR(xml->loc.str()+": invalid AffineSpace3fa array");
 
-    std::vector<AffineSpace3f> temp = loadBinary<std::vector<AffineSpace3f>>(xml);
-    avector<AffineSpace3fa> data; data.resize(temp.size());
-    for (size_t i=0; i<temp.size(); i++) data[i] = AffineSpace3fa(temp[i]);
+    size_t size = 0;
+    const AffineSpace3f* src = mapBinary<AffineSpace3f>(xml,size);
+    avector<AffineSpace3fa> data; data.resize(size);
+    for (size_t i=0; i<size; i++) data[i] = AffineSpace3fa(src[i]);
     return data;
   }
 
@@ -694,12 +733,13 @@ namespace embree
       const unsigned height = stoi(xml->parm("height"));
       const Texture::Format format = Texture::string_to_format(xml->parm("format"));
       const unsigned bytesPerTexel = Texture::getFormatBytesPerTexel(format);
-      if (ftell(binFile) + width*height*bytesPerTexel > (unsigned)binFileSize)
-        THROW_RUNTIME_ERROR("error reading from binary file: "+binFileName.str());
-      
+
+      /* older files store the texture right after the previously read array */
+      const size_t ofs = xml->parm("ofs") != "" ? strtoull(xml->parm("ofs").c_str(),nullptr,10) : binFileOfs;
+      const size_t bytes = size_t(width)*size_t(height)*bytesPerTexel;
+      const char* src = mapBinary(ofs,bytes);
       texture = std::make_shared<Texture>(width,height,format);
-      if (width*height != fread(texture->data, bytesPerTexel, width*height, binFile)) 
-        THROW_RUNTIME_ERROR("error reading from binary file: "+binFileName.str());
+      copyBinary(texture->data,src,bytes);
     }
     
     if (id != "") textureMap[id] = texture;
@@ -1340,20 +1380,18 @@ namespace embree
     XMLLoader loader(fileName,space); return loader.root;
   }
 
-  XMLLoader::XMLLoader(const FileName& fileName, const AffineSpace3fa& space) : binFile(nullptr), binFileSize(0), currentNodeID(0)
+  XMLLoader::XMLLoader(const FileName& fileName, const AffineSpace3fa& space) : binFile(nullptr), binFileSize(0), binFileOfs(0), currentNodeID(0)
   {
+    /* map the .bin file instead of reading it, such that arrays get
+     * copied straight from the page cache without seeking */
     path = fileName.path();
     binFileName = fileName.setExt(".bin");
-    binFile = fopen(binFileName.c_str(),"rb");
+    binFile = (char*) os_map_file(binFileName.c_str(),binFileSize);
     if (!binFile) {
       binFileName = fileName.addExt(".bin");
-      binFile = fopen(binFileName.c_str(),"rb");
-    }
-    if (binFile) {
-      fseek(binFile, 0L, SEEK_END);
-      binFileSize = ftell(binFile);
-      fseek(binFile, 0L, SEEK_SET);
+      binFile = (char*) os_map_file(binFileName.c_str(),binFileSize);
     }
+    if (!binFile) binFileSize = 0;
 
     Ref<XML> xml = parseXML(fileName);
     if (xml->name == "scene") 
@@ -1381,7 +1419,7 @@ namespace embree
   }
 
   XMLLoader::~XMLLoader() {
-    if (binFile) fclose(binFile);
+    os_unmap_file(binFile,binFileSize);
   }
 
   /*! read from disk */
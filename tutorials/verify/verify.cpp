@@ -21,7 +21,16 @@
 #include "../tutorials/common/scenegraph/geometry_creation.h"
 #include "../common/algorithms/parallel_for.h"
 #include <regex>
+#include <set>
 #include <stack>
+#include <thread>
+
+#if defined(__LINUX__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 #define random  use_random_function_of_test // do use random_int() and random_float() from Test class
 #define drand48 use_random_function_of_test // do use random_int() and random_float() from Test class
@@ -149,6 +158,15 @@ namespace embree
     bounds_o->upper.z = sphere->pos.z+sphere->r;
   }
 
+  void PointQueryFunc(Sphere* sphere, const RTCPointQuery& query, size_t item, float closest_o[3])
+  {
+    const Vec3fa p(query.p[0],query.p[1],query.p[2]);
+    const Vec3fa q = sphere->pos + sphere->r*normalize(p-sphere->pos);
+    closest_o[0] = q.x;
+    closest_o[1] = q.y;
+    closest_o[2] = q.z;
+  }
+
   void IntersectFuncN(const int* valid,
                       void* ptr,
                       const RTCIntersectContext* context,
@@ -765,6 +783,170 @@ namespace embree
     }
   };
 
+  struct BuildBVHRefitTest : public VerifyApplication::Test
+  {
+    RTCBuildQuality quality;
+    size_t maxLeafSize;
+
+    BuildBVHRefitTest (std::string name, int isa, RTCBuildQuality quality, size_t maxLeafSize)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS), quality(quality), maxLeafSize(maxLeafSize) {}
+
+    static const size_t BRANCHING_FACTOR = 4;
+
+    static BBox3fa primBounds(const RTCBuildPrimitive& prim) {
+      return BBox3fa(Vec3fa(prim.lower_x,prim.lower_y,prim.lower_z),Vec3fa(prim.upper_x,prim.upper_y,prim.upper_z));
+    }
+
+    /* the builders do not define the fourth component of bounds */
+    static bool equalBounds(const BBox3fa& a, const BBox3fa& b) {
+      return a.lower.x == b.lower.x && a.lower.y == b.lower.y && a.lower.z == b.lower.z &&
+             a.upper.x == b.upper.x && a.upper.y == b.upper.y && a.upper.z == b.upper.z;
+    }
+
+    /* inner node or leaf of the BVH built through the callbacks */
+    struct Node
+    {
+      static void* create (RTCThreadLocalAllocator alloc, size_t numChildren, void* userPtr)
+      {
+        Node* node = (Node*) rtcThreadLocalAlloc(alloc,sizeof(Node),16);
+        node->numChildren = numChildren;
+        node->numPrims = 0;
+        node->primIDs = nullptr;
+        return node;
+      }
+
+      static void setChildren (void* nodePtr, void** children, size_t numChildren, void* userPtr)
+      {
+        for (size_t i=0; i<numChildren; i++)
+          ((Node*)nodePtr)->children[i] = (Node*) children[i];
+      }
+
+      static void setBounds (void* nodePtr, const RTCBounds** bounds, size_t numChildren, void* userPtr)
+      {
+        for (size_t i=0; i<numChildren; i++)
+          ((Node*)nodePtr)->bounds[i] = *(const BBox3fa*) bounds[i];
+      }
+
+      static void* createLeaf (RTCThreadLocalAllocator alloc, const RTCBuildPrimitive* prims, size_t numPrims, void* userPtr)
+      {
+        Node* node = (Node*) rtcThreadLocalAlloc(alloc,sizeof(Node)+numPrims*sizeof(unsigned),16);
+        node->numChildren = 0;
+        node->numPrims = numPrims;
+        node->primIDs = (unsigned*) (node+1);
+        for (size_t i=0; i<numPrims; i++) node->primIDs[i] = prims[i].primID;
+        return node;
+      }
+
+      static void leafBounds (void* leafPtr, RTCBounds& bounds_o, void* userPtr)
+      {
+        const Node* leaf = (const Node*) leafPtr;
+        const RTCBuildPrimitive* prims = (const RTCBuildPrimitive*) userPtr;
+        BBox3fa bounds = empty;
+        for (size_t i=0; i<leaf->numPrims; i++) bounds.extend(primBounds(prims[leaf->primIDs[i]]));
+        (BBox3fa&) bounds_o = bounds;
+      }
+
+      /* checks that the bounds stored for this subtree enclose its primitives tightly */
+      bool check(const BBox3fa& bounds, const RTCBuildPrimitive* prims, std::vector<unsigned>& counts, size_t maxLeafSize) const
+      {
+        bool passed = true;
+        BBox3fa merged = empty;
+        if (numChildren == 0)
+        {
+          passed &= numPrims <= maxLeafSize;
+          for (size_t i=0; i<numPrims; i++) {
+            counts[primIDs[i]]++;
+            merged.extend(primBounds(prims[primIDs[i]]));
+          }
+        }
+        else
+        {
+          passed &= numChildren <= BRANCHING_FACTOR;
+          for (size_t i=0; i<numChildren; i++) {
+            merged.extend(this->bounds[i]);
+            passed &= children[i]->check(this->bounds[i],prims,counts,maxLeafSize);
+          }
+        }
+        return passed && equalBounds(merged,bounds);
+      }
+
+    public:
+      size_t numChildren;
+      size_t numPrims;
+      unsigned* primIDs;
+      BBox3fa bounds[BRANCHING_FACTOR];
+      Node* children[BRANCHING_FACTOR];
+    };
+
+    static bool checkBVH(const Node* root, const RTCBuildPrimitive* prims, size_t numPrims, size_t maxLeafSize)
+    {
+      BBox3fa bounds = empty;
+      for (size_t i=0; i<numPrims; i++) bounds.extend(primBounds(prims[i]));
+      std::vector<unsigned> counts(numPrims,0);
+      bool passed = root != nullptr && root->check(bounds,prims,counts,maxLeafSize);
+      for (size_t i=0; i<numPrims; i++) passed &= counts[i] == 1;
+      return passed;
+    }
+    
+    VerifyApplication::TestReturnValue run (VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcDeviceGetError(device));
+
+      const size_t numPrims = 10000;
+      avector<RTCBuildPrimitive> prims(numPrims);
+      for (size_t i=0; i<numPrims; i++)
+      {
+        const Vec3fa p = 100.0f*Vec3fa(random_float(),random_float(),random_float());
+        const Vec3fa d = Vec3fa(random_float(),random_float(),random_float());
+        RTCBuildPrimitive& prim = prims[i];
+        prim.lower_x = p.x;     prim.lower_y = p.y;     prim.lower_z = p.z;     prim.geomID = 0;
+        prim.upper_x = p.x+d.x; prim.upper_y = p.y+d.y; prim.upper_z = p.z+d.z; prim.primID = (unsigned) i;
+      }
+
+      RTCBuildSettings settings = rtcDefaultBuildSettings();
+      settings.quality = quality;
+      settings.maxBranchingFactor = BRANCHING_FACTOR;
+      settings.maxDepth = 1024;
+      settings.maxLeafSize = (unsigned) maxLeafSize;
+
+      /* the builders reorder the build primitives */
+      avector<RTCBuildPrimitive> build = prims;
+      RTCBVH bvh = rtcNewBVH(device);
+      Node* root = (Node*) rtcBuildBVH(bvh,settings,build.data(),build.size(),
+                                       Node::create,Node::setChildren,Node::setBounds,Node::createLeaf,nullptr,nullptr,nullptr);
+      AssertNoError(device);
+      bool passed = checkBVH(root,prims.data(),numPrims,maxLeafSize);
+
+      /* refitting moved primitives has to update all node bounds */
+      for (size_t j=0; j<3; j++)
+      {
+        for (size_t i=0; i<numPrims; i++)
+        {
+          const Vec3fa ds = 10.0f*Vec3fa(random_float(),random_float(),random_float());
+          RTCBuildPrimitive& prim = prims[i];
+          prim.lower_x += ds.x; prim.lower_y += ds.y; prim.lower_z += ds.z;
+          prim.upper_x += ds.x; prim.upper_y += ds.y; prim.upper_z += ds.z;
+        }
+
+        BBox3fa bounds = empty;
+        Node* refit = (Node*) rtcRefitBVH(bvh,Node::leafBounds,Node::setBounds,(RTCBounds*)&bounds,prims.data());
+        AssertNoError(device);
+        passed &= refit == root;
+        passed &= checkBVH(refit,prims.data(),numPrims,maxLeafSize);
+
+        BBox3fa expected = empty;
+        for (size_t i=0; i<numPrims; i++) expected.extend(primBounds(prims[i]));
+        passed &= equalBounds(bounds,expected);
+      }
+
+      rtcDeleteBVH(bvh);
+      AssertNoError(device);
+      return (VerifyApplication::TestReturnValue) passed;
+    }
+  };
+
   struct GetBoundsTest : public VerifyApplication::Test
   {
     GeometryType gtype;
@@ -1106,16 +1288,1211 @@ namespace embree
       rtcCommit (scene);
       AssertNoError(device);
 
-      if ((sflags & RTC_SCENE_DYNAMIC) == 0) 
+      if ((sflags & RTC_SCENE_DYNAMIC) == 0) 
+      {
+        for (unsigned int i=0; i<8; i++) {
+          rtcDisable(scene,i);
+          AssertAnyError(device);
+        }
+      }
+      AssertNoError(device);
+
+      return VerifyApplication::PASSED;
+    }
+  };
+
+  struct SaveLoadSceneTest : public VerifyApplication::Test
+  {
+    RTCSceneFlags sflags;
+
+    SaveLoadSceneTest (std::string name, int isa, RTCSceneFlags sflags)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS), sflags(sflags) {}
+    
+    VerifyApplication::TestReturnValue run (VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcDeviceGetError(device));
+
+      const Vec3fa center = zero;
+      const float radius = 1.0f;
+      const Vec3fa dx(1,0,0);
+      const Vec3fa dy(0,1,0);
+      std::vector<Ref<SceneGraph::Node>> nodes;
+      nodes.push_back(SceneGraph::createTriangleSphere(center,radius,50));
+      nodes.push_back(SceneGraph::createQuadSphere(center+Vec3fa(2,0,0),radius,50));
+      nodes.push_back(SceneGraph::createHairyPlane(RandomSampler_getInt(sampler),center,dx,dy,0.1f,0.01f,100,SceneGraph::HairSetNode::HAIR));
+
+      /* build the first scene and store its acceleration structures */
+      VerifyScene scene0(device,sflags,RTC_INTERSECT1);
+      for (auto node : nodes) scene0.addGeometry(RTC_GEOMETRY_STATIC,node);
+      rtcCommit (scene0);
+      AssertNoError(device);
+      const std::string fileName = "verify_save_load_scene.bvh";
+      rtcSaveScene(scene0,fileName.c_str());
+      AssertNoError(device);
+
+      /* restore acceleration structures of identical second scene */
+      VerifyScene scene1(device,sflags,RTC_INTERSECT1);
+      for (auto node : nodes) scene1.addGeometry(RTC_GEOMETRY_STATIC,node);
+      rtcLoadScene(scene1,fileName.c_str());
+      AssertNoError(device);
+
+      /* loading into a different scene has to fail */
+      VerifyScene scene2(device,sflags,RTC_INTERSECT1);
+      scene2.addGeometry(RTC_GEOMETRY_STATIC,nodes[0]);
+      rtcLoadScene(scene2,fileName.c_str());
+      AssertError(device,RTC_INVALID_OPERATION);
+
+      /* both scenes have to report the same hits */
+      bool passed = true;
+      for (size_t i=0; i<256; i++)
+      {
+        const Vec3fa org(2.0f*random_float()-1.0f,2.0f*random_float()-1.0f,-4.0f);
+        const Vec3fa dir(random_float()-0.5f,random_float()-0.5f,1.0f);
+        RTCRay ray0 = makeRay(org,dir); rtcIntersect(scene0,ray0);
+        RTCRay ray1 = makeRay(org,dir); rtcIntersect(scene1,ray1);
+        passed &= ray0.geomID == ray1.geomID;
+        passed &= ray0.primID == ray1.primID;
+        passed &= ray0.tfar == ray1.tfar;
+      }
+      AssertNoError(device);
+      remove(fileName.c_str());
+
+      return (VerifyApplication::TestReturnValue) passed;
+    }
+  };
+
+  /* builds the same scene with the default device configuration and
+   * with an additional configuration, both have to report the same hits */
+  struct SameHitsTest : public VerifyApplication::Test
+  {
+    RTCSceneFlags sflags;
+    RTCGeometryFlags gflags;
+    std::string config; //!< additional device configuration, e.g. "relayout=1"
+
+    SameHitsTest (std::string name, int isa, RTCSceneFlags sflags, RTCGeometryFlags gflags, std::string config)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS), sflags(sflags), gflags(gflags), config(config) {}
+    
+    VerifyApplication::TestReturnValue run (VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device0 = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcDeviceGetError(device0));
+      RTCDeviceRef device1 = rtcNewDevice((cfg+","+config).c_str());
+      errorHandler(nullptr,rtcDeviceGetError(device1));
+
+      const Vec3fa center = zero;
+      const float radius = 1.0f;
+      const Vec3fa dx(1,0,0);
+      const Vec3fa dy(0,1,0);
+      std::vector<Ref<SceneGraph::Node>> nodes;
+      nodes.push_back(SceneGraph::createTriangleSphere(center,radius,50));
+      nodes.push_back(SceneGraph::createQuadSphere(center+Vec3fa(2,0,0),radius,50));
+      nodes.push_back(SceneGraph::createHairyPlane(RandomSampler_getInt(sampler),center,dx,dy,0.1f,0.01f,100,SceneGraph::HairSetNode::HAIR));
+
+      VerifyScene scene0(device0,sflags,RTC_INTERSECT1);
+      for (auto node : nodes) scene0.addGeometry(gflags,node);
+      rtcCommit (scene0);
+      AssertNoError(device0);
+
+      VerifyScene scene1(device1,sflags,RTC_INTERSECT1);
+      for (auto node : nodes) scene1.addGeometry(gflags,node);
+      rtcCommit (scene1);
+      AssertNoError(device1);
+
+      /* both scenes have to report the same hits */
+      bool passed = true;
+      for (size_t i=0; i<1024; i++)
+      {
+        const Vec3fa org(4.0f*random_float()-1.0f,2.0f*random_float()-1.0f,-4.0f);
+        const Vec3fa dir(random_float()-0.5f,random_float()-0.5f,1.0f);
+        RTCRay ray0 = makeRay(org,dir); rtcIntersect(scene0,ray0);
+        RTCRay ray1 = makeRay(org,dir); rtcIntersect(scene1,ray1);
+        passed &= ray0.geomID == ray1.geomID;
+        passed &= ray0.primID == ray1.primID;
+        passed &= ray0.tfar == ray1.tfar;
+        RTCRay shadow0 = makeRay(org,dir); rtcOccluded(scene0,shadow0);
+        RTCRay shadow1 = makeRay(org,dir); rtcOccluded(scene1,shadow1);
+        passed &= shadow0.geomID == shadow1.geomID;
+      }
+      AssertNoError(device0);
+      AssertNoError(device1);
+
+      return (VerifyApplication::TestReturnValue) passed;
+    }
+  };
+
+  /* builds a high quality scene with and without restructuring the
+   * treelets of the BVH, the restructured BVH has to report the same
+   * hits and must not traverse more nodes and leaves */
+  struct RestructureTest : public VerifyApplication::Test
+  {
+    RTCSceneFlags sflags;
+
+    RestructureTest (std::string name, int isa, RTCSceneFlags sflags)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS), sflags(sflags) {}
+    
+    VerifyApplication::TestReturnValue run (VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device0 = rtcNewDevice((cfg+",restructure=0").c_str());
+      errorHandler(nullptr,rtcDeviceGetError(device0));
+      RTCDeviceRef device1 = rtcNewDevice((cfg+",restructure=1").c_str());
+      errorHandler(nullptr,rtcDeviceGetError(device1));
+
+      const Vec3fa center = zero;
+      const float radius = 1.0f;
+      std::vector<Ref<SceneGraph::Node>> nodes;
+      nodes.push_back(SceneGraph::createTriangleSphere(center,radius,50));
+      nodes.push_back(SceneGraph::createQuadSphere(center+Vec3fa(2,0,0),radius,50));
+      nodes.push_back(SceneGraph::createTrianglePlane(Vec3fa(-1,-1,-1),Vec3fa(4,1,1),Vec3fa(-1,2,1),100,100));
+
+      VerifyScene scene0(device0,sflags,RTC_INTERSECT1);
+      for (auto node : nodes) scene0.addGeometry(RTC_GEOMETRY_STATIC,node);
+      rtcCommit (scene0);
+      AssertNoError(device0);
+
+      VerifyScene scene1(device1,sflags,RTC_INTERSECT1);
+      for (auto node : nodes) scene1.addGeometry(RTC_GEOMETRY_STATIC,node);
+      rtcCommit (scene1);
+      AssertNoError(device1);
+
+      /* both scenes have to report the same hits */
+      bool passed = true;
+      rtcEnableTraversalStats(scene0,true);
+      rtcEnableTraversalStats(scene1,true);
+      for (size_t i=0; i<4096; i++)
+      {
+        const Vec3fa org(4.0f*random_float()-1.0f,2.0f*random_float()-1.0f,-4.0f);
+        const Vec3fa dir(random_float()-0.5f,random_float()-0.5f,1.0f);
+        RTCRay ray0 = makeRay(org,dir); rtcIntersect(scene0,ray0);
+        RTCRay ray1 = makeRay(org,dir); rtcIntersect(scene1,ray1);
+        passed &= ray0.geomID == ray1.geomID;
+        passed &= ray0.primID == ray1.primID;
+        passed &= ray0.tfar == ray1.tfar;
+      }
+
+      /* the traversal cost of the rays estimates the SAH cost, allow for some noise */
+      RTCTraversalStats stats0; rtcGetTraversalStats(scene0,&stats0);
+      RTCTraversalStats stats1; rtcGetTraversalStats(scene1,&stats1);
+      AssertNoError(device0);
+      AssertNoError(device1);
+      const size_t cost0 = stats0.nodes + stats0.leaves;
+      const size_t cost1 = stats1.nodes + stats1.leaves;
+      if (!silent) { printf(" (%zu -> %zu)",cost0,cost1); fflush(stdout); }
+      passed &= cost1 <= 1.01*cost0;
+
+      return (VerifyApplication::TestReturnValue) passed;
+    }
+  };
+
+  struct PointQueryTest : public VerifyApplication::Test
+  {
+    RTCSceneFlags sflags;
+
+    PointQueryTest (std::string name, int isa, RTCSceneFlags sflags)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS), sflags(sflags) {}
+    
+    VerifyApplication::TestReturnValue run (VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcDeviceGetError(device));
+
+      /* a triangle sphere, a quad sphere, and a user geometry sphere of radius 1 */
+      const Vec3fa centers[3] = { Vec3fa(0,0,0), Vec3fa(4,0,0), Vec3fa(-4,0,0) };
+      VerifyScene scene(device,sflags,RTC_INTERSECT1);
+      scene.addGeometry(RTC_GEOMETRY_STATIC,SceneGraph::createTriangleSphere(centers[0],1.0f,50));
+      scene.addGeometry(RTC_GEOMETRY_STATIC,SceneGraph::createQuadSphere(centers[1],1.0f,50));
+      std::unique_ptr<Sphere> sphere(new Sphere(centers[2],1.0f));
+      unsigned geom2 = rtcNewUserGeometry3(scene,RTC_GEOMETRY_STATIC,1,1);
+      rtcSetBoundsFunction(scene,geom2,(RTCBoundsFunc)BoundsFunc);
+      rtcSetUserData(scene,geom2,sphere.get());
+      rtcSetPointQueryFunction(scene,geom2,(RTCPointQueryFunc)PointQueryFunc);
+      rtcCommit (scene);
+      AssertNoError(device);
+
+      /* the tessellated spheres deviate less than the tolerance from the exact sphere */
+      const float eps = 0.01f;
+      bool passed = true;
+      for (size_t i=0; i<300; i++)
+      {
+        const unsigned geomID = i%3;
+        const Vec3fa dir = normalize(Vec3fa(2.0f*random_float()-1.0f,2.0f*random_float()-1.0f,2.0f*random_float()-1.0f));
+        const float dist = 0.1f+1.8f*random_float();
+        const Vec3fa p = centers[geomID] + dist*dir;
+
+        RTCPointQuery query;
+        query.p[0] = p.x; query.p[1] = p.y; query.p[2] = p.z;
+        query.radius = float(inf);
+        query.geomID = RTC_INVALID_GEOMETRY_ID;
+        query.primID = RTC_INVALID_GEOMETRY_ID;
+        rtcPointQuery(scene,query);
+
+        const Vec3fa closest(query.closest[0],query.closest[1],query.closest[2]);
+        passed &= query.geomID == geomID;
+        passed &= abs(query.radius-abs(dist-1.0f)) < eps;
+        passed &= abs(length(closest-p)-query.radius) < eps;
+        passed &= abs(length(closest-centers[geomID])-1.0f) < eps;
+
+        /* a query sphere that does not reach the surface finds nothing */
+        RTCPointQuery query2 = query;
+        query2.radius = 0.5f*abs(dist-1.0f)-eps;
+        query2.geomID = RTC_INVALID_GEOMETRY_ID;
+        if (query2.radius > 0.0f) {
+          rtcPointQuery(scene,query2);
+          passed &= query2.geomID == RTC_INVALID_GEOMETRY_ID;
+        }
+      }
+      AssertNoError(device);
+
+      return (VerifyApplication::TestReturnValue) passed;
+    }
+  };
+
+  struct MultiHitTest : public VerifyApplication::Test
+  {
+    RTCSceneFlags sflags;
+
+    MultiHitTest (std::string name, int isa, RTCSceneFlags sflags)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS), sflags(sflags) {}
+    
+    VerifyApplication::TestReturnValue run (VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcDeviceGetError(device));
+
+      /* planes at distance 1 to 8 along the z axis, alternating between triangles and quads */
+      const unsigned numPlanes = 8;
+      VerifyScene scene(device,sflags,aflags_all);
+      for (unsigned i=0; i<numPlanes; i++) {
+        const Vec3fa p0(-1.0f,-1.0f,float(i+1));
+        if (i%2) scene.addGeometry(RTC_GEOMETRY_STATIC,SceneGraph::createQuadPlane    (p0,Vec3fa(2,0,0),Vec3fa(0,2,0),1,1));
+        else     scene.addGeometry(RTC_GEOMETRY_STATIC,SceneGraph::createTrianglePlane(p0,Vec3fa(2,0,0),Vec3fa(0,2,0),1,1));
+      }
+      rtcCommit (scene);
+      AssertNoError(device);
+
+      bool passed = true;
+      for (unsigned maxHits : { 3u, 16u })
+      {
+        const size_t numRays = 4;
+        const unsigned expected = min(maxHits,numPlanes);
+        std::vector<unsigned> numHits(numRays);
+        std::vector<RTCHitRecord> hits(numRays*maxHits);
+
+        RTCMultiHitContext context;
+        context.context.flags = RTC_INTERSECT_MULTI_HIT;
+        context.context.userRayExt = nullptr;
+        context.maxHits = maxHits;
+        context.numHits = numHits.data();
+        context.hits = hits.data();
+
+        RTCRay rays[numRays];
+        for (size_t i=0; i<numRays; i++)
+          rays[i] = makeRay(Vec3fa(1.8f*random_float()-0.9f,1.8f*random_float()-0.9f,0.0f),Vec3fa(0,0,1));
+
+        /* the closest hits are sorted by distance, and tfar got shrunk to the last hit once the buffer is full */
+        auto check = [&] (size_t i, float tfar) -> bool
+        {
+          bool ok = numHits[i] == expected;
+          for (unsigned j=0; j<min(numHits[i],maxHits); j++) {
+            const RTCHitRecord& hit = hits[i*maxHits+j];
+            ok &= hit.geomID == j;
+            ok &= abs(hit.tfar-float(j+1)) < 1E-4f;
+          }
+          if (expected == maxHits) ok &= abs(tfar-float(expected)) < 1E-4f;
+          else                     ok &= tfar == float(inf);
+          return ok;
+        };
+
+        /* single rays */
+        std::fill(numHits.begin(),numHits.end(),0);
+        for (size_t i=0; i<numRays; i++) 
+        {
+          RTCMultiHitContext ray_context = context;
+          ray_context.numHits = &numHits[i];
+          ray_context.hits = &hits[i*maxHits];
+          RTCRay ray = rays[i];
+          rtcIntersect1Ex(scene,&ray_context.context,ray);
+          passed &= check(i,ray.tfar);
+        }
+
+        /* ray packets */
+        std::fill(numHits.begin(),numHits.end(),0);
+        __aligned(16) int valid4[4] = { -1,-1,-1,-1 };
+        __aligned(16) RTCRay4 ray4;
+        for (size_t i=0; i<numRays; i++) setRay(ray4,i,rays[i]);
+        rtcIntersect4Ex(valid4,scene,&context.context,ray4);
+        for (size_t i=0; i<numRays; i++) passed &= check(i,ray4.tfar[i]);
+
+        /* ray streams */
+        std::fill(numHits.begin(),numHits.end(),0);
+        RTCRay stream[numRays];
+        for (size_t i=0; i<numRays; i++) stream[i] = rays[i];
+        rtcIntersect1M(scene,&context.context,stream,numRays,sizeof(RTCRay));
+        for (size_t i=0; i<numRays; i++) passed &= check(i,stream[i].tfar);
+      }
+      AssertNoError(device);
+
+      return (VerifyApplication::TestReturnValue) passed;
+    }
+  };
+
+  struct CompressedFormatsTest : public VerifyApplication::Test
+  {
+    RTCSceneFlags sflags;
+
+    CompressedFormatsTest (std::string name, int isa, RTCSceneFlags sflags)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS), sflags(sflags) {}
+
+    /* converts floats that are exactly representable as half precision float */
+    static uint16_t toHalf(float f)
+    {
+      if (f == 0.0f) return 0;
+      const unsigned int bits = *(unsigned int*)&f;
+      return uint16_t(((bits >> 16) & 0x8000) | ((((bits >> 23) & 0xFF)-112) << 10) | ((bits >> 13) & 0x3FF));
+    }
+
+    /* adds a grid of N*N triangle pairs or quads in some vertex and index format */
+    static void addGrid(RTCScene scene, bool quads, RTCFormat vformat, RTCFormat iformat,
+                        const std::vector<Vec3f>& positions, const std::vector<unsigned>& indices,
+                        std::vector<uint16_t>& vdata, std::vector<uint16_t>& idata, const BBox3fa& bounds)
+    {
+      const size_t numVertices = positions.size();
+      const size_t numPrims = quads ? indices.size()/4 : indices.size()/3;
+      const unsigned geomID = quads 
+        ? rtcNewQuadMesh    (scene,RTC_GEOMETRY_STATIC,numPrims,numVertices)
+        : rtcNewTriangleMesh(scene,RTC_GEOMETRY_STATIC,numPrims,numVertices);
+      rtcSetBufferFormat(scene,geomID,RTC_VERTEX_BUFFER,vformat);
+      rtcSetBufferFormat(scene,geomID,RTC_INDEX_BUFFER,iformat);
+
+      if (vformat == RTC_FORMAT_FLOAT3) {
+        rtcSetBuffer2(scene,geomID,RTC_VERTEX_BUFFER,positions.data(),0,sizeof(Vec3f),numVertices);
+      } 
+      else 
+      {
+        const Vec3fa scale = (bounds.upper-bounds.lower)*(1.0f/65535.0f);
+        rtcSetQuantizationBounds(scene,geomID,(const RTCBounds&)bounds);
+        for (const Vec3f& p : positions) {
+          const Vec3fa q = (Vec3fa(p.x,p.y,p.z)-bounds.lower)/scale;
+          for (size_t k=0; k<3; k++) 
+            vdata.push_back(vformat == RTC_FORMAT_HALF3 ? toHalf(p[k]) : uint16_t(floor(q[k]+0.5f)));
+        }
+        rtcSetBuffer2(scene,geomID,RTC_VERTEX_BUFFER,vdata.data(),0,3*sizeof(uint16_t),numVertices);
+      }
+
+      if (iformat == RTC_FORMAT_UINT) {
+        rtcSetBuffer2(scene,geomID,RTC_INDEX_BUFFER,indices.data(),0,(quads ? 4 : 3)*sizeof(unsigned),numPrims);
+      } else {
+        for (unsigned i : indices) idata.push_back(uint16_t(i));
+        rtcSetBuffer2(scene,geomID,RTC_INDEX_BUFFER,idata.data(),0,(quads ? 4 : 3)*sizeof(uint16_t),numPrims);
+      }
+    }
+    
+    VerifyApplication::TestReturnValue run (VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcDeviceGetError(device));
+
+      /* height field whose vertices are exactly representable as half precision floats */
+      const unsigned N = 8;
+      std::vector<Vec3f> positions;
+      for (unsigned y=0; y<=N; y++)
+        for (unsigned x=0; x<=N; x++)
+          positions.push_back(Vec3f(2.0f*x/N-1.0f,2.0f*y/N-1.0f,1.0f+0.125f*((x+y)%4)));
+      const BBox3fa bounds(Vec3fa(-1.0f,-1.0f,1.0f),Vec3fa(1.0f,1.0f,1.5f));
+      
+      std::vector<unsigned> triangles, quads;
+      for (unsigned y=0; y<N; y++)
+      {
+        for (unsigned x=0; x<N; x++)
+        {
+          const unsigned v0 = y*(N+1)+x, v1 = v0+1, v2 = v1+N+1, v3 = v0+N+1;
+          triangles.insert(triangles.end(), { v0,v1,v3, v1,v2,v3 });
+          quads.insert(quads.end(), { v0,v1,v2,v3 });
+        }
+      }
+
+      const std::pair<RTCFormat,RTCFormat> formats[] = {
+        { RTC_FORMAT_HALF3, RTC_FORMAT_UINT },
+        { RTC_FORMAT_QUANTIZED16x3, RTC_FORMAT_USHORT },
+        { RTC_FORMAT_FLOAT3, RTC_FORMAT_USHORT }
+      };
+      
+      bool passed = true;
+      for (bool useQuads : { false, true })
+      {
+        for (auto format : formats)
+        {
+          std::vector<uint16_t> vdata0, idata0, vdata1, idata1;
+          const std::vector<unsigned>& indices = useQuads ? quads : triangles;
+          VerifyScene scene0(device,sflags,RTC_INTERSECT1);
+          addGrid(scene0,useQuads,RTC_FORMAT_FLOAT3,RTC_FORMAT_UINT,positions,indices,vdata0,idata0,bounds);
+          rtcCommit (scene0);
+          VerifyScene scene1(device,sflags,RTC_INTERSECT1);
+          addGrid(scene1,useQuads,format.first,format.second,positions,indices,vdata1,idata1,bounds);
+          rtcCommit (scene1);
+          AssertNoError(device);
+
+          /* the compressed geometry has to report the same hits as the float geometry */
+          for (size_t i=0; i<256; i++)
+          {
+            const Vec3fa org(1.8f*random_float()-0.9f,1.8f*random_float()-0.9f,0.0f);
+            RTCRay ray0 = makeRay(org,Vec3fa(0,0,1)); rtcIntersect(scene0,ray0);
+            RTCRay ray1 = makeRay(org,Vec3fa(0,0,1)); rtcIntersect(scene1,ray1);
+            passed &= ray0.geomID == 0 && ray1.geomID == 0;
+            passed &= abs(ray0.tfar-ray1.tfar) < 1E-3f;
+          }
+        }
+      }
+      AssertNoError(device);
+
+      return (VerifyApplication::TestReturnValue) passed;
+    }
+  };
+
+  struct RaySortingTest : public VerifyApplication::Test
+  {
+    RTCSceneFlags sflags;
+
+    RaySortingTest (std::string name, int isa, RTCSceneFlags sflags)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS), sflags(sflags) {}
+    
+    VerifyApplication::TestReturnValue run (VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcDeviceGetError(device));
+
+      VerifyScene scene(device,sflags,aflags_all);
+      scene.addGeometry(RTC_GEOMETRY_STATIC,SceneGraph::createTriangleSphere(Vec3fa(-1,0,0),1.0f,50));
+      scene.addGeometry(RTC_GEOMETRY_STATIC,SceneGraph::createQuadPlane(Vec3fa(-4,-4,-2),Vec3fa(8,0,0),Vec3fa(0,8,0),16,16));
+      rtcCommit (scene);
+      AssertNoError(device);
+
+      /* incoherent rays from random origins, more than fit into a single sorted chunk */
+      const size_t numRays = 2500;
+      std::vector<RTCRay> rays(numRays);
+      for (size_t i=0; i<numRays; i++) {
+        const Vec3fa org(4.0f*random_float()-2.0f,4.0f*random_float()-2.0f,4.0f*random_float()-2.0f);
+        const Vec3fa dir(2.0f*random_float()-1.0f,2.0f*random_float()-1.0f,2.0f*random_float()-1.0f);
+        rays[i] = makeRay(org,dir);
+      }
+
+      /* sorting must not change the result of any ray */
+      bool passed = true;
+      for (bool intersect : { true, false })
+      {
+        for (bool pointers : { false, true })
+        {
+          std::vector<RTCRay> rays0 = rays, rays1 = rays;
+          std::vector<RTCRay*> ptrs1(numRays);
+          for (size_t i=0; i<numRays; i++) ptrs1[i] = &rays1[i];
+
+          RTCIntersectContext context0, context1;
+          context0.flags = RTC_INTERSECT_INCOHERENT;
+          context0.userRayExt = nullptr;
+          context1.flags = RTCIntersectFlags(RTC_INTERSECT_INCOHERENT | RTC_INTERSECT_SORT_RAYS);
+          context1.userRayExt = nullptr;
+
+          if (intersect) {
+            rtcIntersect1M(scene,&context0,rays0.data(),numRays,sizeof(RTCRay));
+            if (pointers) rtcIntersect1Mp(scene,&context1,ptrs1.data(),numRays);
+            else          rtcIntersect1M (scene,&context1,rays1.data(),numRays,sizeof(RTCRay));
+          } else {
+            rtcOccluded1M(scene,&context0,rays0.data(),numRays,sizeof(RTCRay));
+            if (pointers) rtcOccluded1Mp(scene,&context1,ptrs1.data(),numRays);
+            else          rtcOccluded1M (scene,&context1,rays1.data(),numRays,sizeof(RTCRay));
+          }
+
+          for (size_t i=0; i<numRays; i++) {
+            passed &= rays0[i].geomID == rays1[i].geomID;
+            if (intersect) {
+              passed &= rays0[i].primID == rays1[i].primID;
+              passed &= rays0[i].tfar == rays1[i].tfar;
+            }
+          }
+        }
+      }
+      AssertNoError(device);
+
+      return (VerifyApplication::TestReturnValue) passed;
+    }
+  };
+
+  struct CommitAsyncTest : public VerifyApplication::Test
+  {
+    RTCSceneFlags sflags;
+
+    CommitAsyncTest (std::string name, int isa, RTCSceneFlags sflags)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS), sflags(sflags) {}
+    
+    VerifyApplication::TestReturnValue run (VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcDeviceGetError(device));
+
+      VerifyScene scene0(device,sflags,aflags_all);
+      scene0.addGeometry(RTC_GEOMETRY_STATIC,SceneGraph::createTriangleSphere(zero,1.0f,200));
+      rtcCommit (scene0);
+      AssertNoError(device);
+
+      /* trace rays through the committed scene while the next scene gets built */
+      VerifyScene scene1(device,sflags,aflags_all);
+      scene1.addGeometry(RTC_GEOMETRY_STATIC,SceneGraph::createTriangleSphere(zero,1.0f,200));
+      rtcCommitAsync (scene1);
+
+      bool passed = true;
+      while (!rtcCommitPoll(scene1)) {
+        RTCRay ray = makeRay(Vec3fa(0.5f*random_float(),0.5f*random_float(),-2.0f),Vec3fa(0,0,1));
+        rtcIntersect(scene0,ray);
+        passed &= ray.geomID == 0;
+      }
+      rtcCommitWait (scene1);
+      AssertNoError(device);
+
+      /* both scenes have to report identical hits */
+      for (size_t i=0; i<256; i++)
+      {
+        const Vec3fa org(2.0f*random_float()-1.0f,2.0f*random_float()-1.0f,-2.0f);
+        RTCRay ray0 = makeRay(org,Vec3fa(0,0,1)); rtcIntersect(scene0,ray0);
+        RTCRay ray1 = makeRay(org,Vec3fa(0,0,1)); rtcIntersect(scene1,ray1);
+        passed &= ray0.geomID == ray1.geomID;
+        passed &= ray0.primID == ray1.primID;
+        passed &= ray0.tfar == ray1.tfar;
+      }
+
+      /* rays traced through a scene that gets rebuilt see the previously committed geometry until the build finished */
+      VerifyScene scene3(device,RTCSceneFlags(sflags | RTC_SCENE_DYNAMIC),aflags_all);
+      scene3.addGeometry(RTC_GEOMETRY_STATIC,SceneGraph::createTriangleSphere(zero,1.0f,200));
+      rtcCommit (scene3);
+      AssertNoError(device);
+
+      for (size_t i=0; i<2; i++)
+      {
+        /* the first rebuild adds a sphere, the second one removes it again */
+        if (i == 0) scene3.addGeometry(RTC_GEOMETRY_STATIC,SceneGraph::createTriangleSphere(Vec3fa(4,0,0),1.0f,200));
+        else        rtcDisable(scene3,1);
+        rtcCommitAsync (scene3);
+
+        while (!rtcCommitPoll(scene3)) {
+          RTCRay ray = makeRay(Vec3fa(0.5f*random_float(),0.5f*random_float(),-2.0f),Vec3fa(0,0,1));
+          rtcIntersect(scene3,ray);
+          passed &= ray.geomID == 0;
+        }
+        rtcCommitWait (scene3);
+        AssertNoError(device);
+
+        RTCRay ray = makeRay(Vec3fa(4.0f,0.0f,-2.0f),Vec3fa(0,0,1));
+        rtcIntersect(scene3,ray);
+        passed &= ray.geomID == (i == 0 ? 1 : RTC_INVALID_GEOMETRY_ID);
+      }
+
+      /* both sets of acceleration structures of a double buffered scene have to see all modifications */
+      VerifyScene scene4(device,RTCSceneFlags(sflags | RTC_SCENE_DYNAMIC),aflags_all);
+      const size_t numPhi = 20, numVertices = 2*numPhi*(numPhi+1);
+      Vec3fa pos0(0,0,0);
+      scene4.addGeometry(RTC_GEOMETRY_DEFORMABLE,SceneGraph::createTriangleSphere(pos0,1.0f,numPhi));
+      scene4.addGeometry(RTC_GEOMETRY_STATIC,SceneGraph::createTriangleSphere(Vec3fa(0,4,0),1.0f,numPhi));
+      rtcCommit (scene4);
+      AssertNoError(device);
+
+      for (size_t i=0; i<4; i++)
+      {
+        const Vec3fa ds(3,0,0);
+        Vec3fa* vertices = (Vec3fa*) rtcMapBuffer(scene4,0,RTC_VERTEX_BUFFER);
+        for (size_t j=0; j<numVertices; j++) vertices[j] += ds;
+        rtcUnmapBuffer(scene4,0,RTC_VERTEX_BUFFER);
+        rtcUpdate(scene4,0);
+        pos0 += ds;
+
+        rtcCommitAsync (scene4);
+        rtcCommitWait (scene4);
+        AssertNoError(device);
+
+        RTCRay ray0 = makeRay(pos0+Vec3fa(0,0,-2),Vec3fa(0,0,1)); rtcIntersect(scene4,ray0);
+        RTCRay ray1 = makeRay(pos0-ds+Vec3fa(0,0,-2),Vec3fa(0,0,1)); rtcIntersect(scene4,ray1);
+        RTCRay ray2 = makeRay(Vec3fa(0,4,-2),Vec3fa(0,0,1)); rtcIntersect(scene4,ray2);
+        passed &= ray0.geomID == 0;
+        passed &= ray1.geomID == RTC_INVALID_GEOMETRY_ID;
+        passed &= ray2.geomID == 1;
+      }
+
+      /* errors of the build get reported when waiting for the commit */
+      VerifyScene scene2(device,sflags,aflags_all);
+      unsigned geomID = scene2.addGeometry(RTC_GEOMETRY_STATIC,SceneGraph::createTriangleSphere(zero,1.0f,50));
+      rtcMapBuffer(scene2,geomID,RTC_VERTEX_BUFFER);
+      rtcCommitAsync (scene2);
+      AssertNoError(device);
+      rtcCommitWait (scene2);
+      AssertError(device,RTC_INVALID_OPERATION);
+      rtcUnmapBuffer(scene2,geomID,RTC_VERTEX_BUFFER);
+      AssertNoError(device);
+
+      return (VerifyApplication::TestReturnValue) passed;
+    }
+  };
+
+  struct BuildThreadCountTest : public VerifyApplication::Test
+  {
+    RTCSceneFlags sflags;
+
+    BuildThreadCountTest (std::string name, int isa, RTCSceneFlags sflags)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS), sflags(sflags) {}
+    
+    VerifyApplication::TestReturnValue run (VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcDeviceGetError(device));
+
+      VerifyScene scene0(device,sflags,aflags_all);
+      scene0.addGeometry(RTC_GEOMETRY_STATIC,SceneGraph::createTriangleSphere(zero,1.0f,200));
+      rtcCommit (scene0);
+      AssertNoError(device);
+
+      /* the progress monitor gets invoked by all threads building the scene */
+      struct BuildThreads
+      {
+        static bool monitor(void* ptr, const double n) 
+        {
+          BuildThreads* threads = (BuildThreads*) ptr;
+          Lock<MutexSys> lock(threads->mutex);
+          threads->ids.insert(std::this_thread::get_id());
+          return true;
+        }
+        MutexSys mutex;
+        std::set<std::thread::id> ids;
+      };
+
+      /* scenes built with a limited number of threads have to report identical hits */
+      bool passed = true;
+      for (unsigned int numThreads : { 1, 2, 0 })
+      {
+        VerifyScene scene1(device,sflags,aflags_all);
+        scene1.addGeometry(RTC_GEOMETRY_STATIC,SceneGraph::createTriangleSphere(zero,1.0f,200));
+        rtcSetBuildThreadCount(scene1,numThreads);
+
+        /* tasking systems that cannot limit the number of build threads report an error */
+        if (numThreads && rtcDeviceGetError(device) == RTC_INVALID_OPERATION)
+          return VerifyApplication::SKIPPED;
+
+        BuildThreads threads;
+        rtcSetProgressMonitorFunction(scene1,BuildThreads::monitor,&threads);
+        rtcCommitAsync (scene1);
+        while (!rtcCommitPoll(scene1)) {
+          RTCRay ray = makeRay(Vec3fa(0.5f*random_float(),0.5f*random_float(),-2.0f),Vec3fa(0,0,1));
+          rtcIntersect(scene0,ray);
+          passed &= ray.geomID == 0;
+        }
+        rtcCommitWait (scene1);
+        AssertNoError(device);
+        passed &= numThreads == 0 || threads.ids.size() <= numThreads;
+
+        for (size_t i=0; i<256; i++)
+        {
+          const Vec3fa org(2.0f*random_float()-1.0f,2.0f*random_float()-1.0f,-2.0f);
+          RTCRay ray0 = makeRay(org,Vec3fa(0,0,1)); rtcIntersect(scene0,ray0);
+          RTCRay ray1 = makeRay(org,Vec3fa(0,0,1)); rtcIntersect(scene1,ray1);
+          passed &= ray0.geomID == ray1.geomID;
+          passed &= ray0.primID == ray1.primID;
+          passed &= ray0.tfar == ray1.tfar;
+        }
+      }
+      return (VerifyApplication::TestReturnValue) passed;
+    }
+  };
+
+#if defined(TASKING_OPENMP)
+  struct OpenMPParallelBuildTest : public VerifyApplication::Test
+  {
+    RTCSceneFlags sflags;
+
+    OpenMPParallelBuildTest (std::string name, int isa, RTCSceneFlags sflags)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS), sflags(sflags) {}
+    
+    VerifyApplication::TestReturnValue run (VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcDeviceGetError(device));
+
+      VerifyScene scene0(device,sflags,aflags_all);
+      scene0.addGeometry(RTC_GEOMETRY_STATIC,SceneGraph::createTriangleSphere(zero,1.0f,200));
+      rtcCommit (scene0);
+      AssertNoError(device);
+
+      /* the build tasks get spawned into the team of the enclosing parallel region */
+      VerifyScene scene1(device,sflags,aflags_all);
+      scene1.addGeometry(RTC_GEOMETRY_STATIC,SceneGraph::createTriangleSphere(zero,1.0f,200));
+#pragma omp parallel
+      {
+#pragma omp single
+        rtcCommit (scene1);
+      }
+      AssertNoError(device);
+
+      /* every thread of the team builds its own scene */
+      std::atomic<size_t> misses(0);
+#pragma omp parallel
+      {
+        VerifyScene scene2(device,sflags,aflags_all);
+        scene2.addGeometry(RTC_GEOMETRY_STATIC,SceneGraph::createTriangleSphere(zero,1.0f,50));
+        rtcCommit (scene2);
+        RTCRay ray = makeRay(Vec3fa(0,0,-2.0f),Vec3fa(0,0,1));
+        rtcIntersect(scene2,ray);
+        if (ray.geomID != 0) misses++;
+      }
+      AssertNoError(device);
+
+      bool passed = misses == 0;
+
+      for (size_t i=0; i<256; i++)
+      {
+        const Vec3fa org(2.0f*random_float()-1.0f,2.0f*random_float()-1.0f,-2.0f);
+        RTCRay ray0 = makeRay(org,Vec3fa(0,0,1)); rtcIntersect(scene0,ray0);
+        RTCRay ray1 = makeRay(org,Vec3fa(0,0,1)); rtcIntersect(scene1,ray1);
+        passed &= ray0.geomID == ray1.geomID;
+        passed &= ray0.primID == ray1.primID;
+        passed &= ray0.tfar == ray1.tfar;
+      }
+      return (VerifyApplication::TestReturnValue) passed;
+    }
+  };
+#endif
+
+  struct TraversalStatsTest : public VerifyApplication::Test
+  {
+    RTCSceneFlags sflags;
+
+    TraversalStatsTest (std::string name, int isa, RTCSceneFlags sflags)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS), sflags(sflags) {}
+    
+    VerifyApplication::TestReturnValue run (VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcDeviceGetError(device));
+
+      VerifyScene scene(device,sflags,aflags_all);
+      scene.addGeometry(RTC_GEOMETRY_STATIC,SceneGraph::createTriangleSphere(zero,1.0f,50));
+      rtcCommit (scene);
+      AssertNoError(device);
+
+      const size_t numRays = 64;
+      std::vector<RTCRay> rays(numRays);
+      for (size_t i=0; i<numRays; i++)
+        rays[i] = makeRay(Vec3fa(0.5f*random_float(),0.5f*random_float(),-2.0f),Vec3fa(0,0,1));
+
+      auto isZero = [] (const RTCTraversalStats& stats) -> bool {
+        return stats.rays == 0 && stats.nodes == 0 && stats.leaves == 0 && stats.primitives == 0 && stats.filterCalls == 0 && stats.earlyExits == 0;
+      };
+
+      /* disabled statistics stay zero */
+      bool passed = true;
+      RTCTraversalStats stats;
+      for (size_t i=0; i<numRays; i++) { RTCRay ray = rays[i]; rtcIntersect(scene,ray); }
+      rtcGetTraversalStats(scene,&stats);
+      AssertNoError(device);
+      passed &= isZero(stats);
+
+      /* single rays */
+      rtcEnableTraversalStats(scene,true);
+      for (size_t i=0; i<numRays; i++) { RTCRay ray = rays[i]; rtcIntersect(scene,ray); }
+      rtcGetTraversalStats(scene,&stats);
+      passed &= stats.rays == numRays;
+      passed &= stats.nodes > 0 && stats.leaves > 0 && stats.primitives >= stats.leaves;
+      passed &= stats.filterCalls == 0 && stats.earlyExits == 0;
+      
+      rtcResetTraversalStats(scene);
+      rtcGetTraversalStats(scene,&stats);
+      passed &= isZero(stats);
+
+      /* every occlusion ray hits the sphere and terminates early */
+      for (size_t i=0; i<numRays; i++) { RTCRay ray = rays[i]; rtcOccluded(scene,ray); }
+      rtcGetTraversalStats(scene,&stats);
+      passed &= stats.rays == numRays;
+      passed &= stats.earlyExits == numRays;
+      rtcResetTraversalStats(scene);
+
+      /* ray packets */
+      __aligned(16) int valid4[4] = { -1,-1,-1,-1 };
+      for (size_t i=0; i<numRays; i+=4) {
+        __aligned(16) RTCRay4 ray4;
+        for (size_t j=0; j<4; j++) setRay(ray4,j,rays[i+j]);
+        rtcIntersect4(valid4,scene,ray4);
+      }
+      rtcGetTraversalStats(scene,&stats);
+      passed &= stats.rays == numRays;
+      passed &= stats.nodes > 0 && stats.leaves > 0;
+      rtcResetTraversalStats(scene);
+
+      /* statistics of ray queries are also gathered per context */
+      RTCTraversalStats context_stats;
+      memset(&context_stats,0,sizeof(context_stats));
+      RTCTraversalStatsContext context;
+      context.context.flags = RTC_INTERSECT_TRAVERSAL_STATS;
+      context.context.userRayExt = nullptr;
+      context.stats = &context_stats;
+      for (size_t i=0; i<numRays; i++) { RTCRay ray = rays[i]; rtcIntersect1Ex(scene,&context.context,ray); }
+      rtcGetTraversalStats(scene,&stats);
+      AssertNoError(device);
+      passed &= context_stats.rays == numRays;
+      passed &= memcmp(&stats,&context_stats,sizeof(stats)) == 0;
+
+      /* a context can get shared by multiple threads */
+      memset(&context_stats,0,sizeof(context_stats));
+      parallel_for(numRays, [&] (size_t i) { RTCRay ray = rays[i]; rtcIntersect1Ex(scene,&context.context,ray); });
+      AssertNoError(device);
+      passed &= context_stats.rays == numRays;
+
+      rtcGetTraversalStats(scene,nullptr);
+      AssertError(device,RTC_INVALID_ARGUMENT);
+      return (VerifyApplication::TestReturnValue) passed;
+    }
+  };
+
+  struct InstanceStackTest : public VerifyApplication::Test
+  {
+    RTCSceneFlags sflags;
+
+    InstanceStackTest (std::string name, int isa, RTCSceneFlags sflags)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS), sflags(sflags) {}
+
+    static unsigned addInstance(RTCScene scene, RTCScene object, const Vec3fa& pos)
+    {
+      const AffineSpace3fa xfm = AffineSpace3fa::translate(pos);
+      unsigned geomID = rtcNewInstance2(scene,object,1);
+      rtcSetTransform2(scene,geomID,RTC_MATRIX_COLUMN_MAJOR_ALIGNED16,(const float*)&xfm);
+      return geomID;
+    }
+    
+    VerifyApplication::TestReturnValue run (VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcDeviceGetError(device));
+
+      /* two instances of a tree containing two instances of a leaf and direct geometries, some of them in front of instances */
+      VerifyScene leaf(device,sflags,aflags_all);
+      leaf.addGeometry(RTC_GEOMETRY_STATIC,SceneGraph::createTriangleSphere(zero,0.4f,20));
+      rtcCommit (leaf);
+      VerifyScene tree(device,sflags,aflags_all);
+      tree.addGeometry(RTC_GEOMETRY_STATIC,SceneGraph::createTriangleSphere(Vec3fa(0,1,0),0.3f,20));
+      addInstance(tree,leaf,Vec3fa(-0.5f,0,0));
+      addInstance(tree,leaf,Vec3fa(+0.5f,0,0));
+      tree.addGeometry(RTC_GEOMETRY_STATIC,SceneGraph::createTriangleSphere(Vec3fa(0.5f,0.3f,-1.5f),0.1f,20));
+      rtcCommit (tree);
+      VerifyScene forest(device,sflags,aflags_all);
+      addInstance(forest,tree,Vec3fa(-2,0,0));
+      addInstance(forest,tree,Vec3fa(+2,0,0));
+      forest.addGeometry(RTC_GEOMETRY_STATIC,SceneGraph::createTriangleSphere(Vec3fa(0,3,0),0.3f,20));
+      forest.addGeometry(RTC_GEOMETRY_STATIC,SceneGraph::createTriangleSphere(Vec3fa(-1.5f,0,-2),0.3f,20));
+      rtcCommit (forest);
+      AssertNoError(device);
+
+      /* rays and the expected instance path of their hit */
+      struct Expected { Vec3fa org; unsigned geomID; std::vector<unsigned> path; };
+      const unsigned I = RTC_INVALID_GEOMETRY_ID;
+      const std::vector<Expected> expected = {
+        { Vec3fa(-2.5f,0,-5), 0, { 0,1 } },
+        { Vec3fa(+2.5f,0,-5), 0, { 1,2 } },
+        { Vec3fa(+1.5f,0,-5), 0, { 1,1 } },
+        { Vec3fa(-2.0f,1,-5), 0, { 0 } },
+        { Vec3fa( 0.0f,3,-5), 2, { } },
+        { Vec3fa( 0.0f,-3,-5), I, { } },
+        { Vec3fa(+2.5f,0.3f,-5), 3, { 1 } },
+        { Vec3fa(-1.5f,0,-5), 3, { } }
+      };
+      const size_t N = expected.size();
+      std::vector<unsigned> instIDs(N*RTC_MAX_INSTANCE_LEVEL_COUNT);
+
+      RTCInstanceStackContext context;
+      context.context.flags = RTC_INTERSECT_INSTANCE_STACK;
+      context.context.userRayExt = nullptr;
+      context.instIDs = instIDs.data();
+      context.instLevel = 0;
+
+      auto init = [&] () {
+        for (size_t i=0; i<instIDs.size(); i++)
+          instIDs[i] = i%RTC_MAX_INSTANCE_LEVEL_COUNT ? 77 : I;
+      };
+
+      auto check = [&] (size_t i, const RTCRay& ray) -> bool
+      {
+        const std::vector<unsigned>& path = expected[i].path;
+        const unsigned* ids = &instIDs[i*RTC_MAX_INSTANCE_LEVEL_COUNT];
+        bool ok = ray.geomID == expected[i].geomID;
+        ok &= ray.instID == (path.size() ? path.back() : I);
+        for (size_t j=0; j<path.size(); j++) ok &= ids[j] == path[j];
+        ok &= ids[path.size()] == I;
+        return ok;
+      };
+
+      /* single rays */
+      bool passed = true;
+      init();
+      for (size_t i=0; i<N; i++) 
+      {
+        RTCInstanceStackContext ray_context = context;
+        ray_context.instIDs = &instIDs[i*RTC_MAX_INSTANCE_LEVEL_COUNT];
+        RTCRay ray = makeRay(expected[i].org,Vec3fa(0,0,1));
+        rtcIntersect1Ex(forest,&ray_context.context,ray);
+        passed &= check(i,ray);
+      }
+
+      /* ray packets */
+      init();
+      __aligned(16) int valid4[4];
+      for (size_t i=0; i<N; i+=4)
+      {
+        RTCInstanceStackContext packet_context = context;
+        packet_context.instIDs = &instIDs[i*RTC_MAX_INSTANCE_LEVEL_COUNT];
+        __aligned(16) RTCRay4 ray4;
+        for (size_t j=0; j<4; j++) {
+          valid4[j] = i+j < N ? -1 : 0;
+          setRay(ray4,j,makeRay(expected[min(i+j,N-1)].org,Vec3fa(0,0,1)));
+        }
+        rtcIntersect4Ex(valid4,forest,&packet_context.context,ray4);
+        for (size_t j=0; j<4 && i+j<N; j++)
+          passed &= check(i+j,getRay(ray4,j));
+      }
+
+      /* ray streams */
+      init();
+      std::vector<RTCRay> rays(N);
+      for (size_t i=0; i<N; i++) rays[i] = makeRay(expected[i].org,Vec3fa(0,0,1));
+      rtcIntersect1M(forest,&context.context,rays.data(),N,sizeof(RTCRay));
+      for (size_t i=0; i<N; i++) passed &= check(i,rays[i]);
+      AssertNoError(device);
+
+      /* traversal statistics can get gathered together with the instance stack */
+      init();
+      RTCTraversalStats stats;
+      memset(&stats,0,sizeof(stats));
+      for (size_t i=0; i<N; i++) 
+      {
+        RTCInstanceStackContext ray_context = context;
+        ray_context.context.flags = RTCIntersectFlags(RTC_INTERSECT_INSTANCE_STACK | RTC_INTERSECT_TRAVERSAL_STATS);
+        ray_context.instIDs = &instIDs[i*RTC_MAX_INSTANCE_LEVEL_COUNT];
+        ray_context.stats = &stats;
+        RTCRay ray = makeRay(expected[i].org,Vec3fa(0,0,1));
+        rtcIntersect1Ex(forest,&ray_context.context,ray);
+        passed &= check(i,ray);
+      }
+      AssertNoError(device);
+      passed &= stats.rays >= N && stats.nodes > 0 && stats.leaves > 0;
+
+      /* the number of nested instancing levels is limited */
+      std::vector<Ref<VerifyScene>> chain;
+      chain.push_back(new VerifyScene(device,sflags,aflags_all));
+      chain.back()->addGeometry(RTC_GEOMETRY_STATIC,SceneGraph::createTriangleSphere(zero,1.0f,4));
+      rtcCommit (*chain.back());
+      for (size_t i=1; i<=RTC_MAX_INSTANCE_LEVEL_COUNT+1; i++) {
+        chain.push_back(new VerifyScene(device,sflags,aflags_all));
+        addInstance(*chain[i],*chain[i-1],zero);
+        rtcCommit (*chain[i]);
+        if (i <= RTC_MAX_INSTANCE_LEVEL_COUNT) AssertNoError(device);
+        else AssertError(device,RTC_INVALID_OPERATION);
+      }
+      
+      return (VerifyApplication::TestReturnValue) passed;
+    }
+  };
+
+  struct InstanceMotionTest : public VerifyApplication::Test
+  {
+    RTCSceneFlags sflags;
+
+    InstanceMotionTest (std::string name, int isa, RTCSceneFlags sflags)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS), sflags(sflags) {}
+
+    static RTCQuaternionDecomposition rotateZ(const Vec3fa& shift, float angle)
+    {
+      RTCQuaternionDecomposition qd;
+      qd.scale_x = qd.scale_y = qd.scale_z = 1.0f;
+      qd.skew_xy = qd.skew_xz = qd.skew_yz = 0.0f;
+      qd.shift_x = shift.x; qd.shift_y = shift.y; qd.shift_z = shift.z;
+      qd.quaternion_r = cos(0.5f*angle); qd.quaternion_i = 0.0f; qd.quaternion_j = 0.0f; qd.quaternion_k = sin(0.5f*angle);
+      qd.translation_x = qd.translation_y = qd.translation_z = 0.0f;
+      return qd;
+    }
+    
+    VerifyApplication::TestReturnValue run (VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcDeviceGetError(device));
+
+      VerifyScene object(device,sflags,aflags_all);
+      object.addGeometry(RTC_GEOMETRY_STATIC,SceneGraph::createTriangleSphere(zero,0.2f,20));
+      rtcCommit (object);
+
+      /* a sphere rotating by 90 degrees around the origin, and a translated sphere */
+      VerifyScene scene(device,sflags,aflags_all);
+      unsigned rotID = rtcNewInstance2(scene,object,2);
+      const RTCQuaternionDecomposition qd0 = rotateZ(Vec3fa(1,0,0),0.0f);
+      const RTCQuaternionDecomposition qd1 = rotateZ(Vec3fa(1,0,0),0.5f*float(pi));
+      rtcSetTransformQuaternion(scene,rotID,&qd0,0);
+      rtcSetTransformQuaternion(scene,rotID,&qd1,1);
+      unsigned moveID = rtcNewInstance2(scene,object,2);
+      const AffineSpace3fa xfm0 = AffineSpace3fa::translate(Vec3fa(0,-3,0));
+      const AffineSpace3fa xfm1 = AffineSpace3fa::translate(Vec3fa(2,-3,0));
+      rtcSetTransform2(scene,moveID,RTC_MATRIX_COLUMN_MAJOR_ALIGNED16,(const float*)&xfm0,0);
+      rtcSetTransform2(scene,moveID,RTC_MATRIX_COLUMN_MAJOR_ALIGNED16,(const float*)&xfm1,1);
+      rtcCommit (scene);
+      AssertNoError(device);
+
+      /* rays towards the expected sphere positions, the rotating sphere
+       * would be closer to the origin when interpolating matrices linearly */
+      struct Expected { float time; Vec3fa org; unsigned instID; };
+      const unsigned I = RTC_INVALID_GEOMETRY_ID;
+      const float s = sqrt(0.5f);
+      const float c = cos(0.125f*float(pi));
+      const std::vector<Expected> expected = {
+        { 0.00f, Vec3fa(1,0,-5), rotID },
+        { 0.25f, Vec3fa(c,sqrt(1.0f-c*c),-5), rotID },
+        { 0.50f, Vec3fa(s,s,-5), rotID },
+        { 0.50f, Vec3fa(0.5f,0.5f,-5), I },
+        { 1.00f, Vec3fa(0,1,-5), rotID },
+        { 0.00f, Vec3fa(0,-3,-5), moveID },
+        { 0.50f, Vec3fa(1,-3,-5), moveID },
+        { 0.50f, Vec3fa(0,-3,-5), I }
+      };
+
+      /* single rays */
+      bool passed = true;
+      for (size_t i=0; i<expected.size(); i++) 
+      {
+        RTCRay ray = makeRay(expected[i].org,Vec3fa(0,0,1));
+        ray.time = expected[i].time;
+        rtcIntersect(scene,ray);
+        passed &= ray.instID == expected[i].instID;
+        passed &= expected[i].instID == I || abs(ray.tfar-4.8f) < 1E-2f;
+      }
+
+      /* ray packets with different times per ray */
+      __aligned(16) int valid4[4] = { -1,-1,-1,-1 };
+      for (size_t i=0; i<expected.size(); i+=4)
+      {
+        __aligned(16) RTCRay4 ray4;
+        for (size_t j=0; j<4; j++) {
+          RTCRay ray = makeRay(expected[i+j].org,Vec3fa(0,0,1));
+          ray.time = expected[i+j].time;
+          setRay(ray4,j,ray);
+        }
+        rtcIntersect4(valid4,scene,ray4);
+        for (size_t j=0; j<4; j++)
+          passed &= getRay(ray4,j).instID == expected[i+j].instID;
+      }
+      AssertNoError(device);
+
+      return (VerifyApplication::TestReturnValue) passed;
+    }
+  };
+
+  struct PointsTest : public VerifyApplication::Test
+  {
+    RTCSceneFlags sflags;
+
+    PointsTest (std::string name, int isa, RTCSceneFlags sflags)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS), sflags(sflags) {}
+
+    VerifyApplication::TestReturnValue run (VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcDeviceGetError(device));
+      VerifyScene scene(device,sflags,aflags_all);
+
+      /* two spheres */
+      unsigned sphereID = rtcNewPoints(scene,RTC_GEOMETRY_STATIC,2,1);
+      Vec3fa* spheres = (Vec3fa*) rtcMapBuffer(scene,sphereID,RTC_VERTEX_BUFFER);
+      spheres[0] = Vec3fa(0,0,0,1.0f);
+      spheres[1] = Vec3fa(3,0,0,0.5f);
+      rtcUnmapBuffer(scene,sphereID,RTC_VERTEX_BUFFER);
+
+      /* a disc facing the rays, and a disc parallel to the rays */
+      unsigned discID = rtcNewPoints(scene,RTC_GEOMETRY_STATIC,2,1);
+      Vec3fa* discs = (Vec3fa*) rtcMapBuffer(scene,discID,RTC_VERTEX_BUFFER);
+      discs[0] = Vec3fa(0,3,0,1.0f);
+      discs[1] = Vec3fa(3,3,0,1.0f);
+      rtcUnmapBuffer(scene,discID,RTC_VERTEX_BUFFER);
+      Vec3fa* normals = (Vec3fa*) rtcMapBuffer(scene,discID,RTC_NORMAL_BUFFER);
+      normals[0] = Vec3fa(0,0,1);
+      normals[1] = Vec3fa(0,1,0);
+      rtcUnmapBuffer(scene,discID,RTC_NORMAL_BUFFER);
+
+      /* a sphere moving along the x axis */
+      unsigned moveID = rtcNewPoints(scene,RTC_GEOMETRY_STATIC,1,2);
+      Vec3fa* move0 = (Vec3fa*) rtcMapBuffer(scene,moveID,RTC_VERTEX_BUFFER0);
+      move0[0] = Vec3fa(0,-3,0,0.5f);
+      rtcUnmapBuffer(scene,moveID,RTC_VERTEX_BUFFER0);
+      Vec3fa* move1 = (Vec3fa*) rtcMapBuffer(scene,moveID,RTC_VERTEX_BUFFER1);
+      move1[0] = Vec3fa(2,-3,0,0.5f);
+      rtcUnmapBuffer(scene,moveID,RTC_VERTEX_BUFFER1);
+      rtcCommit (scene);
+      AssertNoError(device);
+
+      struct Expected { float time; Vec3fa org; unsigned geomID; unsigned primID; float tfar; };
+      const unsigned I = RTC_INVALID_GEOMETRY_ID;
+      const std::vector<Expected> expected = {
+        { 0.00f, Vec3fa(0,0,-5), sphereID, 0, 4.0f },
+        { 0.00f, Vec3fa(3.4f,0,-5), sphereID, 1, 4.7f },
+        { 0.00f, Vec3fa(3.6f,0,-5), I, I, 0.0f },
+        { 1.00f, Vec3fa(-2,0,-5), I, I, 0.0f },
+        { 0.00f, Vec3fa(0.9f,3,-5), discID, 0, 5.0f },
+        { 0.00f, Vec3fa(0.5f,3,-5), discID, 0, 5.0f },
+        { 0.00f, Vec3fa(1.1f,3,-5), I, I, 0.0f },
+        { 0.00f, Vec3fa(3,3,-5), I, I, 0.0f },
+        { 0.00f, Vec3fa(0,-3,-5), moveID, 0, 4.5f },
+        { 0.50f, Vec3fa(1,-3,-5), moveID, 0, 4.5f },
+        { 0.50f, Vec3fa(0,-3,-5), I, I, 0.0f },
+        { 1.00f, Vec3fa(2,-3,-5), moveID, 0, 4.5f }
+      };
+
+      auto check = [&] (const RTCRay& ray, const Expected& e) {
+        return ray.geomID == e.geomID && (e.geomID == I || (ray.primID == e.primID && abs(ray.tfar-e.tfar) < 1E-3f));
+      };
+
+      /* single rays */
+      bool passed = true;
+      std::vector<RTCRay> rays(expected.size());
+      for (size_t i=0; i<expected.size(); i++) 
       {
-        for (unsigned int i=0; i<8; i++) {
-          rtcDisable(scene,i);
-          AssertAnyError(device);
-        }
+        rays[i] = makeRay(expected[i].org,Vec3fa(0,0,1));
+        rays[i].time = expected[i].time;
+        RTCRay ray = rays[i];
+        rtcIntersect(scene,ray);
+        passed &= check(ray,expected[i]);
+      }
+
+      /* ray packets */
+      __aligned(16) int valid4[4] = { -1,-1,-1,-1 };
+      for (size_t i=0; i<expected.size(); i+=4)
+      {
+        __aligned(16) RTCRay4 ray4;
+        for (size_t j=0; j<4; j++) setRay(ray4,j,rays[i+j]);
+        rtcIntersect4(valid4,scene,ray4);
+        for (size_t j=0; j<4; j++)
+          passed &= check(getRay(ray4,j),expected[i+j]);
       }
+
+      /* ray streams */
+      RTCIntersectContext context;
+      context.flags = RTC_INTERSECT_INCOHERENT;
+      context.userRayExt = nullptr;
+      rtcIntersect1M(scene,&context,rays.data(),rays.size(),sizeof(RTCRay));
+      for (size_t i=0; i<expected.size(); i++)
+        passed &= check(rays[i],expected[i]);
       AssertNoError(device);
 
-      return VerifyApplication::PASSED;
+      return (VerifyApplication::TestReturnValue) passed;
     }
   };
 
@@ -1237,7 +2614,7 @@ namespace embree
       case TRIANGLE_MESH: switch (sflags) {
         case RTC_SCENE_STATIC : return avx ?  70.0f*NN :  63.0f*NN; // triangle4
         case RTC_SCENE_ROBUST : return avx ?  70.0f*NN :  63.0f*NN; // triangle4v
-        case RTC_SCENE_COMPACT: return avx ?  35.0f*NN :  35.0f*NN; // triangle4i
+        case RTC_SCENE_COMPACT: return avx2 ? 31.0f*NN :  35.0f*NN; // qbvh8 triangle4i, triangle4i
         case RTC_SCENE_DYNAMIC: return avx ? 131.0f*NN : 117.0f*NN; // triangle4
         default: return inf;
         }
@@ -1251,7 +2628,7 @@ namespace embree
       case QUAD_MESH: switch (sflags) {
         case RTC_SCENE_STATIC : return avx ? 85.0f*NN : 79.0f*NN; // quad4v
         case RTC_SCENE_ROBUST : return avx ? 85.0f*NN : 79.0f*NN; // quad4v
-        case RTC_SCENE_COMPACT: return avx ? 41.0f*NN : 41.0f*NN; // quad4i
+        case RTC_SCENE_COMPACT: return avx2 ? 37.0f*NN : 41.0f*NN; // qbvh8 quad4i, quad4i
         default: return inf;
         }
       case QUAD_MESH_MB: switch (sflags) {
@@ -1635,6 +3012,59 @@ namespace embree
     }
   };
 
+  struct IncrementalUpdateTest : public VerifyApplication::Test
+  {
+    RTCSceneFlags sflags;
+    RTCGeometryFlags gflags;
+
+    IncrementalUpdateTest (std::string name, int isa, RTCSceneFlags sflags, RTCGeometryFlags gflags)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS), sflags(sflags), gflags(gflags) {}
+
+    VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcDeviceGetError(device));
+
+      /* many spheres on a grid, such that only a few of them get modified per commit */
+      const size_t numPhi = 5;
+      const size_t numVertices = 2*numPhi*(numPhi+1);
+      const size_t numSpheres = 16*16;
+      VerifyScene scene(device,sflags,RTC_INTERSECT1);
+      std::vector<Vec3fa> pos(numSpheres);
+      std::vector<unsigned> geomIDs(numSpheres);
+      for (size_t i=0; i<numSpheres; i++) {
+        pos[i] = Vec3fa(4.0f*float(i%16),0.0f,4.0f*float(i/16));
+        geomIDs[i] = scene.addSphere(sampler,gflags,pos[i],0.5f,numPhi).first;
+      }
+      AssertNoError(device);
+
+      for (size_t i=0; i<32; i++)
+      {
+        /* move some spheres inside their grid cell, and sometimes far up to trigger a full rebuild */
+        for (size_t j=0; j<3; j++)
+        {
+          const size_t k = random_int() % numSpheres;
+          const Vec3fa p = Vec3fa(4.0f*float(k%16),0.0f,4.0f*float(k/16)) + Vec3fa(2.0f*random_float()-1.0f,0.0f,2.0f*random_float()-1.0f);
+          Vec3fa ds = p-pos[k] + Vec3fa(0.0f,i%8 == 7 ? 100.0f*random_float() : 0.0f,0.0f);
+          UpdateTest::move_mesh(scene,geomIDs[k],numVertices,ds);
+          pos[k] += ds;
+        }
+        rtcCommit (scene);
+        AssertNoError(device);
+
+        for (size_t k=0; k<numSpheres; k++) {
+          RTCRay ray = makeRay(pos[k]+Vec3fa(0,1000,0),Vec3fa(0,-1,0));
+          rtcIntersect(scene,ray);
+          if (ray.geomID != geomIDs[k]) return VerifyApplication::FAILED;
+        }
+      }
+      AssertNoError(device);
+
+      return VerifyApplication::PASSED;
+    }
+  };
+
   struct GarbageGeometryTest : public VerifyApplication::Test
   {
     GarbageGeometryTest (std::string name, int isa)
@@ -1758,6 +3188,71 @@ namespace embree
     8,9, 9,10, 10,11
   };
 
+  struct TessellationCacheTest : public VerifyApplication::Test
+  {
+    TessellationCacheTest (std::string name, int isa)
+      : VerifyApplication::Test(name,isa,VerifyApplication::TEST_SHOULD_PASS) {}
+    
+    VerifyApplication::TestReturnValue run (VerifyApplication* state, bool silent)
+    {
+      std::string cfg = state->rtcore + ",isa="+stringOfISA(isa)+",subdiv_accel=bvh4.subdivpatch1cached";
+      RTCDeviceRef device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcDeviceGetError(device));
+
+      /* the shared cache is at least as large as requested by this device */
+      bool passed = true;
+      rtcDeviceSetParameter1i(device,RTC_SOFTWARE_CACHE_SIZE,16*1024*1024);
+      rtcDeviceSetParameter1i(device,RTC_SOFTWARE_CACHE_MAX_SIZE,32*1024*1024);
+      AssertNoError(device);
+      passed &= rtcDeviceGetParameter1i(device,RTC_SOFTWARE_CACHE_SIZE) >= 16*1024*1024;
+      passed &= rtcDeviceGetParameter1i(device,RTC_SOFTWARE_CACHE_MAX_SIZE) == 32*1024*1024;
+
+      rtcDeviceSetParameter1i(device,RTC_SOFTWARE_CACHE_HITS,0);
+      rtcDeviceSetParameter1i(device,RTC_SOFTWARE_CACHE_MISSES,0);
+      rtcDeviceSetParameter1i(device,RTC_SOFTWARE_CACHE_FLUSHES,0);
+      AssertNoError(device);
+      passed &= rtcDeviceGetParameter1i(device,RTC_SOFTWARE_CACHE_HITS) == 0;
+      passed &= rtcDeviceGetParameter1i(device,RTC_SOFTWARE_CACHE_MISSES) == 0;
+
+      VerifyScene scene(device,RTC_SCENE_DYNAMIC,aflags_all);
+      unsigned geomID = scene.addGeometry(RTC_GEOMETRY_DEFORMABLE,SceneGraph::createSubdivSphere(zero,1.0f,8,16));
+      rtcCommit (scene);
+      AssertNoError(device);
+
+      auto trace = [&] () {
+        for (size_t i=0; i<256; i++) {
+          RTCRay ray = makeRay(Vec3fa(0.5f*random_float(),0.5f*random_float(),-2.0f),Vec3fa(0,0,1));
+          rtcIntersect(scene,ray);
+          passed &= ray.geomID == geomID;
+        }
+      };
+
+      /* first lookups build the cache entries, later lookups reuse them */
+      trace();
+      const ssize_t misses = rtcDeviceGetParameter1i(device,RTC_SOFTWARE_CACHE_MISSES);
+      const ssize_t hits = rtcDeviceGetParameter1i(device,RTC_SOFTWARE_CACHE_HITS);
+      passed &= misses > 0;
+      trace();
+      passed &= rtcDeviceGetParameter1i(device,RTC_SOFTWARE_CACHE_HITS) > hits;
+
+      /* counters are reset individually and only to zero */
+      rtcDeviceSetParameter1i(device,RTC_SOFTWARE_CACHE_HITS,0);
+      AssertNoError(device);
+      passed &= rtcDeviceGetParameter1i(device,RTC_SOFTWARE_CACHE_HITS) == 0;
+      passed &= rtcDeviceGetParameter1i(device,RTC_SOFTWARE_CACHE_MISSES) >= misses;
+      rtcDeviceSetParameter1i(device,RTC_SOFTWARE_CACHE_HITS,1);
+      AssertError(device,RTC_INVALID_ARGUMENT);
+
+      /* committing adapts the cache size and keeps the scene intact */
+      rtcUpdate(scene,geomID);
+      rtcCommit (scene);
+      AssertNoError(device);
+      trace();
+      passed &= rtcDeviceGetParameter1i(device,RTC_SOFTWARE_CACHE_SIZE) >= 16*1024*1024;
+      return (VerifyApplication::TestReturnValue) passed;
+    }
+  };
+
   struct InterpolateSubdivTest : public VerifyApplication::Test
   {
     size_t N;
@@ -2105,9 +3600,10 @@ namespace embree
   {
     RTCSceneFlags sflags; 
     RTCGeometryFlags gflags; 
+    std::string accel; //!< optional acceleration structure to force, e.g. "tri_accel=bvh16.triangle4"
 
-    TriangleHitTest (std::string name, int isa, RTCSceneFlags sflags, RTCGeometryFlags gflags, IntersectMode imode, IntersectVariant ivariant)
-      : VerifyApplication::IntersectTest(name,isa,imode,ivariant,VerifyApplication::TEST_SHOULD_PASS), sflags(sflags), gflags(gflags) {}
+    TriangleHitTest (std::string name, int isa, RTCSceneFlags sflags, RTCGeometryFlags gflags, IntersectMode imode, IntersectVariant ivariant, std::string accel = "")
+      : VerifyApplication::IntersectTest(name,isa,imode,ivariant,VerifyApplication::TEST_SHOULD_PASS), sflags(sflags), gflags(gflags), accel(accel) {}
 
     inline Vec3fa uniformSampleTriangle(const Vec3fa &a, const Vec3fa &b, const Vec3fa &c, float &u, float& v)
     {
@@ -2121,6 +3617,7 @@ namespace embree
     VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
     {
       std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      if (accel != "") cfg += ","+accel;
       RTCDeviceRef device = rtcNewDevice(cfg.c_str());
       errorHandler(nullptr,rtcDeviceGetError(device));
       if (!supportsIntersectMode(device,imode))
@@ -2181,13 +3678,15 @@ namespace embree
   {
     RTCSceneFlags sflags; 
     RTCGeometryFlags gflags; 
+    std::string accel; //!< optional acceleration structure to force, e.g. "quad_accel=bvh8.quad8v"
 
-    QuadHitTest (std::string name, int isa, RTCSceneFlags sflags, RTCGeometryFlags gflags, IntersectMode imode, IntersectVariant ivariant)
-      : VerifyApplication::IntersectTest(name,isa,imode,ivariant,VerifyApplication::TEST_SHOULD_PASS), sflags(sflags), gflags(gflags) {}
+    QuadHitTest (std::string name, int isa, RTCSceneFlags sflags, RTCGeometryFlags gflags, IntersectMode imode, IntersectVariant ivariant, std::string accel = "")
+      : VerifyApplication::IntersectTest(name,isa,imode,ivariant,VerifyApplication::TEST_SHOULD_PASS), sflags(sflags), gflags(gflags), accel(accel) {}
 
     VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
     {
       std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      if (accel != "") cfg += ","+accel;
       RTCDeviceRef device = rtcNewDevice(cfg.c_str());
       errorHandler(nullptr,rtcDeviceGetError(device));
       if (!supportsIntersectMode(device,imode))
@@ -2306,13 +3805,15 @@ namespace embree
     RTCSceneFlags sflags;
     RTCGeometryFlags gflags;
     GeometryType gtype;
+    std::string accel; //!< optional acceleration structure to force, e.g. "tri_accel=bvh16.triangle4"
 
-    BackfaceCullingTest (std::string name, int isa, RTCSceneFlags sflags, RTCGeometryFlags gflags, GeometryType gtype, IntersectMode imode, IntersectVariant ivariant)
-      : VerifyApplication::IntersectTest(name,isa,imode,ivariant,VerifyApplication::TEST_SHOULD_PASS), sflags(sflags), gflags(gflags), gtype(gtype) {}
+    BackfaceCullingTest (std::string name, int isa, RTCSceneFlags sflags, RTCGeometryFlags gflags, GeometryType gtype, IntersectMode imode, IntersectVariant ivariant, std::string accel = "")
+      : VerifyApplication::IntersectTest(name,isa,imode,ivariant,VerifyApplication::TEST_SHOULD_PASS), sflags(sflags), gflags(gflags), gtype(gtype), accel(accel) {}
     
     VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
     {
       std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      if (accel != "") cfg += ","+accel;
       RTCDeviceRef device = rtcNewDevice(cfg.c_str());
       errorHandler(nullptr,rtcDeviceGetError(device));
       if (!supportsIntersectMode(device,imode))
@@ -2594,15 +4095,17 @@ namespace embree
     RTCSceneFlags sflags;
     std::string model;
     Vec3fa pos;
+    std::string accel; //!< optional acceleration structure to force, e.g. "tri_accel=bvh16.triangle4v"
     static const size_t N = 10;
     static const size_t maxStreamSize = 100;
     
-    WatertightTest (std::string name, int isa, RTCSceneFlags sflags, IntersectMode imode, std::string model, const Vec3fa& pos)
-      : VerifyApplication::IntersectTest(name,isa,imode,VARIANT_INTERSECT,VerifyApplication::TEST_SHOULD_PASS), sflags(sflags), model(model), pos(pos) {}
+    WatertightTest (std::string name, int isa, RTCSceneFlags sflags, IntersectMode imode, std::string model, const Vec3fa& pos, std::string accel = "")
+      : VerifyApplication::IntersectTest(name,isa,imode,VARIANT_INTERSECT,VerifyApplication::TEST_SHOULD_PASS), sflags(sflags), model(model), pos(pos), accel(accel) {}
     
     VerifyApplication::TestReturnValue run(VerifyApplication* state, bool silent)
     {
       std::string cfg = state->rtcore + ",isa="+stringOfISA(isa);
+      if (accel != "") cfg += ","+accel;
       RTCDeviceRef device = rtcNewDevice(cfg.c_str());
       errorHandler(nullptr,rtcDeviceGetError(device));
       if (!supportsIntersectMode(device,imode))
@@ -3756,13 +5259,14 @@ namespace embree
     IntersectMode imode;
     IntersectVariant ivariant;
     size_t numPhi;
+    std::string accel; //!< optional acceleration structure to force, e.g. "tri_accel=bvh16.triangle4"
     RTCDeviceRef device;
     Ref<VerifyScene> scene;
     static const size_t numRays = 16*1024*1024;
     static const size_t deltaRays = 1024;
     
-    IncoherentRaysBenchmark (std::string name, int isa, GeometryType gtype, RTCSceneFlags sflags, RTCGeometryFlags gflags, IntersectMode imode, IntersectVariant ivariant, size_t numPhi)
-      : ParallelIntersectBenchmark(name,isa,numRays,deltaRays), gtype(gtype), sflags(sflags), gflags(gflags), imode(imode), ivariant(ivariant), numPhi(numPhi), device(nullptr)  {}
+    IncoherentRaysBenchmark (std::string name, int isa, GeometryType gtype, RTCSceneFlags sflags, RTCGeometryFlags gflags, IntersectMode imode, IntersectVariant ivariant, size_t numPhi, std::string accel = "")
+      : ParallelIntersectBenchmark(name,isa,numRays,deltaRays), gtype(gtype), sflags(sflags), gflags(gflags), imode(imode), ivariant(ivariant), numPhi(numPhi), accel(accel), device(nullptr)  {}
 
     size_t setNumPrimitives(size_t N) 
     { 
@@ -3776,6 +5280,7 @@ namespace embree
         return false;
 
       std::string cfg = state->rtcore + ",start_threads=1,set_affinity=1,isa="+stringOfISA(isa);
+      if (accel != "") cfg += ","+accel;
       device = rtcNewDevice(cfg.c_str());
       errorHandler(nullptr,rtcDeviceGetError(device));
       rtcDeviceSetErrorFunction2(device,errorHandler,nullptr);
@@ -3891,6 +5396,100 @@ namespace embree
     }
   };
 
+  /* counts data TLB or last level cache misses per incoherent ray to measure the memory locality of the BVH layout, rays are traced on the calling thread only */
+  struct MemoryLocalityBenchmark : public VerifyApplication::Benchmark
+  {
+    enum Event { DTLB_MISSES, CACHE_MISSES };
+
+    Event event;
+    size_t numPhi;
+    std::string accel; //!< optional device configuration, e.g. "relayout=1"
+    RTCDeviceRef device;
+    Ref<VerifyScene> scene;
+    int fd;
+    static const size_t numRays = 1024*1024;
+
+    MemoryLocalityBenchmark (std::string name, int isa, Event event, size_t numPhi, std::string accel = "")
+      : VerifyApplication::Benchmark(name,isa,"misses/ray",false,10), event(event), numPhi(numPhi), accel(accel), device(nullptr), fd(-1) {}
+
+    size_t setNumPrimitives(size_t N) 
+    { 
+      numPhi = size_t(ceilf(sqrtf(N/4.0f)));
+      return 4*numPhi*numPhi;
+    }
+
+    bool setup(VerifyApplication* state) 
+    {
+#if defined(__LINUX__)
+      /* hardware counters may be unavailable, e.g. inside virtual machines or due to perf_event_paranoid */
+      perf_event_attr attr;
+      memset(&attr,0,sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.disabled = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      if (event == DTLB_MISSES) {
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+      } else {
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+      }
+      fd = (int) syscall(__NR_perf_event_open,&attr,0,-1,-1,0);
+      if (fd == -1) return false;
+
+      std::string cfg = state->rtcore + ",start_threads=1,set_affinity=1,isa="+stringOfISA(isa);
+      if (accel != "") cfg += ","+accel;
+      device = rtcNewDevice(cfg.c_str());
+      errorHandler(nullptr,rtcDeviceGetError(device));
+      rtcDeviceSetErrorFunction2(device,errorHandler,nullptr);
+
+      scene = new VerifyScene(device,RTC_SCENE_STATIC,aflags_all);
+      scene->addGeometry(RTC_GEOMETRY_STATIC,SceneGraph::createTriangleSphere(zero,one,numPhi));
+      rtcCommit (*scene);
+      AssertNoError(device);
+      return true;
+#else
+      return false;
+#endif
+    }
+
+    float benchmark(VerifyApplication* state)
+    {
+#if defined(__LINUX__)
+      RandomSampler sampler;
+      RandomSampler_init(sampler,0);
+
+      ioctl(fd,PERF_EVENT_IOC_RESET,0);
+      ioctl(fd,PERF_EVENT_IOC_ENABLE,0);
+      for (size_t i=0; i<numRays; i++) {
+        RTCRay ray;
+        fastMakeRay(ray,zero,sampler);
+        rtcIntersect(*scene,ray);
+      }
+      ioctl(fd,PERF_EVENT_IOC_DISABLE,0);
+
+      long long count = 0;
+      if (read(fd,&count,sizeof(count)) != sizeof(count))
+        throw std::runtime_error("reading hardware counter failed");
+      return float(double(count)/double(numRays));
+#else
+      return 0.0f;
+#endif
+    }
+
+    virtual void cleanup(VerifyApplication* state) 
+    {
+#if defined(__LINUX__)
+      if (fd != -1) close(fd);
+#endif
+      fd = -1;
+      if (device) AssertNoError(device);
+      scene = nullptr;
+      device = nullptr;
+    }
+  };
+
   static std::atomic<ssize_t> create_geometry_bytes_used(0);
 
   struct CreateGeometryBenchmark : public VerifyApplication::Benchmark
@@ -3902,14 +5501,15 @@ namespace embree
     size_t numMeshes;
     bool update;
     bool dobenchmark; // true = measure build performance, false = measure memory consumption
+    bool perPrimitive; // reports the memory consumption in bytes per primitive instead of MB
     size_t numPrimitives;
     RTCDeviceRef device;
     Ref<VerifyScene> scene;
     std::vector<Ref<SceneGraph::Node>> geometries;
     
-    CreateGeometryBenchmark (std::string name, int isa, GeometryType gtype, RTCSceneFlags sflags, RTCGeometryFlags gflags, size_t numPhi, size_t numMeshes, bool update, bool dobenchmark)
-      : VerifyApplication::Benchmark(name,isa,dobenchmark ? "Mprims/s" : "MB",dobenchmark,dobenchmark?10:1), gtype(gtype), sflags(sflags), gflags(gflags), 
-        numPhi(numPhi), numMeshes(numMeshes), update(update), dobenchmark(dobenchmark),
+    CreateGeometryBenchmark (std::string name, int isa, GeometryType gtype, RTCSceneFlags sflags, RTCGeometryFlags gflags, size_t numPhi, size_t numMeshes, bool update, bool dobenchmark, bool perPrimitive = false)
+      : VerifyApplication::Benchmark(name,isa,dobenchmark ? "Mprims/s" : (perPrimitive ? "bytes/prim" : "MB"),dobenchmark,dobenchmark?10:1), gtype(gtype), sflags(sflags), gflags(gflags), 
+        numPhi(numPhi), numMeshes(numMeshes), update(update), dobenchmark(dobenchmark), perPrimitive(perPrimitive),
         numPrimitives(0), device(nullptr), scene(nullptr) {}
 
     size_t setNumPrimitives(size_t N) 
@@ -4016,6 +5616,8 @@ namespace embree
 
       if (dobenchmark)
         return 1E-6f*float(numPrimitives)/float(t1-t0);
+      else if (perPrimitive)
+        return float(create_geometry_bytes_used)/float(numPrimitives);
       else
         return 1E-6f*create_geometry_bytes_used;
     }
@@ -4163,6 +5765,15 @@ namespace embree
       for (auto gtype : gtypes_all)
         groups.top()->add(new GetLinearBoundsTest(to_string(gtype),isa,gtype));
       groups.pop();
+
+      push(new TestGroup("build_bvh_refit",true,true));
+      for (size_t maxLeafSize : { 8, 64 })
+      {
+        groups.top()->add(new BuildBVHRefitTest("low_"   +std::to_string((long long)maxLeafSize),isa,RTC_BUILD_QUALITY_LOW   ,maxLeafSize));
+        groups.top()->add(new BuildBVHRefitTest("medium_"+std::to_string((long long)maxLeafSize),isa,RTC_BUILD_QUALITY_MEDIUM,maxLeafSize));
+        groups.top()->add(new BuildBVHRefitTest("normal_"+std::to_string((long long)maxLeafSize),isa,RTC_BUILD_QUALITY_NORMAL,maxLeafSize));
+      }
+      groups.pop();
       
       groups.top()->add(new GetUserDataTest("get_user_data",isa));
 
@@ -4195,6 +5806,88 @@ namespace embree
         groups.top()->add(new BuildTest(to_string(sflags),isa,sflags,RTC_GEOMETRY_STATIC));
       groups.pop();
       
+      push(new TestGroup("save_load_scene",true,true));
+      for (auto sflags : sceneFlags) 
+        groups.top()->add(new SaveLoadSceneTest(to_string(sflags),isa,sflags));
+      groups.pop();
+
+      push(new TestGroup("relayout",true,true));
+      for (auto sflags : sceneFlags) 
+        groups.top()->add(new SameHitsTest(to_string(sflags),isa,sflags,RTC_GEOMETRY_STATIC,"relayout=1"));
+      groups.pop();
+
+      RTCSceneFlags restructureSceneFlags [] = { RTC_SCENE_STATIC | RTC_SCENE_HIGH_QUALITY, RTC_SCENE_STATIC | RTC_SCENE_HIGH_QUALITY | RTC_SCENE_ROBUST };
+      push(new TestGroup("restructure",true,true));
+      for (auto sflags : restructureSceneFlags) 
+        groups.top()->add(new RestructureTest(to_string(sflags),isa,sflags));
+      groups.pop();
+
+      /* the PLOC builder only supports the Triangle4 and Quad4v primitives of non-robust, non-compact scenes */
+      RTCSceneFlags plocSceneFlags [] = { RTC_SCENE_DYNAMIC, RTC_SCENE_DYNAMIC | RTC_SCENE_HIGH_QUALITY };
+      push(new TestGroup("ploc_builder",true,true));
+      for (auto sflags : plocSceneFlags) 
+        groups.top()->add(new SameHitsTest(to_string(sflags),isa,sflags,RTC_GEOMETRY_DYNAMIC,"tri_builder=ploc,quad_builder=ploc"));
+      groups.pop();
+
+      push(new TestGroup("point_query",true,true));
+      for (auto sflags : sceneFlags) 
+        groups.top()->add(new PointQueryTest(to_string(sflags),isa,sflags));
+      groups.pop();
+
+      push(new TestGroup("multi_hit",true,true));
+      for (auto sflags : sceneFlags) 
+        groups.top()->add(new MultiHitTest(to_string(sflags),isa,sflags));
+      groups.pop();
+      
+      push(new TestGroup("compressed_formats",true,true));
+      for (auto sflags : sceneFlags) 
+        groups.top()->add(new CompressedFormatsTest(to_string(sflags),isa,sflags));
+      groups.pop();
+      
+      push(new TestGroup("ray_sorting",true,true));
+      for (auto sflags : sceneFlags) 
+        groups.top()->add(new RaySortingTest(to_string(sflags),isa,sflags));
+      groups.pop();
+      
+      push(new TestGroup("commit_async",true,true));
+      for (auto sflags : sceneFlags) 
+        groups.top()->add(new CommitAsyncTest(to_string(sflags),isa,sflags));
+      groups.pop();
+      
+      push(new TestGroup("traversal_stats",true,true));
+      for (auto sflags : sceneFlags) 
+        groups.top()->add(new TraversalStatsTest(to_string(sflags),isa,sflags));
+      groups.pop();
+      
+      groups.top()->add(new TessellationCacheTest("tessellation_cache",isa));
+      
+      push(new TestGroup("instance_stack",true,true));
+      for (auto sflags : sceneFlags) 
+        groups.top()->add(new InstanceStackTest(to_string(sflags),isa,sflags));
+      groups.pop();
+      
+      push(new TestGroup("instance_motion",true,true));
+      for (auto sflags : sceneFlags) 
+        groups.top()->add(new InstanceMotionTest(to_string(sflags),isa,sflags));
+      groups.pop();
+      
+      push(new TestGroup("points",true,true));
+      for (auto sflags : sceneFlags) 
+        groups.top()->add(new PointsTest(to_string(sflags),isa,sflags));
+      groups.pop();
+      
+      push(new TestGroup("build_thread_count",true,true));
+      for (auto sflags : sceneFlags) 
+        groups.top()->add(new BuildThreadCountTest(to_string(sflags),isa,sflags));
+      groups.pop();
+
+#if defined(TASKING_OPENMP)
+      push(new TestGroup("openmp_parallel_build",true,true));
+      for (auto sflags : sceneFlags) 
+        groups.top()->add(new OpenMPParallelBuildTest(to_string(sflags),isa,sflags));
+      groups.pop();
+#endif
+      
       push(new TestGroup("overlapping_primitives",true,true));
       for (auto sflags : sceneFlags)
         groups.top()->add(new OverlappingGeometryTest(to_string(sflags),isa,sflags,RTC_GEOMETRY_STATIC,clamp(int(intensity*10000),1000,100000)));
@@ -4226,6 +5919,10 @@ namespace embree
           }
         }
       }
+      for (auto sflags : sceneFlagsDynamic) {
+        groups.top()->add(new IncrementalUpdateTest("incremental.deformable."+to_string(sflags),isa,sflags,RTC_GEOMETRY_DEFORMABLE));
+        groups.top()->add(new IncrementalUpdateTest("incremental.dynamic."+to_string(sflags),isa,sflags,RTC_GEOMETRY_DYNAMIC));
+      }
       groups.pop();
 
       groups.top()->add(new GarbageGeometryTest("build_garbage_geom",isa));
@@ -4388,6 +6085,84 @@ namespace embree
         groups.pop();
       }
       
+      /* acceleration structures that only get used when selected
+       * through the configuration, the robust ones have to be watertight */
+      std::vector<std::string> triAccels, triAccelsRobust, quadAccels;
+      if ((isa & AVX) == AVX) {
+        triAccels.push_back("bvh8.triangle8");
+        triAccelsRobust.push_back("bvh8.triangle8v");
+        quadAccels.push_back("bvh8.quad8v");
+      }
+      if (isa == AVX512SKX) {
+        triAccels.push_back("bvh16.triangle4");
+        triAccels.push_back("bvh16.triangle16");
+        triAccelsRobust.push_back("bvh16.triangle4v");
+        quadAccels.push_back("bvh16.quad4v");
+      }
+      std::vector<std::string> triAccelsAll = triAccels;
+      triAccelsAll.insert(triAccelsAll.end(),triAccelsRobust.begin(),triAccelsRobust.end());
+
+      /* the 16-wide BVH does not support packets of 4 and 8 rays */
+      auto supportsAccelMode = [] (const std::string& accel, IntersectMode imode) {
+        return accel.compare(0,5,"bvh16") != 0 || (imode != MODE_INTERSECT4 && imode != MODE_INTERSECT8);
+      };
+
+      push(new TestGroup("forced_accels",true,true));
+
+      push(new TestGroup("triangle_hit",true,true));
+      for (auto accel : triAccelsAll)
+        for (auto imode : intersectModes) 
+          for (auto ivariant : intersectVariants)
+            if (has_variant(imode,ivariant) && supportsAccelMode(accel,imode))
+              groups.top()->add(new TriangleHitTest(accel+"."+to_string(RTC_SCENE_STATIC,imode,ivariant),isa,RTC_SCENE_STATIC,RTC_GEOMETRY_STATIC,imode,ivariant,"tri_accel="+accel));
+      groups.pop();
+
+      /* quad accels select the Pluecker intersector for robust scenes */
+      RTCSceneFlags quadSceneFlags [] = { RTC_SCENE_STATIC, RTC_SCENE_STATIC | RTC_SCENE_ROBUST };
+      push(new TestGroup("quad_hit",true,true));
+      for (auto accel : quadAccels)
+        for (auto sflags : quadSceneFlags)
+          for (auto imode : intersectModes) 
+            for (auto ivariant : intersectVariants)
+              if (has_variant(imode,ivariant) && supportsAccelMode(accel,imode))
+                groups.top()->add(new QuadHitTest(accel+"."+to_string(sflags,imode,ivariant),isa,sflags,RTC_GEOMETRY_STATIC,imode,ivariant,"quad_accel="+accel));
+      groups.pop();
+
+      if (rtcDeviceGetParameter1i(device,RTC_CONFIG_BACKFACE_CULLING)) 
+      {
+        push(new TestGroup("backface_culling",true,true));
+        for (auto accel : triAccelsAll)
+          for (auto imode : intersectModes) 
+            for (auto ivariant : intersectVariants)
+              if (has_variant(imode,ivariant) && supportsAccelMode(accel,imode))
+                groups.top()->add(new BackfaceCullingTest(accel+"."+to_string(RTC_SCENE_STATIC,imode,ivariant),isa,RTC_SCENE_STATIC,RTC_GEOMETRY_STATIC,TRIANGLE_MESH,imode,ivariant,"tri_accel="+accel));
+        groups.pop();
+      }
+
+      push(new TestGroup("watertight_triangles",true,true)); {
+        std::string watertightModels [] = {"sphere.triangles", "plane.triangles"};
+        const Vec3fa watertight_pos = Vec3fa(148376.0f,1234.0f,-223423.0f);
+        for (auto accel : triAccelsRobust)
+          for (auto imode : intersectModes) 
+            for (std::string model : watertightModels) 
+              if (supportsAccelMode(accel,imode))
+                groups.top()->add(new WatertightTest(accel+"."+to_string(RTC_SCENE_STATIC | RTC_SCENE_ROBUST,imode)+"."+model,isa,RTC_SCENE_STATIC | RTC_SCENE_ROBUST,imode,model,watertight_pos,"tri_accel="+accel));
+        groups.pop();
+      }
+
+      push(new TestGroup("watertight_quads",true,true)); {
+        std::string watertightModels [] = {"sphere.quads", "plane.quads"};
+        const Vec3fa watertight_pos = Vec3fa(148376.0f,1234.0f,-223423.0f);
+        for (auto accel : quadAccels)
+          for (auto imode : intersectModes) 
+            for (std::string model : watertightModels) 
+              if (supportsAccelMode(accel,imode))
+                groups.top()->add(new WatertightTest(accel+"."+to_string(RTC_SCENE_STATIC | RTC_SCENE_ROBUST,imode)+"."+model,isa,RTC_SCENE_STATIC | RTC_SCENE_ROBUST,imode,model,watertight_pos,"quad_accel="+accel));
+        groups.pop();
+      }
+
+      groups.pop(); // forced_accels
+
       /*push(new TestGroup("small_triangle_hit_test",true,true)); {
         const Vec3fa pos = Vec3fa(0.0f,0.0f,0.0f);
         const float radius = 1000000.0f;
@@ -4494,6 +6269,92 @@ namespace embree
             groups.top()->add(new IncoherentRaysBenchmark("incoherent."+to_string(gtype)+"_1000k."+to_string(sflags.first,imode.first,imode.second),
                                                           isa,gtype,sflags.first,sflags.second,imode.first,imode.second,501));
 
+      /* compare BVH widths and 4-wide against 8- and 16-wide triangle leaves */
+      std::vector<const char*> tri_accels;
+      if ((isa & AVX) == AVX) {
+        tri_accels.push_back("bvh8.triangle4");
+        tri_accels.push_back("bvh8.triangle8");
+      }
+      if (isa == AVX512SKX) {
+        tri_accels.push_back("bvh16.triangle4");
+        tri_accels.push_back("bvh16.triangle16");
+      }
+      if (tri_accels.size())
+      {
+        const IntersectMode packet_mode = isa == AVX512SKX ? MODE_INTERSECT16 : MODE_INTERSECT8;
+        std::pair<IntersectMode,IntersectVariant> accel_imodes[] = {
+          std::make_pair(MODE_INTERSECT1,VARIANT_INTERSECT),
+          std::make_pair(MODE_INTERSECT1,VARIANT_OCCLUDED),
+          std::make_pair(packet_mode,VARIANT_INTERSECT),
+          std::make_pair(MODE_INTERSECT1M,VARIANT_INTERSECT_INCOHERENT)
+        };
+        for (auto tri_accel : tri_accels)
+          for (auto imode : accel_imodes)
+            groups.top()->add(new IncoherentRaysBenchmark("incoherent."+std::string(tri_accel)+"_1000k."+to_string(RTC_SCENE_STATIC,imode.first,imode.second),
+                                                          isa,TRIANGLE_MESH,RTC_SCENE_STATIC,RTC_GEOMETRY_STATIC,imode.first,imode.second,501,"tri_accel="+std::string(tri_accel)));
+      }
+
+      /* compare high quality builds with and without restructuring the treelets of the BVH */
+      std::pair<const char*,std::string> restructure_configs[] = {
+        std::make_pair("off","restructure=0"),
+        std::make_pair("on","restructure=1")
+      };
+      std::pair<IntersectMode,IntersectVariant> restructure_imodes[] = {
+        std::make_pair(MODE_INTERSECT1,VARIANT_INTERSECT),
+        std::make_pair(MODE_INTERSECT1M,VARIANT_INTERSECT_INCOHERENT)
+      };
+      for (auto config : restructure_configs)
+        for (auto imode : restructure_imodes)
+          groups.top()->add(new IncoherentRaysBenchmark("incoherent.restructure_"+std::string(config.first)+"_1000k."+to_string(RTC_SCENE_STATIC | RTC_SCENE_HIGH_QUALITY,imode.first,imode.second),
+                                                        isa,TRIANGLE_MESH,RTC_SCENE_STATIC | RTC_SCENE_HIGH_QUALITY,RTC_GEOMETRY_STATIC,imode.first,imode.second,501,config.second));
+
+      /* compare the quantized BVH8 used for compact scenes on AVX2 against the uncompressed BVH8 and the BVH4 used for compact scenes before */
+      if ((isa & AVX2) == AVX2)
+      {
+        std::pair<const char*,size_t> compact_num_primitives[] = {
+          std::make_pair("1000k",501),
+          std::make_pair("10000k",1581)
+        };
+        const char* compact_accels[] = { "qbvh8.triangle4i", "bvh8.triangle4", "bvh4.triangle4i" };
+        const IntersectMode packet_mode = isa == AVX512SKX ? MODE_INTERSECT16 : MODE_INTERSECT8;
+        std::pair<IntersectMode,IntersectVariant> compact_imodes[] = {
+          std::make_pair(MODE_INTERSECT1,VARIANT_INTERSECT),
+          std::make_pair(packet_mode,VARIANT_INTERSECT),
+          std::make_pair(MODE_INTERSECT1M,VARIANT_INTERSECT_INCOHERENT)
+        };
+        for (auto num_prims : compact_num_primitives)
+          for (auto tri_accel : compact_accels)
+            for (auto imode : compact_imodes)
+              groups.top()->add(new IncoherentRaysBenchmark("incoherent.compact_"+std::string(tri_accel)+"_"+num_prims.first+"."+to_string(RTC_SCENE_STATIC,imode.first,imode.second),
+                                                            isa,TRIANGLE_MESH,RTC_SCENE_STATIC,RTC_GEOMETRY_STATIC,imode.first,imode.second,num_prims.second,"tri_accel="+std::string(tri_accel)));
+      }
+
+      /* compare the default BVH layout against nodes and leaves relaid out in traversal order, large scenes show the effect on TLB and cache misses */
+      std::vector<std::pair<const char*,size_t>> locality_num_primitives;
+      locality_num_primitives.push_back(std::make_pair("1000k",501));
+      locality_num_primitives.push_back(std::make_pair("100000k",5000));
+
+      std::vector<std::pair<const char*,std::string>> locality_layouts;
+      locality_layouts.push_back(std::make_pair("default",""));
+      locality_layouts.push_back(std::make_pair("relayout","relayout=1"));
+
+      std::pair<IntersectMode,IntersectVariant> locality_imodes[] = {
+        std::make_pair(MODE_INTERSECT1,VARIANT_INTERSECT),
+        std::make_pair(MODE_INTERSECT1,VARIANT_OCCLUDED),
+        std::make_pair(MODE_INTERSECT1M,VARIANT_INTERSECT_INCOHERENT)
+      };
+
+      for (auto num_prims : locality_num_primitives)
+        for (auto layout : locality_layouts)
+        {
+          const std::string suffix = std::string(layout.first)+"_"+num_prims.first;
+          for (auto imode : locality_imodes)
+            groups.top()->add(new IncoherentRaysBenchmark("incoherent.layout_"+suffix+"."+to_string(RTC_SCENE_STATIC,imode.first,imode.second),
+                                                          isa,TRIANGLE_MESH,RTC_SCENE_STATIC,RTC_GEOMETRY_STATIC,imode.first,imode.second,num_prims.second,layout.second));
+          groups.top()->add(new MemoryLocalityBenchmark("dtlb_misses.layout_"+suffix,isa,MemoryLocalityBenchmark::DTLB_MISSES,num_prims.second,layout.second));
+          groups.top()->add(new MemoryLocalityBenchmark("cache_misses.layout_"+suffix,isa,MemoryLocalityBenchmark::CACHE_MISSES,num_prims.second,layout.second));
+        }
+
       std::vector<std::pair<RTCSceneFlags,RTCGeometryFlags>> benchmark_create_sflags_gflags;
       benchmark_create_sflags_gflags.push_back(std::make_pair(RTC_SCENE_STATIC,RTC_GEOMETRY_STATIC));
       //benchmark_create_sflags_gflags.push_back(std::make_pair(RTC_SCENE_DYNAMIC,RTC_GEOMETRY_STATIC));
@@ -4555,6 +6416,20 @@ namespace embree
 
       groups.pop(); // embree_reported_memory
 
+      /* compares the memory efficiency of the default and compact acceleration structures independent of the scene size */
+      push(new TestGroup("embree_reported_memory_per_prim",false,false));
+
+      std::vector<std::pair<RTCSceneFlags,RTCGeometryFlags>> benchmark_memory_sflags_gflags = benchmark_create_sflags_gflags;
+      benchmark_memory_sflags_gflags.push_back(std::make_pair(RTC_SCENE_STATIC | RTC_SCENE_COMPACT,RTC_GEOMETRY_STATIC));
+
+      for (auto gtype : benchmark_create_gtypes)
+        for (auto sflags : benchmark_memory_sflags_gflags)
+          for (auto num_prims : num_primitives)
+            groups.top()->add(new CreateGeometryBenchmark(to_string(gtype)+"_"+std::get<0>(num_prims)+"."+to_string(sflags.first,sflags.second),
+                                                          isa,gtype,sflags.first,sflags.second,std::get<1>(num_prims),std::get<2>(num_prims),false,false,true));
+
+      groups.pop(); // embree_reported_memory_per_prim
+
       groups.pop(); // isa
     }
 